@@ -9,6 +9,7 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdlist/cmdlist_memory_copy_params.h"
+#include "level_zero/experimental/source/graph/graph_captured_apis.h"
 #include "level_zero/ze_intel_gpu.h"
 
 namespace L0 {
@@ -208,6 +209,53 @@ zexCommandListVerifyMemory(ze_command_list_handle_t hCommandList,
     return cmdList->verifyMemory(allocationPtr, expectedData, sizeOfComparison, comparisonMode) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernels(ze_command_list_handle_t hCommandList,
+                                  uint32_t numKernels,
+                                  const ze_kernel_handle_t *phKernels,
+                                  const ze_group_count_t *pGroupCounts,
+                                  ze_event_handle_t *phSignalEvents,
+                                  uint32_t numWaitEvents,
+                                  ze_event_handle_t *phWaitEvents) {
+    hCommandList = toInternalType(hCommandList);
+    auto cmdList = L0::CommandList::fromHandle(hCommandList);
+
+    if (!cmdList) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+
+    if (numKernels == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (!phKernels || !pGroupCounts || (numWaitEvents > 0 && !phWaitEvents)) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    for (uint32_t i = 0; i < numKernels; i++) {
+        if (!phKernels[i]) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    // captured as individual launches, so graph replay does not depend on this extension
+    ze_result_t captureRet = ZE_RESULT_ERROR_NOT_AVAILABLE;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        captureRet = cmdList->capture<CaptureApi::zeCommandListAppendLaunchKernel>(hCommandList, phKernels[i], &pGroupCounts[i],
+                                                                                   phSignalEvents ? phSignalEvents[i] : nullptr,
+                                                                                   i == 0 ? numWaitEvents : 0u,
+                                                                                   i == 0 ? phWaitEvents : static_cast<ze_event_handle_t *>(nullptr));
+        if (captureRet != ZE_RESULT_ERROR_NOT_AVAILABLE && captureRet != ZE_RESULT_SUCCESS) {
+            return captureRet;
+        }
+    }
+    if (captureRet != ZE_RESULT_ERROR_NOT_AVAILABLE) {
+        return captureRet;
+    }
+
+    return cmdList->appendLaunchKernels(numKernels, phKernels, pGroupCounts, phSignalEvents, numWaitEvents, phWaitEvents);
+}
+
 ze_result_t ZE_APICALL
 zeCommandListVisitExt(ze_command_list_handle_t cmdlist,
                       const ze_visit_ext_desc_t *desc) {
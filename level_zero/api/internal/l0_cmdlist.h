@@ -92,6 +92,16 @@ zexCommandListVerifyMemory(
     size_t sizeOfComparison,
     zex_verify_memory_compare_type_t comparisonMode);
 
+ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernels(
+    ze_command_list_handle_t hCommandList,
+    uint32_t numKernels,
+    const ze_kernel_handle_t *phKernels,
+    const ze_group_count_t *pGroupCounts,
+    ze_event_handle_t *phSignalEvents,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents);
+
 ze_result_t ZE_APICALL
 zeCommandListVisitExt(
     ze_command_list_handle_t cmdlist,
@@ -16,6 +16,7 @@
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
+#include "level_zero/core/source/module/module_imp.h"
 
 namespace L0 {
 
@@ -85,30 +86,17 @@ Kernel *BuiltInKernelLibImpl::getImageFunction(ImageBuiltIn func, const NEO::Bui
     return imageBuiltins[cacheIndex]->func.get();
 }
 
+void BuiltInKernelLibImpl::getBuiltinBuildOptions(std::string &apiOptions, std::string &internalOptions) {
+    // same options ModuleImp::initializeTranslationUnit passes to the compiler for a built-in module built from SPIR-V without build flags
+    ModuleImp::BuildFlagsState buildFlagsState{};
+    std::string internalBuildOptions;
+    ModuleImp::createBuildOptions(*device, "", false, apiOptions, internalBuildOptions, buildFlagsState);
+    internalOptions = ModuleTranslationUnit::generateInternalCompilerOptions(*device, internalBuildOptions.c_str());
+}
+
 std::unique_ptr<BuiltInKernelLibImpl::BuiltInKernelData> BuiltInKernelLibImpl::loadBuiltIn(NEO::BuiltIn::BaseKernel baseKernel, const NEO::BuiltIn::AddressingMode &mode, const char *kernelName) {
     using BuiltInCodeType = NEO::BuiltIn::CodeType;
 
-    StackVec<BuiltInCodeType, 2> supportedTypes{};
-    bool requiresRebuild = !device->getNEODevice()->getExecutionEnvironment()->isOneApiPvcWaEnv();
-    if (!requiresRebuild && !NEO::debugManager.flags.RebuildPrecompiledKernels.get()) {
-        supportedTypes.push_back(BuiltInCodeType::binary);
-    }
-
-    supportedTypes.push_back(BuiltInCodeType::intermediate);
-
-    NEO::BuiltIn::Code builtinCode{};
-
-    for (auto &builtinCodeType : supportedTypes) {
-        builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(baseKernel, mode, builtinCodeType, *device->getNEODevice());
-        if (!builtinCode.resource.empty()) {
-            break;
-        }
-    }
-
-    if (builtinCode.resource.empty()) {
-        return nullptr;
-    }
-
     [[maybe_unused]] ze_result_t res;
 
     const auto compositeIndex = NEO::BuiltIn::builderIndex(baseKernel, mode);
@@ -117,6 +105,36 @@ std::unique_ptr<BuiltInKernelLibImpl::BuiltInKernelData> BuiltInKernelLibImpl::l
     }
 
     if (this->modules[compositeIndex].get() == nullptr) {
+        StackVec<BuiltInCodeType, 2> supportedTypes{};
+        bool requiresRebuild = !device->getNEODevice()->getExecutionEnvironment()->isOneApiPvcWaEnv();
+        if (!requiresRebuild && !NEO::debugManager.flags.RebuildPrecompiledKernels.get()) {
+            supportedTypes.push_back(BuiltInCodeType::binary);
+        }
+
+        supportedTypes.push_back(BuiltInCodeType::intermediate);
+
+        auto &resourceLoader = builtInsLib->getBuiltinsLib();
+        NEO::BuiltIn::Code builtinCode{};
+
+        const bool binaryCacheAllowed = (supportedTypes[0] == BuiltInCodeType::binary) && resourceLoader.getBinaryCache(*device->getNEODevice());
+        std::string apiOptions;
+        std::string internalOptions;
+        if (binaryCacheAllowed) {
+            getBuiltinBuildOptions(apiOptions, internalOptions);
+            builtinCode = resourceLoader.getCachedBuiltinBinary(baseKernel, mode, *device->getNEODevice(), apiOptions, internalOptions);
+        }
+
+        for (auto &builtinCodeType : supportedTypes) {
+            if (!builtinCode.resource.empty()) {
+                break;
+            }
+            builtinCode = resourceLoader.getBuiltinCode(baseKernel, mode, builtinCodeType, *device->getNEODevice());
+        }
+
+        if (builtinCode.resource.empty()) {
+            return nullptr;
+        }
+
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle = {};
         ze_module_desc_t moduleDesc = {};
@@ -127,6 +145,16 @@ std::unique_ptr<BuiltInKernelLibImpl::BuiltInKernelData> BuiltInKernelLibImpl::l
         UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
 
         module.reset(Module::fromHandle(moduleHandle));
+
+        if (binaryCacheAllowed && builtinCode.type == BuiltInCodeType::intermediate) {
+            size_t binarySize = 0u;
+            module->getNativeBinary(&binarySize, nullptr);
+            if (binarySize > 0u) {
+                std::vector<char> binary(binarySize);
+                module->getNativeBinary(&binarySize, reinterpret_cast<uint8_t *>(binary.data()));
+                resourceLoader.cacheBuiltinBinary(baseKernel, mode, *device->getNEODevice(), apiOptions, internalOptions, binary);
+            }
+        }
         this->modules[compositeIndex] = std::move(module);
     }
 
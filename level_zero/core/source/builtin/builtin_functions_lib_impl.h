@@ -12,6 +12,7 @@
 #include "level_zero/core/source/module/module.h"
 
 #include <atomic>
+#include <string>
 #include <vector>
 
 namespace NEO {
@@ -44,6 +45,8 @@ struct BuiltInKernelLibImpl : BuiltInKernelLib, NEO::NonCopyableClass {
     static bool initBuiltinsAsyncEnabled(Device *device);
 
   protected:
+    MOCKABLE_VIRTUAL void getBuiltinBuildOptions(std::string &apiOptions, std::string &internalOptions);
+
     static constexpr uint32_t maxBufferCacheSize = static_cast<uint32_t>(BufferBuiltIn::count) * NEO::BuiltIn::addressingModeCount;
     static constexpr uint32_t maxImageCacheSize = static_cast<uint32_t>(ImageBuiltIn::count) * NEO::BuiltIn::addressingModeCount;
 
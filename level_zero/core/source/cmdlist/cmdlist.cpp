@@ -591,6 +591,9 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
 
     commandList->copyThroughLockedPtrEnabled = gfxCoreHelper.copyThroughLockedPtrEnabled(hwInfo, productHelper);
     commandList->isSmallBarConfigPresent = NEO::isSmallBarConfigPresent(device->getOsInterface());
+    if (commandList->copyThroughLockedPtrEnabled) {
+        commandList->cpuCopyProperties = NEO::getCpuCopyProperties(device->getOsInterface());
+    }
     auto isBcsPreferredForCopyOffload = NEO::debugManager.flags.EnableBlitterForEnqueueOperations.getIfNotDefault(productHelper.blitEnqueuePreferred(false));
     const bool inOrderOrOutOfOrderOffloadSupported = commandList->isInOrderExecutionEnabled() ||
                                                      device->getL0GfxCoreHelper().isCopyOffloadForOutOfOrderImmediateCmdListSupported();
@@ -15,6 +15,7 @@
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/cache_policy.h"
+#include "shared/source/helpers/cpu_copy_helper.h"
 #include "shared/source/helpers/definitions/command_encoder_args.h"
 #include "shared/source/helpers/heap_base_address_model.h"
 #include "shared/source/helpers/in_order_cmd_helpers.h"
@@ -158,6 +159,9 @@ struct CommandList : _ze_command_list_handle_t {
                                                             const uint32_t *pNumLaunchArguments,
                                                             const ze_group_count_t *pLaunchArgumentsBuffer, ze_event_handle_t hEvent,
                                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) = 0;
+    virtual ze_result_t appendLaunchKernels(uint32_t numKernels, const ze_kernel_handle_t *kernelHandles,
+                                            const ze_group_count_t *pGroupCounts, ze_event_handle_t *phSignalEvents,
+                                            uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
     virtual ze_result_t appendLaunchKernelWithArguments(ze_kernel_handle_t hKernel,
                                                         const ze_group_count_t groupCounts,
                                                         const ze_group_size_t groupSizes,
@@ -858,6 +862,7 @@ struct CommandList : _ze_command_list_handle_t {
     uint32_t estimatedNumberOfCommands = 0;
     NEO::BuiltIn::AddressingMode defaultBuiltInMode;
     NEO::QueueThrottle queueThrottle = NEO::QueueThrottle::MEDIUM;
+    NEO::CpuCopyProperties cpuCopyProperties{};
 
     uint8_t powerHint = 0u;
     bool isSyncModeQueue = false;
@@ -155,6 +155,12 @@ struct CommandListCoreFamily : public CommandList {
                                                     ze_event_handle_t hEvent,
                                                     uint32_t numWaitEvents,
                                                     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+    ze_result_t appendLaunchKernels(uint32_t numKernels,
+                                    const ze_kernel_handle_t *kernelHandles,
+                                    const ze_group_count_t *pGroupCounts,
+                                    ze_event_handle_t *phSignalEvents,
+                                    uint32_t numWaitEvents,
+                                    ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendLaunchKernelWithArguments(ze_kernel_handle_t hKernel,
                                                 const ze_group_count_t groupCounts,
                                                 const ze_group_size_t groupSizes,
@@ -720,6 +720,27 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     return ret;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernels(uint32_t numKernels,
+                                                                      const ze_kernel_handle_t *kernelHandles,
+                                                                      const ze_group_count_t *pGroupCounts,
+                                                                      ze_event_handle_t *phSignalEvents,
+                                                                      uint32_t numWaitEvents,
+                                                                      ze_event_handle_t *phWaitEvents) {
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto hSignalEvent = phSignalEvents ? phSignalEvents[i] : nullptr;
+        CmdListKernelLaunchParams launchParams = {};
+
+        // wait events gate the first kernel, the remaining ones follow it in the same command stream
+        auto ret = appendLaunchKernel(kernelHandles[i], pGroupCounts[i], hSignalEvent,
+                                      i == 0 ? numWaitEvents : 0u, i == 0 ? phWaitEvents : nullptr, launchParams);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithArguments(ze_kernel_handle_t hKernel,
                                                                                   const ze_group_count_t groupCounts,
@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <span>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -31,6 +32,7 @@ using MutexLock = std::unique_lock<CsrMutex>;
 struct EventPool;
 struct Event;
 inline constexpr size_t commonImmediateCommandSize = 4 * MemoryConstants::kiloByte;
+inline constexpr uint32_t maxKernelsPerImmediateFlush = 64;
 
 struct CpuMemCopyInfo {
     void *const dstPtr;
@@ -78,6 +80,13 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
                                            ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
 
+    ze_result_t appendLaunchKernels(uint32_t numKernels,
+                                    const ze_kernel_handle_t *kernelHandles,
+                                    const ze_group_count_t *pGroupCounts,
+                                    ze_event_handle_t *phSignalEvents,
+                                    uint32_t numWaitEvents,
+                                    ze_event_handle_t *phWaitEvents) override;
+
     ze_result_t appendBarrier(ze_event_handle_t hSignalEvent,
                               uint32_t numWaitEvents,
                               ze_event_handle_t *phWaitEvents, CmdListWaitEventParameters &waitEventsParameters) override;
@@ -233,6 +242,11 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                                 NEO::AppendOperations appendOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate,
                                                 MutexLock *outerLock,
                                                 std::unique_lock<std::mutex> *outerLockForIndirect);
+    ze_result_t flushImmediateWithSignalEvents(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies,
+                                               NEO::AppendOperations appendOperation, bool copyOffloadSubmission, std::span<const ze_event_handle_t> signalEvents,
+                                               bool requireTaskCountUpdate, MutexLock *outerLock, std::unique_lock<std::mutex> *outerLockForIndirect);
+    size_t getPerfCountersCommandsSize(Event *signalEvent);
+    bool isSeparateFlushRequired(Kernel &kernel, const ze_group_count_t &threadGroupDimensions);
 
     ze_result_t appendBarrierWithCopyOffloadSynchronization(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
                                                             CmdListWaitEventParameters &waitEventsParameters, bool isStallingOperation);
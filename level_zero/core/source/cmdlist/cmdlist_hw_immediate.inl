@@ -616,16 +616,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
 
     size_t perfCountersCommandsSize = 0;
-    auto *signalEvent = hSignalEvent ? Event::fromHandle(hSignalEvent) : nullptr;
-    if (signalEvent && signalEvent->getPerfCounterNode() != nullptr && !launchParams.makeKernelCommandView) {
-        auto perfCounters = this->device->getNEODevice()->getPerformanceCounters();
-        if (perfCounters) {
-            auto commandBufferType = NEO::EngineHelpers::isCcs(this->getCsr(false)->getOsContext().getEngineType())
-                                         ? MetricsLibraryApi::GpuCommandBufferType::Compute
-                                         : MetricsLibraryApi::GpuCommandBufferType::Render;
-            perfCountersCommandsSize = perfCounters->getGpuCommandsSize(commandBufferType, true) +
-                                       perfCounters->getGpuCommandsSize(commandBufferType, false);
-        }
+    if (hSignalEvent && !launchParams.makeKernelCommandView) {
+        perfCountersCommandsSize = getPerfCountersCommandsSize(Event::fromHandle(hSignalEvent));
     }
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize + perfCountersCommandsSize, false);
@@ -637,6 +629,114 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     return flushImmediate(ret, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, NEO::AppendOperations::kernel, false, hSignalEvent, false, nullptr, nullptr);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernels(uint32_t numKernels,
+                                                                               const ze_kernel_handle_t *kernelHandles,
+                                                                               const ze_group_count_t *pGroupCounts,
+                                                                               ze_event_handle_t *phSignalEvents,
+                                                                               uint32_t numWaitEvents,
+                                                                               ze_event_handle_t *phWaitEvents) {
+    tryResetKernelWithAssertFlag();
+
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    uint32_t chunkStart = 0;
+    while (chunkStart < numKernels) {
+        // Kernels of a chunk share a single flush, so they have to fit into current command buffer and
+        // must not require different stream state, which is programmed once per flush. Wait events are
+        // resolved by the first kernel of each chunk.
+        bool relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
+        bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
+
+        uint32_t chunkSize = std::min(numKernels - chunkStart, maxKernelsPerImmediateFlush);
+        size_t chunkCommandsSize = 0;
+        for (uint32_t i = chunkStart; i < chunkStart + chunkSize; i++) {
+            chunkCommandsSize += commonImmediateCommandSize;
+            if (phSignalEvents && phSignalEvents[i]) {
+                chunkCommandsSize += getPerfCountersCommandsSize(Event::fromHandle(phSignalEvents[i]));
+            }
+        }
+        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, chunkCommandsSize, false);
+
+        ze_result_t appendRet = ZE_RESULT_SUCCESS;
+        uint32_t chunkEnd = chunkStart;
+        while (chunkEnd < chunkStart + chunkSize) {
+            if ((chunkEnd != chunkStart) && isSeparateFlushRequired(*Kernel::fromHandle(kernelHandles[chunkEnd]), pGroupCounts[chunkEnd])) {
+                break;
+            }
+
+            const bool firstInChunk = (chunkEnd == chunkStart);
+            CmdListKernelLaunchParams launchParams = {};
+            launchParams.relaxedOrderingDispatch = firstInChunk && relaxedOrderingDispatch;
+            appendRet = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(kernelHandles[chunkEnd], pGroupCounts[chunkEnd],
+                                                                                 phSignalEvents ? phSignalEvents[chunkEnd] : nullptr,
+                                                                                 firstInChunk ? numWaitEvents : 0u, firstInChunk ? phWaitEvents : nullptr,
+                                                                                 launchParams);
+            if (appendRet != ZE_RESULT_SUCCESS) {
+                break;
+            }
+            chunkEnd++;
+        }
+
+        if (chunkEnd != chunkStart) {
+            std::span<const ze_event_handle_t> chunkSignalEvents{};
+            if (phSignalEvents) {
+                chunkSignalEvents = std::span<const ze_event_handle_t>(phSignalEvents + chunkStart, chunkEnd - chunkStart);
+            }
+            ret = flushImmediateWithSignalEvents(ZE_RESULT_SUCCESS, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, NEO::AppendOperations::kernel, false,
+                                                 chunkSignalEvents, false, nullptr, nullptr);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+        }
+        if (appendRet != ZE_RESULT_SUCCESS) {
+            return appendRet;
+        }
+        chunkStart = chunkEnd;
+    }
+
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getPerfCountersCommandsSize(Event *signalEvent) {
+    if (signalEvent->getPerfCounterNode() == nullptr) {
+        return 0;
+    }
+    auto perfCounters = this->device->getNEODevice()->getPerformanceCounters();
+    if (!perfCounters) {
+        return 0;
+    }
+    auto commandBufferType = NEO::EngineHelpers::isCcs(this->getCsr(false)->getOsContext().getEngineType())
+                                 ? MetricsLibraryApi::GpuCommandBufferType::Compute
+                                 : MetricsLibraryApi::GpuCommandBufferType::Render;
+    return perfCounters->getGpuCommandsSize(commandBufferType, true) +
+           perfCounters->getGpuCommandsSize(commandBufferType, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSeparateFlushRequired(Kernel &kernel, const ze_group_count_t &threadGroupDimensions) {
+    if ((this->cmdListHeapAddressModel == NEO::HeapAddressModel::privateHeaps) && !this->isHeaplessModeEnabled() &&
+        ((kernel.getSurfaceStateHeapDataSize() > 0) || this->dynamicHeapRequired)) {
+        // private heaps may be reallocated during dispatch, which requires new state base address
+        return true;
+    }
+
+    auto currentStreamState = this->requiredStreamState;
+    this->requiredStreamState.stateComputeMode.clearIsDirty();
+    this->requiredStreamState.frontEndState.clearIsDirty();
+    this->requiredStreamState.pipelineSelect.clearIsDirty();
+    this->requiredStreamState.stateBaseAddress.clearIsDirty();
+
+    this->updateStreamPropertiesForFlushTaskDispatchFlags(kernel, false, threadGroupDimensions, false);
+
+    bool stateChanged = this->requiredStreamState.stateComputeMode.isDirty() ||
+                        this->requiredStreamState.frontEndState.isDirty() ||
+                        this->requiredStreamState.pipelineSelect.isDirty() ||
+                        this->requiredStreamState.stateBaseAddress.isDirty();
+    this->requiredStreamState = currentStreamState;
+    return stateChanged;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
@@ -1482,8 +1582,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
                                                                           NEO::AppendOperations appendOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate,
                                                                           MutexLock *outerLock,
                                                                           std::unique_lock<std::mutex> *outerLockForIndirect) {
-    auto signalEvent = Event::fromHandle(hSignalEvent);
+    std::span<const ze_event_handle_t> signalEvents{};
+    if (hSignalEvent) {
+        signalEvents = std::span<const ze_event_handle_t>(&hSignalEvent, 1);
+    }
+    return flushImmediateWithSignalEvents(inputRet, performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, appendOperation, copyOffloadSubmission,
+                                          signalEvents, requireTaskCountUpdate, outerLock, outerLockForIndirect);
+}
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediateWithSignalEvents(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies,
+                                                                                          NEO::AppendOperations appendOperation, bool copyOffloadSubmission, std::span<const ze_event_handle_t> signalEvents,
+                                                                                          bool requireTaskCountUpdate, MutexLock *outerLock, std::unique_lock<std::mutex> *outerLockForIndirect) {
     const auto copyOffloadModeForOperation = getCopyOffloadModeForOperation(copyOffloadSubmission);
     auto queue = getCmdQImmediate(copyOffloadModeForOperation);
     this->latestFlushIsDualCopyOffload = (copyOffloadModeForOperation == CopyOffloadModes::dualStream);
@@ -1493,7 +1603,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
         queue->getCsr()->ensurePrimaryCsrInitialized(*this->device->getNEODevice());
     }
 
-    if (signalEvent) {
+    for (auto hSignalEvent : signalEvents) {
+        auto signalEvent = Event::fromHandle(hSignalEvent);
+        if (!signalEvent) {
+            continue;
+        }
         signalEvent->setCsr(queue->getCsr(), isInOrderExecutionEnabled());
         signalEvent->setCsrForCacheFlush(this->getCsr(false));
 
@@ -1503,16 +1617,24 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     }
 
     if (inputRet == ZE_RESULT_SUCCESS) {
-        if (signalEvent && (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
-            signalEvent->setLatestUsedCmdQueue(queue);
+        if (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0) {
+            for (auto hSignalEvent : signalEvents) {
+                if (hSignalEvent) {
+                    Event::fromHandle(hSignalEvent)->setLatestUsedCmdQueue(queue);
+                }
+            }
         }
         inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, appendOperation, copyOffloadSubmission, requireTaskCountUpdate,
                                                             outerLock, outerLockForIndirect);
-        if (signalEvent && inputRet == ZE_RESULT_SUCCESS) {
+        if (inputRet == ZE_RESULT_SUCCESS) {
             // Record this operation's completed task count on the signaling CSR so that a later
             // host synchronization on the event cleans temporary allocations up to this event's
             // own completion, instead of a live (possibly stale) tag read that can under-clean.
-            signalEvent->setCleanupTaskCount(queue->getCsr(), queue->getTaskCount());
+            for (auto hSignalEvent : signalEvents) {
+                if (hSignalEvent) {
+                    Event::fromHandle(hSignalEvent)->setCleanupTaskCount(queue->getCsr(), queue->getTaskCount());
+                }
+            }
         }
     }
 
@@ -1705,7 +1827,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
     }
 
     if (NEO::debugManager.flags.EnableCpuStreamMemcpy.get() != 0) {
-        NEO::streamCopy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+        NEO::cpuCopy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size, this->cpuCopyProperties);
     } else {
         memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
     }
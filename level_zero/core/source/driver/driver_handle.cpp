@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/os_library.h"
 #include "shared/source/release_helpers/compiler_release_helper/compiler_release_helper.h"
 #include "shared/source/utilities/staging_buffer_manager.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/context/context.h"
@@ -228,6 +229,9 @@ ze_result_t DriverHandle::getExtensionProperties(uint32_t *pCount,
 }
 
 DriverHandle::~DriverHandle() {
+    // pending module builds use devices, drain them first
+    moduleBuildWorkerPool.reset();
+
     if (memoryManager != nullptr) {
         if (this->svmAllocsManager) {
             this->svmAllocsManager->cleanupUSMAllocCaches();
@@ -389,6 +393,13 @@ void DriverHandle::initHostUsmAllocPoolOnce() {
     });
 }
 
+NEO::WorkerPool *DriverHandle::getModuleBuildWorkerPool() {
+    std::call_once(this->moduleBuildWorkerPoolOnceFlag, [this]() {
+        this->moduleBuildWorkerPool = std::make_unique<NEO::WorkerPool>(static_cast<uint32_t>(NEO::debugManager.flags.AsyncModuleBuildThreads.get()));
+    });
+    return this->moduleBuildWorkerPool.get();
+}
+
 NEO::UsmMemAllocPool::CustomCleanupFn DriverHandle::getPoolCleanupFn() {
     return [this](const void *ptr) { Context::fromHandle(this->defaultContext)->freePeerAllocationsFromAll(ptr, false); };
 }
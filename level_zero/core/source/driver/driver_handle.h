@@ -34,6 +34,7 @@ class OsLibrary;
 class SVMAllocsManager;
 class GraphicsAllocation;
 class StagingBufferManager;
+class WorkerPool;
 class IpcSocketServer;
 struct SvmAllocationData;
 enum class AllocationType;
@@ -165,6 +166,8 @@ class DriverHandle : public BaseDriver, public NEO::NonCopyableAndNonMovableClas
     NEO::UsmMemAllocPool::CustomCleanupFn getPoolCleanupFn();
     NEO::UsmMemAllocPool *getHostUsmPoolOwningPtr(const void *ptr);
 
+    NEO::WorkerPool *getModuleBuildWorkerPool();
+
     void shutdownIpcSocketServer();
     bool unregisterIpcHandleWithServer(uint64_t handleId);
     std::string getIpcSocketServerPath();
@@ -193,6 +196,7 @@ class DriverHandle : public BaseDriver, public NEO::NonCopyableAndNonMovableClas
     NEO::UsmMemAllocPoolsFacade usmHostMemAllocPoolFacade;
     ze_context_handle_t defaultContext = nullptr;
     std::unique_ptr<NEO::StagingBufferManager> stagingBufferManager;
+    std::unique_ptr<NEO::WorkerPool> moduleBuildWorkerPool;
 
     std::unique_ptr<NEO::OsLibrary> rtasLibraryHandle;
     bool rtasLibraryUnavailable = false;
@@ -228,6 +232,7 @@ class DriverHandle : public BaseDriver, public NEO::NonCopyableAndNonMovableClas
     bool enableIpcHandleSharingByDefault = true;
     std::once_flag hostUsmPoolOnceFlag;
     std::once_flag deviceUsmPoolOnceFlag;
+    std::once_flag moduleBuildWorkerPoolOnceFlag;
 
     // Error messages per thread, variable initialized / destroyed per thread,
     // not based on the lifetime of the object of a class.
@@ -88,6 +88,7 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_L0_FUNC_PTR_IF_EXIST(zexCommandListAppendCustomOperation);
     RETURN_L0_FUNC_PTR_IF_EXIST(zexCommandListSetCleanupCallback);
     RETURN_L0_FUNC_PTR_IF_EXIST(zexCommandListVerifyMemory);
+    RETURN_L0_FUNC_PTR_IF_EXIST(zexCommandListAppendLaunchKernels);
     RETURN_L0_FUNC_PTR_IF_EXIST(zeCommandListVisitExt);
 
     // event
@@ -86,23 +86,11 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromData(const uint8_t *pRaw
     uint64_t ip = 0ULL;
     memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
     ip &= ipSamplingIpMaskXe2Xe3;
-    StallSumIpDataXe2Xe3Core_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpDataXe2Xe3Core_t{};
-        stallSumData->tdrCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumData->activeCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpDataXe2Xe3Core_t *>(stallSumIpDataMap[ip]);
+    auto &stallSumIpDataEntry = stallSumIpDataMap[ip];
+    if (stallSumIpDataEntry == nullptr) {
+        stallSumIpDataEntry = new StallSumIpDataXe2Xe3Core_t{};
     }
+    StallSumIpDataXe2Xe3Core_t *stallSumData = reinterpret_cast<StallSumIpDataXe2Xe3Core_t *>(stallSumIpDataEntry);
     tempAddr += ipStallSamplingOffset;
 
     auto getCount = [&tempAddr]() {
@@ -133,12 +121,13 @@ void L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromMap(std::map<uint64_t, v
     for (auto &entry : sourceMap) {
         uint64_t ip = entry.first;
         StallSumIpDataXe2Xe3Core_t *sourceData = reinterpret_cast<StallSumIpDataXe2Xe3Core_t *>(entry.second);
-        if (stallSumIpDataMap.count(ip) == 0) {
+        auto [destEntry, inserted] = stallSumIpDataMap.try_emplace(ip, nullptr);
+        if (inserted) {
             StallSumIpDataXe2Xe3Core_t *newData = new StallSumIpDataXe2Xe3Core_t{};
             memcpy_s(newData, sizeof(StallSumIpDataXe2Xe3Core_t), sourceData, sizeof(StallSumIpDataXe2Xe3Core_t));
-            stallSumIpDataMap[ip] = newData;
+            destEntry->second = newData;
         } else {
-            StallSumIpDataXe2Xe3Core_t *destData = reinterpret_cast<StallSumIpDataXe2Xe3Core_t *>(stallSumIpDataMap[ip]);
+            StallSumIpDataXe2Xe3Core_t *destData = reinterpret_cast<StallSumIpDataXe2Xe3Core_t *>(destEntry->second);
 
             destData->tdrCount += sourceData->tdrCount;
             destData->otherCount += sourceData->otherCount;
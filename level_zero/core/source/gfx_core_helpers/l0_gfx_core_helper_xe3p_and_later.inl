@@ -81,23 +81,11 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromData(const uint8_t *pRaw
     uint64_t ip = 0ULL;
     memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
     ip &= ipSamplingIpMaskXe3p;
-    StallSumIpDataXe3pCore_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpDataXe3pCore_t{};
-        stallSumData->tdrCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumData->activeCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpDataXe3pCore_t *>(stallSumIpDataMap[ip]);
+    auto &stallSumIpDataEntry = stallSumIpDataMap[ip];
+    if (stallSumIpDataEntry == nullptr) {
+        stallSumIpDataEntry = new StallSumIpDataXe3pCore_t{};
     }
+    StallSumIpDataXe3pCore_t *stallSumData = reinterpret_cast<StallSumIpDataXe3pCore_t *>(stallSumIpDataEntry);
     tempAddr += ipStallSamplingOffset;
 
     auto getCount = [&tempAddr]() {
@@ -128,12 +116,13 @@ void L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromMap(std::map<uint64_t, v
     for (auto &entry : sourceMap) {
         uint64_t ip = entry.first;
         StallSumIpDataXe3pCore_t *sourceData = reinterpret_cast<StallSumIpDataXe3pCore_t *>(entry.second);
-        if (stallSumIpDataMap.count(ip) == 0) {
+        auto [destEntry, inserted] = stallSumIpDataMap.try_emplace(ip, nullptr);
+        if (inserted) {
             StallSumIpDataXe3pCore_t *newData = new StallSumIpDataXe3pCore_t{};
             memcpy_s(newData, sizeof(StallSumIpDataXe3pCore_t), sourceData, sizeof(StallSumIpDataXe3pCore_t));
-            stallSumIpDataMap[ip] = newData;
+            destEntry->second = newData;
         } else {
-            StallSumIpDataXe3pCore_t *destData = reinterpret_cast<StallSumIpDataXe3pCore_t *>(stallSumIpDataMap[ip]);
+            StallSumIpDataXe3pCore_t *destData = reinterpret_cast<StallSumIpDataXe3pCore_t *>(destEntry->second);
             destData->tdrCount += sourceData->tdrCount;
             destData->otherCount += sourceData->otherCount;
             destData->controlCount += sourceData->controlCount;
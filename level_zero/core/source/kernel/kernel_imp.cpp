@@ -1393,6 +1393,10 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         this->privateState.internalResidencyContainer.push_back(rtDispatchGlobalsInfo->rtDispatchGlobalsArray);
     }
 
+    if (NEO::debugManager.flags.EnableDispatchTemplateCache.get() == 1) {
+        this->dispatchTemplateCache = std::make_unique<NEO::DispatchTemplateCache>();
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1418,6 +1422,9 @@ std::unique_ptr<KernelImp> KernelImp::makeDependentClone() {
     clone->module = this->module;
     clone->sharedState = this->sharedState;
     clone->privateState = this->privateState;
+    if (this->dispatchTemplateCache) {
+        clone->dispatchTemplateCache = std::make_unique<NEO::DispatchTemplateCache>();
+    }
     return std::unique_ptr<KernelImp>{clone};
 }
 
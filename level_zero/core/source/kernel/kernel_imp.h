@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/command_container/dispatch_template_cache.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/unified_memory/unified_memory.h"
@@ -196,6 +197,7 @@ struct KernelImp : Kernel {
     void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const override;
     void patchBindlessOffsetsForImplicitArgs(uint64_t bindlessSurfaceStateBaseOffset) const;
     void patchSamplerBindlessOffsetsInCrossThreadData(uint64_t samplerStateOffset) const override;
+    NEO::DispatchTemplateCache *getDispatchTemplateCache() const override { return dispatchTemplateCache.get(); }
 
     NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() override {
         return this->sharedState->privateMemoryGraphicsAllocation;
@@ -255,6 +257,7 @@ struct KernelImp : Kernel {
     std::unique_ptr<KernelSharedState> ownedSharedState = nullptr;
     KernelSharedState *sharedState = nullptr;
     KernelMutableState privateState{};
+    std::unique_ptr<NEO::DispatchTemplateCache> dispatchTemplateCache;
 };
 
 } // namespace L0
@@ -40,6 +40,32 @@ void CpuPageFaultManager::transferToGpu(void *ptr, void *device) {
                                                             allocData->size, false, 0);
     UNRECOVERABLE_IF(ret);
 }
+void CpuPageFaultManager::transferChunkToCpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::Device *l0Device = static_cast<L0::Device *>(device);
+    l0Device->getNEODevice()->stopDirectSubmissionForCopyEngine();
+
+    NEO::SvmAllocationData *allocData = l0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        l0Device->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
+                                                            allocData->gpuAllocations.getGraphicsAllocation(l0Device->getRootDeviceIndex()),
+                                                            size, true, offset);
+    UNRECOVERABLE_IF(ret);
+}
+void CpuPageFaultManager::transferChunkToGpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::Device *l0Device = static_cast<L0::Device *>(device);
+    l0Device->getNEODevice()->stopDirectSubmissionForCopyEngine();
+
+    NEO::SvmAllocationData *allocData = l0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        l0Device->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(l0Device->getRootDeviceIndex()),
+                                                            allocData->cpuAllocation,
+                                                            size, false, offset);
+    UNRECOVERABLE_IF(ret);
+}
 void CpuPageFaultManager::allowCPUMemoryEviction(bool evict, void *ptr, PageFaultData &pageFaultData) {
     L0::Device *l0Device = static_cast<L0::Device *>(pageFaultData.cmdQ);
 
@@ -78,6 +104,7 @@ void transferAndUnprotectMemoryWithHints(NEO::CpuPageFaultManager *pageFaultHand
             end = std::chrono::steady_clock::now();
             long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
             pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+            pageFaultHandler->countMigratedBytes(NEO::CpuPageFaultManager::AllocationDomain::cpu, pageFaultData.size);
 
             PRINT_STRING(NEO::debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(allocPtr), pageFaultData.size, elapsedTime / 1e3);
         }
@@ -50,6 +50,7 @@
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/utilities/const_stringref.h"
 #include "shared/source/utilities/isa_pool_allocator.h"
+#include "shared/source/utilities/parallel_for.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/device/device.h"
@@ -64,6 +65,7 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -87,6 +89,16 @@ NEO::ConstStringRef enableFP64GenEmu = "-ze-fp64-gen-emu";
 NEO::ConstStringRef registerFileSize = "-ze-exp-register-file-size";
 } // namespace BuildOptions
 
+namespace {
+// module whose asynchronous build runs on the current thread; its own API calls made while building must not wait
+thread_local const ModuleImp *moduleBuiltOnThisThread = nullptr;
+} // namespace
+
+uint32_t ModuleImp::getInitializationThreads() {
+    auto maxThreads = NEO::debugManager.flags.ParallelModuleInitializationThreads.get();
+    return maxThreads > 1 ? static_cast<uint32_t>(maxThreads) : 1u;
+}
+
 ModuleTranslationUnit::ModuleTranslationUnit(L0::Device *device)
     : device(device) {
 }
@@ -194,8 +206,12 @@ std::string ModuleTranslationUnit::generateCompilerOptions(const char *buildOpti
     if (nullptr != buildOptions) {
         options = buildOptions;
     }
+    return generateInternalCompilerOptions(*device, internalBuildOptions);
+}
+
+std::string ModuleTranslationUnit::generateInternalCompilerOptions(L0::Device &device, const char *internalBuildOptions) {
     std::string internalOptions = NEO::CompilerOptions::concatenate(internalBuildOptions, BuildOptions::hasBufferOffsetArg);
-    auto &neoDevice = *device->getNEODevice();
+    auto &neoDevice = *device.getNEODevice();
 
     if (neoDevice.getExecutionEnvironment()->isFP64EmulationEnabled()) {
         internalOptions = NEO::CompilerOptions::concatenate(internalOptions, BuildOptions::enableFP64GenEmu);
@@ -211,7 +227,7 @@ std::string ModuleTranslationUnit::generateCompilerOptions(const char *buildOpti
     bool isDebuggerActive = neoDevice.getDebugger() != nullptr;
     NEO::CompilerOptions::concatenateAppend(internalOptions, compilerProductHelper.getCachingPolicyOptions(isDebuggerActive));
 
-    NEO::CompilerOptions::applyExtraInternalOptions(internalOptions, device->getHwInfo(), compilerProductHelper, NEO::CompilerOptions::HeaplessMode::defaultMode);
+    NEO::CompilerOptions::applyExtraInternalOptions(internalOptions, device.getHwInfo(), compilerProductHelper, NEO::CompilerOptions::HeaplessMode::defaultMode);
     return internalOptions;
 }
 
@@ -537,6 +553,7 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
+    binary.maxDecodeThreads = ModuleImp::getInitializationThreads();
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -692,6 +709,10 @@ ModuleImp::~ModuleImp() {
             destroyPrintfKernel(kernel->toHandle());
         }
     }
+    if (this->isaUploadDeferred) {
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Lazy ISA upload: %zu bytes deferred, %zu bytes never uploaded\n",
+                     lazyIsaUploadStatistics.deferredBytes, lazyIsaUploadStatistics.deferredBytes - lazyIsaUploadStatistics.uploadedBytes);
+    }
     this->kernelImmData.clear();
     if (this->sharedIsaAllocation) {
         auto neoDevice = this->device->getNEODevice();
@@ -789,7 +810,11 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
 
     if ((this->isFullyLinked && this->type == ModuleType::user) ||
         ((this->sharedIsaAllocation || this->kernelsIsaParentRegion) && this->type == ModuleType::builtin)) {
-        this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
+        if (this->isLazyIsaUploadAllowed()) {
+            this->deferIsaUpload();
+        } else {
+            this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
+        }
 
         if (device->getL0Debugger()) {
             auto allocs = getModuleAllocations();
@@ -807,6 +832,65 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     return result;
 }
 
+bool ModuleImp::isAsyncBuildAllowed(const ze_module_desc_t *desc) const {
+    if (NEO::debugManager.flags.AsyncModuleBuildThreads.get() <= 0) {
+        return false;
+    }
+
+    // the build runs after zeModuleCreate returns, so only inputs which can be copied up front are supported
+    // and there is no build log or debugger notification the caller could observe too early
+    return this->type == ModuleType::user &&
+           desc->format == ZE_MODULE_FORMAT_IL_SPIRV &&
+           desc->pNext == nullptr &&
+           (desc->pConstants == nullptr || desc->pConstants->numConstants == 0) &&
+           this->moduleBuildLog == nullptr &&
+           this->device->getL0Debugger() == nullptr;
+}
+
+ze_result_t ModuleImp::initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
+    auto input = reinterpret_cast<const char *>(desc->pInputModule);
+    this->asyncBuildInput.assign(input, input + desc->inputSize);
+    const bool hasBuildFlags = desc->pBuildFlags != nullptr;
+    if (hasBuildFlags) {
+        this->asyncBuildFlags = desc->pBuildFlags;
+    }
+
+    auto buildTask = std::make_shared<std::packaged_task<ze_result_t()>>([this, neoDevice, hasBuildFlags, asyncDesc = *desc]() mutable {
+        asyncDesc.pInputModule = reinterpret_cast<const uint8_t *>(this->asyncBuildInput.data());
+        asyncDesc.pBuildFlags = hasBuildFlags ? this->asyncBuildFlags.c_str() : nullptr;
+        asyncDesc.pConstants = nullptr;
+
+        moduleBuiltOnThisThread = this;
+        auto result = this->initialize(&asyncDesc, neoDevice);
+        moduleBuiltOnThisThread = nullptr;
+        return result;
+    });
+    this->asyncBuildResult = buildTask->get_future().share();
+
+    if (!this->device->getDriverHandle()->getModuleBuildWorkerPool()->submit([buildTask]() { (*buildTask)(); })) {
+        (*buildTask)();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ModuleImp::waitForAsyncBuild() const {
+    if (!this->asyncBuildResult.valid() || moduleBuiltOnThisThread == this) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return this->asyncBuildResult.get();
+}
+
+ze_result_t ModuleImp::waitForAsyncBuilds(uint32_t numModules, ze_module_handle_t *phModules) {
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    for (auto i = 0u; i < numModules; i++) {
+        auto buildResult = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForAsyncBuild();
+        if (result == ZE_RESULT_SUCCESS) {
+            result = buildResult;
+        }
+    }
+    return result;
+}
+
 void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
     const auto &productHelper = neoDevice->getProductHelper();
     auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
@@ -835,15 +919,18 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
         DEBUG_BREAK_IF(isaBufferSize == 0);
         auto isaBuffer = std::vector<std::byte>(isaBufferSize);
 
-        for (auto &data : this->kernelImmData) {
+        // every kernel is sub-allocated from moduleAllocation, so ISA of different kernels lands in disjoint ranges of isaBuffer
+        moduleAllocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+        moduleAllocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+        NEO::parallelFor(this->kernelImmData.size(), getInitializationThreads(), kernelInitializationChunkSize, [&](size_t kernelId) {
+            auto &data = this->kernelImmData[kernelId];
             DEBUG_BREAK_IF(data->isIsaCopiedToAllocation());
-            data->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            data->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+            DEBUG_BREAK_IF(data->getIsaGraphicsAllocation() != moduleAllocation);
 
             auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(data, isaSegmentsForPatching);
             auto isaOffset = data->getIsaOffsetInParentAllocation() - moduleOffset;
             memcpy_s(isaBuffer.data() + isaOffset, isaBufferSize - isaOffset, kernelHeapPtr, kernelHeapSize);
-        }
+        });
         NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *moduleAllocation),
                                                               *neoDevice,
                                                               moduleAllocation,
@@ -878,6 +965,84 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
     }
 }
 
+bool ModuleImp::isLazyIsaUploadAllowed() const {
+    if (NEO::debugManager.flags.EnableLazyIsaUpload.get() != 1) {
+        return false;
+    }
+    if (this->type != ModuleType::user || this->device->getL0Debugger()) {
+        return false;
+    }
+    // ISA reachable from outside of its own kernel (exported functions, instruction symbols, patched segments) is uploaded upfront
+    if (this->exportedFunctionsSurface || !this->isaSegmentsForPatching.empty()) {
+        return false;
+    }
+    if (std::any_of(this->symbols.begin(), this->symbols.end(), [](const auto &symbol) { return symbol.second.symbol.segment == NEO::SegmentType::instructions; })) {
+        return false;
+    }
+    return this->device->getNEODevice()->getDefaultEngine().commandStreamReceiver->isHardwareMode();
+}
+
+void ModuleImp::deferIsaUpload() {
+    std::lock_guard<std::mutex> lock(lazyIsaUploadMutex);
+    for (auto &data : this->kernelImmData) {
+        if (nullptr == data->getIsaGraphicsAllocation() || data->isIsaCopiedToAllocation()) {
+            continue;
+        }
+        lazyIsaUploadStatistics.deferredBytes += static_cast<size_t>(data->getKernelInfo()->heapInfo.kernelHeapSize);
+    }
+    this->isaUploadDeferred = true;
+}
+
+void ModuleImp::uploadDeferredKernelIsa(const KernelImmutableData *kernelImmutableData) {
+    if (false == this->isaUploadDeferred) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(lazyIsaUploadMutex);
+    for (auto &data : this->kernelImmData) {
+        if (data.get() == kernelImmutableData) {
+            this->uploadKernelIsa(*data);
+            return;
+        }
+    }
+}
+
+void ModuleImp::uploadAllDeferredKernelsIsa() {
+    if (false == this->isaUploadDeferred) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(lazyIsaUploadMutex);
+    for (auto &data : this->kernelImmData) {
+        this->uploadKernelIsa(*data);
+    }
+}
+
+void ModuleImp::uploadKernelIsa(KernelImmutableData &kernelImmutableData) {
+    auto isaAllocation = kernelImmutableData.getIsaGraphicsAllocation();
+    if (nullptr == isaAllocation || kernelImmutableData.isIsaCopiedToAllocation()) {
+        return;
+    }
+    auto neoDevice = this->device->getNEODevice();
+    const auto &productHelper = neoDevice->getProductHelper();
+    auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
+
+    std::optional<std::unique_lock<std::mutex>> sharedAllocationLock;
+    if (this->sharedIsaAllocation) {
+        sharedAllocationLock = this->sharedIsaAllocation->obtainSharedAllocationLock();
+    }
+
+    auto kernelHeapPtr = kernelImmutableData.getKernelInfo()->heapInfo.pKernelHeap;
+    auto kernelHeapSize = static_cast<size_t>(kernelImmutableData.getKernelInfo()->heapInfo.kernelHeapSize);
+    auto isaOffset = kernelImmutableData.getIsaParentAllocation() ? kernelImmutableData.getIsaOffsetInParentAllocation() : 0u;
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *isaAllocation),
+                                                          *neoDevice,
+                                                          isaAllocation,
+                                                          isaOffset,
+                                                          kernelHeapPtr,
+                                                          kernelHeapSize);
+    kernelImmutableData.setIsaCopiedToAllocation();
+    lazyIsaUploadStatistics.uploadedBytes += kernelHeapSize;
+}
+
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
                                                                        const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
     if (isaSegmentsForPatching) {
@@ -1073,6 +1238,9 @@ ze_result_t ModuleImp::initializeKernelImmutableData() {
         if (result = this->allocateKernelImmutableData(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+        if (auto maxThreads = getInitializationThreads(); maxThreads > 1u && kernelsCount > kernelInitializationChunkSize) {
+            return this->initializeKernelImmutableDataInParallel(maxThreads);
+        }
         for (size_t i = 0lu; i < kernelsCount; i++) {
             result = kernelImmData[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
                                                   device,
@@ -1089,6 +1257,47 @@ ze_result_t ModuleImp::initializeKernelImmutableData() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeKernelImmutableDataInParallel(uint32_t maxThreads) {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    auto globalConstBuffer = this->translationUnit->globalConstBuffer.get();
+    auto globalVarBuffer = this->translationUnit->globalVarBuffer.get();
+    auto memoryManager = device->getNEODevice()->getMemoryManager();
+
+    // bindless slots of global surfaces are shared by all kernels, so they are allocated before kernels are patched concurrently
+    bool globalConstantsBindless = false;
+    bool globalVariablesBindless = false;
+    for (const auto kernelInfo : kernelInfos) {
+        const auto &implicitArgs = kernelInfo->kernelDescriptor.payloadMappings.implicitArgs;
+        globalConstantsBindless |= NEO::isValidOffset(implicitArgs.globalConstantsSurfaceAddress.bindless);
+        globalVariablesBindless |= NEO::isValidOffset(implicitArgs.globalVariablesSurfaceAddress.bindless);
+    }
+    if (globalConstBuffer && globalConstantsBindless && !memoryManager->allocateBindlessSlot(globalConstBuffer->getGraphicsAllocation())) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    if (globalVarBuffer && globalVariablesBindless && !memoryManager->allocateBindlessSlot(globalVarBuffer->getGraphicsAllocation())) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    std::vector<ze_result_t> results(kernelInfos.size(), ZE_RESULT_SUCCESS);
+    NEO::parallelFor(kernelInfos.size(), maxThreads, kernelInitializationChunkSize, [&](size_t kernelId) {
+        results[kernelId] = kernelImmData[kernelId]->initialize(kernelInfos[kernelId],
+                                                                device,
+                                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                                globalConstBuffer,
+                                                                globalVarBuffer,
+                                                                this->type == ModuleType::builtin);
+    });
+
+    // report the first failing kernel, same as sequential initialization
+    for (size_t kernelId = 0lu; kernelId < results.size(); kernelId++) {
+        if (results[kernelId] != ZE_RESULT_SUCCESS) {
+            kernelImmData[kernelId].reset();
+            return results[kernelId];
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableData(size_t kernelsCount) {
     if (this->kernelImmData.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -1195,6 +1404,15 @@ uint32_t ModuleImp::getMaxGroupSize(const NEO::KernelDescriptor &kernelDescripto
 }
 
 void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOptions, std::string &internalBuildOptions) {
+    BuildFlagsState buildFlagsState{this->profileFlags, this->isFunctionSymbolExportEnabled, this->isGlobalSymbolExportEnabled};
+    createBuildOptions(*device, pBuildFlags, this->forceBindfulForMsaaImages, apiOptions, internalBuildOptions, buildFlagsState);
+    this->profileFlags = buildFlagsState.profileFlags;
+    this->isFunctionSymbolExportEnabled = buildFlagsState.isFunctionSymbolExportEnabled;
+    this->isGlobalSymbolExportEnabled = buildFlagsState.isGlobalSymbolExportEnabled;
+}
+
+void ModuleImp::createBuildOptions(Device &device, const char *pBuildFlags, bool forceBindfulForMsaaImages,
+                                   std::string &apiOptions, std::string &internalBuildOptions, BuildFlagsState &buildFlagsState) {
     if (pBuildFlags != nullptr) {
         std::string buildFlags(pBuildFlags);
 
@@ -1209,15 +1427,15 @@ void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOpti
         NEO::CompilerOptions::applyAdditionalInternalOptions(internalBuildOptions);
 
         moveOptLevelOption(apiOptions, apiOptions);
-        moveProfileFlagsOption(apiOptions, apiOptions);
-        this->isFunctionSymbolExportEnabled = moveBuildOption(apiOptions, apiOptions, BuildOptions::enableLibraryCompile, BuildOptions::enableLibraryCompile);
-        this->isGlobalSymbolExportEnabled = moveBuildOption(apiOptions, apiOptions, BuildOptions::enableGlobalVariableSymbols, BuildOptions::enableGlobalVariableSymbols);
+        moveProfileFlagsOption(apiOptions, apiOptions, buildFlagsState.profileFlags);
+        buildFlagsState.isFunctionSymbolExportEnabled = moveBuildOption(apiOptions, apiOptions, BuildOptions::enableLibraryCompile, BuildOptions::enableLibraryCompile);
+        buildFlagsState.isGlobalSymbolExportEnabled = moveBuildOption(apiOptions, apiOptions, BuildOptions::enableGlobalVariableSymbols, BuildOptions::enableGlobalVariableSymbols);
 
-        if (getDevice()->getNEODevice()->getExecutionEnvironment()->isOneApiPvcWaEnv() == false) {
+        if (device.getNEODevice()->getExecutionEnvironment()->isOneApiPvcWaEnv() == false) {
             NEO::CompilerOptions::concatenateAppend(internalBuildOptions, NEO::CompilerOptions::optDisableSendWarWa);
         }
     }
-    if (NEO::ApiSpecificConfig::getBindlessMode(*device->getNEODevice()) && !this->forceBindfulForMsaaImages) {
+    if (NEO::ApiSpecificConfig::getBindlessMode(*device.getNEODevice()) && !forceBindfulForMsaaImages) {
         NEO::CompilerOptions::concatenateAppend(internalBuildOptions, NEO::CompilerOptions::bindlessMode.str());
     }
 }
@@ -1244,6 +1462,10 @@ bool ModuleImp::moveOptLevelOption(std::string &dstOptionsSet, std::string &srcO
 }
 
 bool ModuleImp::moveProfileFlagsOption(std::string &dstOptionsSet, std::string &srcOptionSet) {
+    return moveProfileFlagsOption(dstOptionsSet, srcOptionSet, this->profileFlags);
+}
+
+bool ModuleImp::moveProfileFlagsOption(std::string &dstOptionsSet, std::string &srcOptionSet, uint32_t &profileFlags) {
     const char optDelim = ' ';
 
     auto optInSrcPos = srcOptionSet.find(BuildOptions::profileFlags.begin());
@@ -1274,7 +1496,11 @@ void ModuleImp::updateBuildLog(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
                                     ze_kernel_handle_t *kernelHandle) {
-    ze_result_t res;
+    ze_result_t res = this->waitForAsyncBuild();
+    if (res != ZE_RESULT_SUCCESS) {
+        return res;
+    }
+
     const auto driverHandle = this->getDevice()->getDriverHandle();
     if (!isFullyLinked) {
         driverHandle->clearErrorDescription();
@@ -1283,6 +1509,7 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
+        this->uploadDeferredKernelIsa(kernel->getImmutableData());
         *kernelHandle = kernel->toHandle();
         if (kernel->getPrintfBufferAllocation() != nullptr) {
             this->printfKernelContainer.push_back(std::shared_ptr<Kernel>(kernel));
@@ -1317,6 +1544,10 @@ ze_result_t ModuleImp::destroyPrintfKernel(ze_kernel_handle_t kernelHandle) {
 }
 
 ze_result_t ModuleImp::getIrBinary(size_t *pSize, uint8_t *pModuleIrBinary) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     auto irBinary = this->translationUnit->irBinary.get();
 
     *pSize = this->translationUnit->irBinarySize;
@@ -1327,6 +1558,10 @@ ze_result_t ModuleImp::getIrBinary(size_t *pSize, uint8_t *pModuleIrBinary) {
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     auto genBinary = this->translationUnit->packedDeviceBinary.get();
 
     *pSize = this->translationUnit->packedDeviceBinarySize;
@@ -1337,6 +1572,10 @@ ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBina
 }
 
 ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     if (translationUnit == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1485,6 +1724,10 @@ bool ModuleImp::linkBinary() {
 }
 
 ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnFunction) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     const auto driverHandle = this->getDevice()->getDriverHandle();
     // Check if the function is in the exported symbol table
     auto symbolIt = symbols.find(pFunctionName);
@@ -1496,6 +1739,8 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     if (*pfnFunction == nullptr) {
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
+            // kernel ISA may be called through the pointer from any kernel of the module
+            this->uploadAllDeferredKernelsIsa();
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
             *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
@@ -1520,6 +1765,10 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
 }
 
 ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize, void **pPtr) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     uint64_t address;
     size_t size;
     const auto driverHandle = this->getDevice()->getDriverHandle();
@@ -1563,7 +1812,12 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
     if (ModulesPackage::isModulesPackageInput(desc)) {
         module = new ModulesPackage(device, moduleBuildLog, type);
     } else {
-        module = new ModuleImp(device, moduleBuildLog, type);
+        auto moduleImp = new ModuleImp(device, moduleBuildLog, type);
+        if (moduleImp->isAsyncBuildAllowed(desc)) {
+            *result = moduleImp->initializeAsync(desc, device->getNEODevice());
+            return moduleImp;
+        }
+        module = moduleImp;
     }
 
     *result = module->initialize(desc, device->getNEODevice());
@@ -1576,6 +1830,10 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     auto &kernelImmData = this->getKernelImmutableDataVector();
     if (*pCount == 0) {
         *pCount = static_cast<uint32_t>(kernelImmData.size());
@@ -1655,6 +1913,10 @@ bool ModuleImp::linkInternalRequiredLibsModule() {
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
+    if (auto buildResult = this->waitForAsyncBuild(); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     pModuleProperties->flags = 0;
 
     if (!unresolvedExternalsInfo.empty()) {
@@ -1675,6 +1937,10 @@ ze_result_t ModuleImp::inspectLinkage(
         }
     }
 
+    if (auto buildResult = waitForAsyncBuilds(numModules, phModules); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     ModuleBuildLog *moduleLinkageLog = nullptr;
     moduleLinkageLog = ModuleBuildLog::create();
     *phLog = moduleLinkageLog->toHandle();
@@ -1752,6 +2018,10 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
         }
     }
 
+    if (auto buildResult = waitForAsyncBuilds(numModules, phModules); buildResult != ZE_RESULT_SUCCESS) {
+        return buildResult;
+    }
+
     std::map<void *, std::map<void *, void *>> dependencies;
     ModuleBuildLog *moduleLinkLog = nullptr;
     const auto driverHandle = this->getDevice()->getDriverHandle();
@@ -1932,6 +2202,7 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 }
 
 ze_result_t ModuleImp::destroy() {
+    this->waitForAsyncBuild();
     notifyModuleDestroy();
 
     auto tempHandle = debugModuleHandle;
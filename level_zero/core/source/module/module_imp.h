@@ -17,7 +17,9 @@
 #include "neo_igfxfmid.h"
 #include "ocl_igc_interface/code_type.h"
 
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <set>
@@ -97,6 +99,7 @@ struct ModuleTranslationUnit {
                                                        const std::vector<uint32_t> &inputLlvmBcSizes);
     bool processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize);
     std::string generateCompilerOptions(const char *buildOptions, const char *internalBuildOptions);
+    static std::string generateInternalCompilerOptions(L0::Device &device, const char *internalBuildOptions);
     MOCKABLE_VIRTUAL ze_result_t compileGenBinary(NEO::TranslationInput &inputArgs, CompilationMode compilationMode);
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
@@ -182,10 +185,19 @@ struct ModuleImp : public Module {
 
     uint32_t getMaxGroupSize(const NEO::KernelDescriptor &kernelDescriptor) const override;
 
+    struct BuildFlagsState {
+        uint32_t profileFlags = 0;
+        bool isFunctionSymbolExportEnabled = false;
+        bool isGlobalSymbolExportEnabled = false;
+    };
+    // computes the options without a module, e.g. for built-ins looked up in the persistent binary cache
+    static void createBuildOptions(Device &device, const char *pBuildFlags, bool forceBindfulForMsaaImages,
+                                   std::string &buildOptions, std::string &internalBuildOptions, BuildFlagsState &buildFlagsState);
     void createBuildOptions(const char *pBuildFlags, std::string &buildOptions, std::string &internalBuildOptions);
     bool usesMsaaImage() const;
     bool verifyBuildOptions(std::string buildOptions) const;
-    bool moveOptLevelOption(std::string &dstOptionsSet, std::string &srcOptionSet);
+    static bool moveOptLevelOption(std::string &dstOptionsSet, std::string &srcOptionSet);
+    static bool moveProfileFlagsOption(std::string &dstOptionsSet, std::string &srcOptionSet, uint32_t &profileFlags);
     bool moveProfileFlagsOption(std::string &dstOptionsSet, std::string &srcOptionSet);
     MOCKABLE_VIRTUAL void updateBuildLog(NEO::Device *neoDevice);
 
@@ -194,6 +206,10 @@ struct ModuleImp : public Module {
     MOCKABLE_VIRTUAL bool linkBinary();
 
     ze_result_t initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) override;
+    bool isAsyncBuildAllowed(const ze_module_desc_t *desc) const;
+    ze_result_t initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    ze_result_t waitForAsyncBuild() const;
+    static ze_result_t waitForAsyncBuilds(uint32_t numModules, ze_module_handle_t *phModules);
 
     bool isSPIRv() { return builtFromSpirv; }
 
@@ -229,6 +245,18 @@ struct ModuleImp : public Module {
         return false;
     }
 
+    static uint32_t getInitializationThreads();
+    static constexpr size_t kernelInitializationChunkSize = 16u;
+
+    struct LazyIsaUploadStatistics {
+        size_t deferredBytes = 0u;
+        size_t uploadedBytes = 0u;
+    };
+    LazyIsaUploadStatistics getLazyIsaUploadStatistics() {
+        std::lock_guard<std::mutex> lock(lazyIsaUploadMutex);
+        return lazyIsaUploadStatistics;
+    }
+
   protected:
     FORCE_NOINLINE void dumpKernelInfoToAubComments();
     MOCKABLE_VIRTUAL ze_result_t initializeTranslationUnit(const ze_module_desc_t *desc, NEO::Device *neoDevice);
@@ -236,6 +264,7 @@ struct ModuleImp : public Module {
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableData(size_t kernelsCount);
     ze_result_t initializeKernelImmutableData();
+    ze_result_t initializeKernelImmutableDataInParallel(uint32_t maxThreads);
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -246,6 +275,11 @@ struct ModuleImp : public Module {
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    bool isLazyIsaUploadAllowed() const;
+    void deferIsaUpload();
+    void uploadDeferredKernelIsa(const KernelImmutableData *kernelImmutableData);
+    void uploadAllDeferredKernelsIsa();
+    void uploadKernelIsa(KernelImmutableData &kernelImmutableData);
     MOCKABLE_VIRTUAL bool linkInternalRequiredLibsModule();
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -291,6 +325,14 @@ struct ModuleImp : public Module {
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
 
+    std::mutex lazyIsaUploadMutex;
+    LazyIsaUploadStatistics lazyIsaUploadStatistics;
+    bool isaUploadDeferred = false;
+
+    std::vector<char> asyncBuildInput;
+    std::string asyncBuildFlags;
+    std::shared_future<ze_result_t> asyncBuildResult;
+
     std::unique_ptr<NEO::MetadataGeneration> metadataGeneration;
 };
 
@@ -108,22 +108,11 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromData(const uint8_t *pRaw
     uint64_t ip = 0ULL;
     memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
     ip &= ipSamplingIpMaskXe;
-    StallSumIpData_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpData_t{};
-        stallSumData->activeCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
+    auto &stallSumIpDataEntry = stallSumIpDataMap[ip];
+    if (stallSumIpDataEntry == nullptr) {
+        stallSumIpDataEntry = new StallSumIpData_t{};
     }
+    StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataEntry);
     tempAddr += ipStallSamplingOffset;
 
     auto getCount = [&tempAddr]() {
@@ -164,12 +153,13 @@ void L0GfxCoreHelperHw<Family>::stallIpDataMapUpdateFromMap(std::map<uint64_t, v
     for (auto &entry : sourceMap) {
         uint64_t ip = entry.first;
         StallSumIpData_t *sourceData = reinterpret_cast<StallSumIpData_t *>(entry.second);
-        if (stallSumIpDataMap.count(ip) == 0) {
+        auto [destEntry, inserted] = stallSumIpDataMap.try_emplace(ip, nullptr);
+        if (inserted) {
             StallSumIpData_t *newData = new StallSumIpData_t{};
             memcpy_s(newData, sizeof(StallSumIpData_t), sourceData, sizeof(StallSumIpData_t));
-            stallSumIpDataMap[ip] = newData;
+            destEntry->second = newData;
         } else {
-            StallSumIpData_t *destData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
+            StallSumIpData_t *destData = reinterpret_cast<StallSumIpData_t *>(destEntry->second);
             destData->activeCount += sourceData->activeCount;
             destData->otherCount += sourceData->otherCount;
             destData->controlCount += sourceData->controlCount;
@@ -243,6 +243,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::doubleSbaWa;
     using BaseClass::dummyBlitWa;
     using BaseClass::duplicatedInOrderCounterStorageEnabled;
+    using BaseClass::dynamicHeapRequired;
     using BaseClass::engineGroupType;
     using BaseClass::estimateCommandSizeForImageCopyBlit;
     using BaseClass::eventSignalPipeControl;
@@ -431,6 +432,14 @@ struct Mock<CommandList> : public CommandList {
                       uint32_t numWaitEvents,
                       ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch));
 
+    ADDMETHOD_NOBASE(appendLaunchKernels, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t numKernels,
+                      const ze_kernel_handle_t *kernelHandles,
+                      const ze_group_count_t *pGroupCounts,
+                      ze_event_handle_t *phSignalEvents,
+                      uint32_t numWaitEvents,
+                      ze_event_handle_t *phWaitEvents));
+
     ADDMETHOD_NOBASE(appendLaunchKernelWithArguments, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_kernel_handle_t hKernel,
                       const ze_group_count_t groupCounts,
@@ -84,6 +84,7 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::isFullyLinked;
     using BaseClass::isFunctionSymbolExportEnabled;
     using BaseClass::isGlobalSymbolExportEnabled;
+    using BaseClass::isLazyIsaUploadAllowed;
     using BaseClass::isLlvmBitcode;
     using BaseClass::kernelImmData;
     using BaseClass::linkInternalRequiredLibsModule;
@@ -157,6 +158,7 @@ struct MockModule : public L0::ModuleImp {
     using ModuleImp::populateHostGlobalSymbolsMap;
     using ModuleImp::setIsaGraphicsAllocations;
     using ModuleImp::symbols;
+    using ModuleImp::transferIsaSegmentsToAllocation;
     using ModuleImp::translationUnit;
 
     MockModule(L0::Device *device,
@@ -13,8 +13,11 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
+#include "shared/test/common/mocks/mock_builtins.h"
 #include "shared/test/common/mocks/mock_builtinslib.h"
+#include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
@@ -442,6 +445,143 @@ HWTEST_F(BuiltInTestsL0, givenOneApiPvcSendWarWaEnvFalseWhenGettingBuiltinThenIn
     EXPECT_EQ(ZE_MODULE_FORMAT_IL_SPIRV, testDevice.formatForModule);
 }
 
+struct BuiltInKernelLibImplWithBuildOptions : BuiltInKernelLibImpl {
+    using BuiltInKernelLibImpl::BuiltInKernelLibImpl;
+
+    void getBuiltinBuildOptions(std::string &apiOptions, std::string &internalOptions) override {
+        getBuiltinBuildOptionsCalled++;
+        apiOptions = builtinApiOptions;
+        internalOptions = builtinInternalOptions;
+    }
+
+    static constexpr const char *builtinApiOptions = "-builtin-api-options";
+    static constexpr const char *builtinInternalOptions = "-builtin-internal-options";
+    uint32_t getBuiltinBuildOptionsCalled = 0u;
+};
+
+struct BuiltInBinaryCacheTestsL0 : BuiltInTestsL0 {
+    void SetUp() override {
+        BuiltInTestsL0::SetUp();
+        pDevice->getExecutionEnvironment()->setOneApiPvcWaEnv(true);
+
+        auto mockCompilerInterface = new NEO::MockCompilerInterface();
+        mockCompilerInterface->compilerIdentityHashOverride = 0x1234u;
+        pDevice->getRootDeviceEnvironmentRef().compilerInterface.reset(mockCompilerInterface);
+
+        builtIns = new NEO::MockBuiltins;
+        resourceLoader = new MockBuiltInResourceLoaderWithBinaryCache;
+        builtIns->builtinsLib.reset(resourceLoader);
+        MockRootDeviceEnvironment::resetBuiltins(&pDevice->getRootDeviceEnvironmentRef(), builtIns);
+    }
+
+    void storeCachedBinaries(const NEO::BuiltIn::AddressingMode &mode) {
+        const char binary[] = "cached device binary";
+        const std::string apiOptions = BuiltInKernelLibImplWithBuildOptions::builtinApiOptions;
+        const std::string internalOptions = BuiltInKernelLibImplWithBuildOptions::builtinInternalOptions;
+        for (uint32_t kernel = 0; kernel < static_cast<uint32_t>(NEO::BuiltIn::BaseKernel::count); kernel++) {
+            auto entryName = resourceLoader->getBinaryCacheEntryName(mode.toString() + NEO::BuiltIn::getAsString(static_cast<NEO::BuiltIn::BaseKernel>(kernel)),
+                                                                     *pDevice, apiOptions, internalOptions);
+            ASSERT_FALSE(entryName.empty());
+            resourceLoader->binaryCacheMock->entries[entryName].assign(binary, binary + sizeof(binary));
+        }
+    }
+
+    NEO::MockBuiltins *builtIns = nullptr;
+    MockBuiltInResourceLoaderWithBinaryCache *resourceLoader = nullptr;
+};
+
+HWTEST_F(BuiltInBinaryCacheTestsL0, givenBuiltinBinariesInPersistentCacheWhenInitializingFunctionsThenNativeFormatIsUsedAndNothingIsStored) {
+    auto mode = getDefaultBuiltInMode();
+    storeCachedBinaries(mode);
+
+    pDevice->incRefInternal();
+    MockDeviceForBuiltinTests testDevice(pDevice);
+    testDevice.builtins.reset(new BuiltInKernelLibImplWithBuildOptions(&testDevice, builtIns));
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(BufferBuiltIn::count); builtId++) {
+        testDevice.formatForModule = {};
+        testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(static_cast<BufferBuiltIn>(builtId), mode);
+        EXPECT_EQ(ZE_MODULE_FORMAT_NATIVE, testDevice.formatForModule);
+    }
+
+    EXPECT_NE(0u, resourceLoader->binaryCacheMock->loadCalled);
+    EXPECT_EQ(0u, resourceLoader->binaryCacheMock->storeCalled);
+}
+
+HWTEST_F(BuiltInBinaryCacheTestsL0, givenRebuildPrecompiledKernelsOrOneApiPvcWaEnvNotSetWhenInitializingFunctionsThenPersistentCacheIsNotUsed) {
+    auto mode = getDefaultBuiltInMode();
+    storeCachedBinaries(mode);
+
+    {
+        DebugManagerStateRestore dbgRestorer;
+        NEO::debugManager.flags.RebuildPrecompiledKernels.set(true);
+        pDevice->incRefInternal();
+        MockDeviceForBuiltinTests testDevice(pDevice);
+        auto builtinLib = new BuiltInKernelLibImplWithBuildOptions(&testDevice, builtIns);
+        testDevice.builtins.reset(builtinLib);
+        for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(BufferBuiltIn::count); builtId++) {
+            testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(static_cast<BufferBuiltIn>(builtId), mode);
+            EXPECT_EQ(ZE_MODULE_FORMAT_IL_SPIRV, testDevice.formatForModule);
+        }
+        EXPECT_EQ(0u, builtinLib->getBuiltinBuildOptionsCalled);
+    }
+    {
+        pDevice->getExecutionEnvironment()->setOneApiPvcWaEnv(false);
+        pDevice->incRefInternal();
+        MockDeviceForBuiltinTests testDevice(pDevice);
+        auto builtinLib = new BuiltInKernelLibImplWithBuildOptions(&testDevice, builtIns);
+        testDevice.builtins.reset(builtinLib);
+        for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(BufferBuiltIn::count); builtId++) {
+            testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(static_cast<BufferBuiltIn>(builtId), mode);
+            EXPECT_EQ(ZE_MODULE_FORMAT_IL_SPIRV, testDevice.formatForModule);
+        }
+        EXPECT_EQ(0u, builtinLib->getBuiltinBuildOptionsCalled);
+    }
+
+    EXPECT_EQ(0u, resourceLoader->binaryCacheMock->loadCalled);
+    EXPECT_EQ(0u, resourceLoader->binaryCacheMock->storeCalled);
+}
+
+HWTEST_F(BuiltInBinaryCacheTestsL0, givenModuleAlreadyCreatedWhenLoadingAnotherKernelFromItThenPersistentCacheIsNotQueriedAgain) {
+    auto mode = getDefaultBuiltInMode();
+    storeCachedBinaries(mode);
+
+    pDevice->incRefInternal();
+    MockDeviceForBuiltinTests testDevice(pDevice);
+    auto builtinLib = new BuiltInKernelLibImplWithBuildOptions(&testDevice, builtIns);
+    testDevice.builtins.reset(builtinLib);
+
+    auto firstKernel = builtinLib->loadBuiltIn(NEO::BuiltIn::BaseKernel::copyBufferToBuffer, mode, "CopyBufferToBufferBytes");
+    ASSERT_NE(nullptr, firstKernel);
+    EXPECT_EQ(1u, resourceLoader->binaryCacheMock->loadCalled);
+
+    auto secondKernel = builtinLib->loadBuiltIn(NEO::BuiltIn::BaseKernel::copyBufferToBuffer, mode, "CopyBufferToBufferMiddleRegion");
+    ASSERT_NE(nullptr, secondKernel);
+    EXPECT_EQ(firstKernel->module, secondKernel->module);
+    EXPECT_EQ(1u, resourceLoader->binaryCacheMock->loadCalled);
+    EXPECT_EQ(1u, builtinLib->getBuiltinBuildOptionsCalled);
+}
+
+struct BuiltInKernelLibImplWithBaseBuildOptions : BuiltInKernelLibImpl {
+    using BuiltInKernelLibImpl::BuiltInKernelLibImpl;
+    using BuiltInKernelLibImpl::getBuiltinBuildOptions;
+};
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinBuildOptionsWhenComparedWithBuiltinModuleBuildOptionsThenTheyAreEqual) {
+    BuiltInKernelLibImplWithBaseBuildOptions lib(device, device->getNEODevice()->getBuiltIns());
+    std::string apiOptions;
+    std::string internalOptions;
+    lib.getBuiltinBuildOptions(apiOptions, internalOptions);
+
+    ModuleImp module(device, nullptr, ModuleType::builtin);
+    std::string moduleBuildOptions;
+    std::string moduleInternalBuildOptions;
+    module.createBuildOptions("", moduleBuildOptions, moduleInternalBuildOptions);
+    auto moduleInternalOptions = module.getTranslationUnit()->generateCompilerOptions(moduleBuildOptions.c_str(), moduleInternalBuildOptions.c_str());
+
+    EXPECT_EQ(module.getTranslationUnit()->options, apiOptions);
+    EXPECT_EQ(moduleInternalOptions, internalOptions);
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenWideStatelessBindlessImageBuiltInsWhenInitBuiltinKernelThenCorrectArgumentsArePassed) {
     MockCheckPassedArgumentsBuiltInKernelLibImpl lib(device, device->getNEODevice()->getBuiltIns());
 
@@ -1210,6 +1210,56 @@ TEST_F(CommandListMemAdvisePageFault, givenValidDeviceMemPtrAndPageFaultHandlerA
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListMemAdvisePageFault, givenChunkedAllocInsertedBeforeMemAdviseWhenCpuTouchesItThenHintsHandlerBlocksCpuMigration) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    size_t size = MemoryConstants::megaByte;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto res = context->allocDeviceMem(device->toHandle(),
+                                       &deviceDesc,
+                                       size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    L0::Device *l0Device = L0::Device::fromHandle(device);
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    mockPageFaultManager->insertAllocation(ptr, size, svmAllocsManager, l0Device, {});
+    EXPECT_NE(0u, mockPageFaultManager->memoryData.at(ptr).chunkSize);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    res = commandList->executeMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_READ_MOSTLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = commandList->executeMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(reinterpret_cast<void *>(L0::transferAndUnprotectMemoryWithHints), reinterpret_cast<void *>(mockPageFaultManager->gpuDomainHandler));
+
+    mockPageFaultManager->moveAllocationToGpuDomain(ptr);
+    mockPageFaultManager->chunksTransferredToCpu.clear();
+    EXPECT_TRUE(mockPageFaultManager->verifyAndHandlePageFault(ptr, true));
+
+    auto allocData = svmAllocsManager->getSVMAlloc(ptr);
+    auto flags = l0Device->memAdviseSharedAllocations[allocData];
+    EXPECT_EQ(1, flags.cpuMigrationBlocked);
+    EXPECT_EQ(0, mockPageFaultManager->transferToCpuCalled);
+    EXPECT_TRUE(mockPageFaultManager->chunksTransferredToCpu.empty());
+
+    auto &faultData = mockPageFaultManager->memoryData.at(ptr);
+    EXPECT_EQ(0u, faultData.chunkSize);
+    EXPECT_EQ(NEO::CpuPageFaultManager::AllocationDomain::gpu, faultData.domain);
+    EXPECT_EQ(ptr, mockPageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(size, mockPageFaultManager->accessAllowedSize);
+
+    mockPageFaultManager->removeAllocation(ptr);
+    res = context->freeMem(ptr);
+    ASSERT_EQ(res, ZE_RESULT_SUCCESS);
+}
+
 TEST_F(CommandListMemAdvisePageFault, givenInvalidDeviceMemPtrAndPageFaultHandlerAndGpuDomainHandlerWithHintsSetThenHandlerAllowsCpuMigration) {
     size_t size = 10;
     size_t alignment = 1u;
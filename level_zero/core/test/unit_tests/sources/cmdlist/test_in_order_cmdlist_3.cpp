@@ -10,6 +10,7 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/internal/l0_cmdlist.h"
 #include "level_zero/api/internal/l0_event.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_cmdlist_execution_internal_options.h"
 #include "level_zero/core/test/unit_tests/fixtures/in_order_cmd_list_fixture.h"
@@ -1895,5 +1896,78 @@ HWCMDTEST_F(IGFX_XE_HP_CORE,
     zeEventDestroy(handle);
 }
 
+HWTEST_F(InOrderCmdListTests, givenImmCmdListWhenAppendingMultipleKernelsAtOnceThenSingleFlushIsSubmittedAndEachEventGetsItsOwnCounterValue) {
+    auto immCmdList = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(immCmdList->getCsr(false));
+
+    kernel->privateState.surfaceStateHeapData.clear();
+    immCmdList->dynamicHeapRequired = false;
+
+    constexpr uint32_t numKernels = 3;
+    auto eventPool = createEvents<FamilyType>(numKernels, false);
+
+    ze_kernel_handle_t kernelHandles[numKernels] = {kernel->toHandle(), kernel->toHandle(), kernel->toHandle()};
+    ze_group_count_t groupCounts[numKernels] = {groupCount, groupCount, groupCount};
+    ze_event_handle_t signalEvents[numKernels] = {events[0]->toHandle(), events[1]->toHandle(), events[2]->toHandle()};
+
+    auto taskCountBefore = ultCsr->taskCount.load();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernels(numKernels, kernelHandles, groupCounts, signalEvents, 0, nullptr));
+
+    EXPECT_EQ(taskCountBefore + 1, ultCsr->taskCount.load());
+    EXPECT_EQ(3u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    for (uint32_t i = 0; i < numKernels; i++) {
+        EXPECT_EQ(i + 1, events[i]->getInOrderExecBaseSignalValue());
+        EXPECT_EQ(ultCsr, events[i]->csrs[0]);
+    }
+}
+
+HWTEST_F(InOrderCmdListTests, givenImmCmdListWhenAppendingMoreKernelsThanFitIntoSingleFlushThenKernelsAreSubmittedInChunks) {
+    auto immCmdList = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(immCmdList->getCsr(false));
+
+    kernel->privateState.surfaceStateHeapData.clear();
+    immCmdList->dynamicHeapRequired = false;
+
+    constexpr uint32_t numKernels = maxKernelsPerImmediateFlush + 1;
+    std::vector<ze_kernel_handle_t> kernelHandles(numKernels, kernel->toHandle());
+    std::vector<ze_group_count_t> groupCounts(numKernels, groupCount);
+
+    auto taskCountBefore = ultCsr->taskCount.load();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernels(numKernels, kernelHandles.data(), groupCounts.data(), nullptr, 0, nullptr));
+
+    EXPECT_EQ(taskCountBefore + 2, ultCsr->taskCount.load());
+    EXPECT_EQ(static_cast<uint64_t>(numKernels), immCmdList->inOrderExecInfo->getCounterValue());
+}
+
+HWTEST_F(InOrderCmdListTests, givenRegularCmdListWhenAppendingMultipleKernelsAtOnceThenEachKernelIsAppended) {
+    auto regularCmdList = createRegularCmdList<FamilyType::gfxCoreFamily>(false);
+
+    ze_kernel_handle_t kernelHandles[2] = {kernel->toHandle(), kernel->toHandle()};
+    ze_group_count_t groupCounts[2] = {groupCount, groupCount};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCmdList->appendLaunchKernels(2, kernelHandles, groupCounts, nullptr, 0, nullptr));
+
+    EXPECT_EQ(2u, regularCmdList->inOrderExecInfo->getCounterValue());
+}
+
+HWTEST_F(InOrderCmdListTests, givenInvalidArgumentsWhenAppendingMultipleKernelsThroughExtensionThenErrorIsReturned) {
+    auto immCmdList = createImmCmdList<FamilyType::gfxCoreFamily>();
+
+    ze_kernel_handle_t kernelHandles[2] = {kernel->toHandle(), nullptr};
+    ze_group_count_t groupCounts[2] = {groupCount, groupCount};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, L0::zexCommandListAppendLaunchKernels(nullptr, 1, kernelHandles, groupCounts, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexCommandListAppendLaunchKernels(immCmdList->toHandle(), 0, nullptr, nullptr, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, L0::zexCommandListAppendLaunchKernels(immCmdList->toHandle(), 1, nullptr, groupCounts, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, L0::zexCommandListAppendLaunchKernels(immCmdList->toHandle(), 1, kernelHandles, nullptr, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, L0::zexCommandListAppendLaunchKernels(immCmdList->toHandle(), 1, kernelHandles, groupCounts, nullptr, 1, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, L0::zexCommandListAppendLaunchKernels(immCmdList->toHandle(), 2, kernelHandles, groupCounts, nullptr, 0, nullptr));
+
+    EXPECT_EQ(0u, immCmdList->inOrderExecInfo->getCounterValue());
+}
+
 } // namespace ult
 } // namespace L0
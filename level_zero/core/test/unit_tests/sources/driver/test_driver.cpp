@@ -1480,6 +1480,7 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     using pfnCommandListAppendMIStoreRegMem = decltype(&zexCommandListAppendMIStoreRegMem);
     using pfnCommandListAppendMIMath = decltype(&zexCommandListAppendMIMath);
     using pfnCommandListVerifyMemory = decltype(&zexCommandListVerifyMemory);
+    using pfnCommandListAppendLaunchKernels = decltype(&zexCommandListAppendLaunchKernels);
 
     // graph API function types
     using pfnGraphCreateExp = decltype(&zeGraphCreateExp);
@@ -1573,6 +1574,7 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     pfnCommandListAppendMemoryFillWithParameters expectedCommandListAppendMemoryFillWithParameters = L0::zexCommandListAppendMemoryFillWithParameters;
     pfnCommandListSetCleanupCallback expectedCommandListSetCleanupCallback = L0::zexCommandListSetCleanupCallback;
     pfnCommandListVerifyMemory expectedCommandListVerifyMemory = L0::zexCommandListVerifyMemory;
+    pfnCommandListAppendLaunchKernels expectedCommandListAppendLaunchKernels = L0::zexCommandListAppendLaunchKernels;
     pfnCommandListVisitExt expectedCommandListVisitExt = L0::zeCommandListVisitExt;
     pfnCommandListGetDeviceHandle expectedCommandListGetDeviceHandle = L0::zeCommandListGetDeviceHandle;
     pfnCommandListGetContextHandle expectedCommandListGetContextHandle = L0::zeCommandListGetContextHandle;
@@ -1781,6 +1783,9 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListVerifyMemory", &funPtr));
     EXPECT_EQ(expectedCommandListVerifyMemory, reinterpret_cast<pfnCommandListVerifyMemory>(funPtr));
 
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListAppendLaunchKernels", &funPtr));
+    EXPECT_EQ(expectedCommandListAppendLaunchKernels, reinterpret_cast<pfnCommandListAppendLaunchKernels>(funPtr));
+
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zeCommandListVisitExt", &funPtr));
     EXPECT_EQ(expectedCommandListVisitExt, reinterpret_cast<pfnCommandListVisitExt>(funPtr));
 
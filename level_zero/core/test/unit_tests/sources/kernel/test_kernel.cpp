@@ -2427,6 +2427,22 @@ TEST_F(KernelLocalIdsTest, WhenKernelIsCreatedThenDefaultLocalIdGenerationbyRunt
     EXPECT_TRUE(kernel->requiresGenerationOfLocalIdsByRuntime());
 }
 
+using KernelDispatchTemplateCacheTest = Test<ModuleFixture>;
+
+TEST_F(KernelDispatchTemplateCacheTest, givenDefaultDebugFlagsWhenKernelIsCreatedThenDispatchTemplateCacheIsNotAvailable) {
+    createKernel();
+
+    EXPECT_EQ(nullptr, kernel->getDispatchTemplateCache());
+}
+
+TEST_F(KernelDispatchTemplateCacheTest, givenEnableDispatchTemplateCacheWhenKernelIsCreatedThenDispatchTemplateCacheIsAvailable) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDispatchTemplateCache.set(1);
+    createKernel();
+
+    EXPECT_NE(nullptr, kernel->getDispatchTemplateCache());
+}
+
 struct KernelIsaFixture : ModuleFixture {
     void setUp() {
         ModuleFixture::setUp(true);
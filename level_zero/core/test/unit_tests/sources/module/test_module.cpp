@@ -5724,6 +5724,242 @@ TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenMultipleKernelIsasWhenKernel
     this->givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched();
 }
 
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenParallelModuleInitializationWhenManyKernelImmutableDatasAreInitializedThenEachUsesItsOwnKernelInfo) {
+    debugManager.flags.ParallelModuleInitializationThreads.set(4);
+    constexpr size_t kernelsCount = 64u;
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeKernelImmutableData());
+
+    auto &kernelInfos = this->mockModule->translationUnit->programInfo.kernelInfos;
+    auto &kernelImmData = this->mockModule->getKernelImmutableDataVector();
+    ASSERT_EQ(kernelsCount, kernelImmData.size());
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        ASSERT_NE(nullptr, kernelImmData[i].get());
+        EXPECT_EQ(kernelInfos[i], kernelImmData[i]->getKernelInfo());
+        EXPECT_EQ(&kernelInfos[i]->kernelDescriptor, &kernelImmData[i]->getDescriptor());
+    }
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenParallelModuleInitializationWhenSomeKernelInitializationsFailThenFirstFailingKernelIsReportedAndCleaned) {
+    debugManager.flags.ParallelModuleInitializationThreads.set(4);
+    constexpr size_t kernelsCount = 64u;
+    auto &kernelImmData = this->mockModule->getKernelImmutableDataVectorRef();
+    kernelImmData.reserve(kernelsCount);
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+        kernelImmData.emplace_back(new ProxyKernelImmutableData(this->device));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->setIsaGraphicsAllocations());
+
+    static_cast<ProxyKernelImmutableData *>(kernelImmData[50].get())->initializeCallBase = false;
+    static_cast<ProxyKernelImmutableData *>(kernelImmData[20].get())->initializeCallBase = false;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, this->mockModule->initializeKernelImmutableData());
+    EXPECT_EQ(nullptr, kernelImmData[20].get());
+    ASSERT_NE(nullptr, kernelImmData[50].get());
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        if (i != 20u) {
+            EXPECT_EQ(1u, static_cast<ProxyKernelImmutableData *>(kernelImmData[i].get())->initializeCalled) << i;
+        }
+    }
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenParallelModuleInitializationWhenIsaIsTransferredToSharedAllocationThenEveryKernelIsaIsCopiedToItsOffset) {
+    debugManager.flags.ParallelModuleInitializationThreads.set(4);
+    constexpr size_t kernelsCount = 64u;
+    constexpr size_t isaSize = 0x40;
+    std::vector<std::vector<uint8_t>> isas(kernelsCount);
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        isas[i].assign(isaSize, static_cast<uint8_t>(i + 1));
+        this->prepareKernelInfoAndAddToTranslationUnit(isaSize);
+        this->mockModule->translationUnit->programInfo.kernelInfos[i]->heapInfo.pKernelHeap = isas[i].data();
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeKernelImmutableData());
+
+    auto &kernelImmData = this->mockModule->getKernelImmutableDataVector();
+    auto moduleAllocation = kernelImmData[0]->getIsaParentAllocation();
+    ASSERT_NE(nullptr, moduleAllocation);
+
+    this->mockModule->transferIsaSegmentsToAllocation(this->neoDevice, nullptr);
+
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        EXPECT_EQ(moduleAllocation, kernelImmData[i]->getIsaParentAllocation());
+        EXPECT_TRUE(kernelImmData[i]->isIsaCopiedToAllocation());
+        auto isaInAllocation = ptrOffset(moduleAllocation->getUnderlyingBuffer(), kernelImmData[i]->getIsaOffsetInParentAllocation());
+        EXPECT_EQ(0, memcmp(isaInAllocation, isas[i].data(), isaSize)) << i;
+    }
+}
+
+using ModuleLazyIsaUploadTest = Test<ModuleFixture>;
+
+TEST_F(ModuleLazyIsaUploadTest, givenLazyIsaUploadDisabledWhenModuleIsCreatedThenIsaOfAllKernelsIsUploaded) {
+    module.reset();
+    createModuleFromMockBinary();
+
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+    for (auto &data : module->getKernelImmutableDataVector()) {
+        EXPECT_TRUE(data->isIsaCopiedToAllocation());
+    }
+    EXPECT_EQ(0u, module->getLazyIsaUploadStatistics().deferredBytes);
+}
+
+TEST_F(ModuleLazyIsaUploadTest, givenLazyIsaUploadEnabledWhenKernelsAreCreatedThenIsaIsUploadedOnlyOnceForCreatedKernels) {
+    debugManager.flags.EnableLazyIsaUpload.set(1);
+    module.reset();
+    createModuleFromMockBinary();
+
+    auto &kernelImmDatas = module->getKernelImmutableDataVector();
+    ASSERT_LT(1u, kernelImmDatas.size());
+    size_t deferredBytes = 0u;
+    for (auto &data : kernelImmDatas) {
+        EXPECT_FALSE(data->isIsaCopiedToAllocation());
+        deferredBytes += data->getKernelInfo()->heapInfo.kernelHeapSize;
+    }
+    EXPECT_NE(0u, deferredBytes);
+    EXPECT_EQ(deferredBytes, module->getLazyIsaUploadStatistics().deferredBytes);
+    EXPECT_EQ(0u, module->getLazyIsaUploadStatistics().uploadedBytes);
+
+    ze_kernel_desc_t desc = {};
+    desc.pKernelName = kernelName.c_str();
+    for (uint32_t i = 0; i < 2; i++) {
+        ze_kernel_handle_t kernelHandle = nullptr;
+        ASSERT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&desc, &kernelHandle));
+        auto createdKernel = Kernel::fromHandle(kernelHandle);
+        auto createdKernelImmData = createdKernel->getImmutableData();
+        EXPECT_TRUE(createdKernelImmData->isIsaCopiedToAllocation());
+        EXPECT_EQ(createdKernelImmData->getKernelInfo()->heapInfo.kernelHeapSize, module->getLazyIsaUploadStatistics().uploadedBytes);
+        for (auto &data : kernelImmDatas) {
+            if (data.get() != createdKernelImmData) {
+                EXPECT_FALSE(data->isIsaCopiedToAllocation());
+            }
+        }
+        createdKernel->destroy();
+    }
+}
+
+TEST_F(ModuleLazyIsaUploadTest, givenLazyIsaUploadEnabledWhenFunctionPointerOfKernelIsQueriedThenIsaOfAllKernelsIsUploaded) {
+    debugManager.flags.EnableLazyIsaUpload.set(1);
+    module.reset();
+    createModuleFromMockBinary();
+
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getFunctionPointer(kernelName.c_str(), &functionPointer));
+    EXPECT_NE(nullptr, functionPointer);
+    for (auto &data : module->getKernelImmutableDataVector()) {
+        EXPECT_TRUE(data->isIsaCopiedToAllocation());
+    }
+    auto statistics = module->getLazyIsaUploadStatistics();
+    EXPECT_NE(0u, statistics.deferredBytes);
+    EXPECT_EQ(statistics.deferredBytes, statistics.uploadedBytes);
+}
+
+TEST_F(ModuleLazyIsaUploadTest, givenLazyIsaUploadEnabledWhenIsaIsReachableFromOutsideOfItsKernelOrModuleIsBuiltinThenLazyUploadIsNotAllowed) {
+    debugManager.flags.EnableLazyIsaUpload.set(1);
+    module.reset();
+    createModuleFromMockBinary();
+    EXPECT_TRUE(module->isLazyIsaUploadAllowed());
+
+    module->symbols["function"].symbol.segment = NEO::SegmentType::instructions;
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+    module->symbols.clear();
+
+    MockGraphicsAllocation exportedFunctions;
+    module->exportedFunctionsSurface = &exportedFunctions;
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+    module->exportedFunctionsSurface = nullptr;
+
+    module->isaSegmentsForPatching.push_back({});
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+    module->isaSegmentsForPatching.clear();
+
+    module->type = ModuleType::builtin;
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+    module->type = ModuleType::user;
+
+    debugManager.flags.EnableLazyIsaUpload.set(0);
+    EXPECT_FALSE(module->isLazyIsaUploadAllowed());
+}
+
+using ModuleAsyncBuildTest = Test<DeviceFixture>;
+
+TEST_F(ModuleAsyncBuildTest, givenAsyncModuleBuildEnabledWhenSpirvModuleIsCreatedThenBuildResultIsAvailableAtFirstKernelCreation) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AsyncModuleBuildThreads.set(2);
+    MockZebinWrapper zebin{*NEO::defaultHwInfo};
+    zebin.setAsMockCompilerReturnedBinary();
+
+    uint8_t binary[10]{};
+    std::string buildFlags = "-ze-opt-disable";
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = sizeof(binary);
+    moduleDesc.pBuildFlags = buildFlags.c_str();
+
+    ze_module_handle_t moduleHandle = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, device->createModule(&moduleDesc, &moduleHandle, nullptr, ModuleType::user));
+    ASSERT_NE(nullptr, moduleHandle);
+    buildFlags.clear();
+    memset(binary, 0xff, sizeof(binary));
+
+    auto module = static_cast<ModuleImp *>(L0::Module::fromHandle(moduleHandle));
+    uint32_t kernelsCount = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&kernelsCount, nullptr));
+    ASSERT_NE(0u, kernelsCount);
+    std::vector<const char *> kernelNames(kernelsCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&kernelsCount, kernelNames.data()));
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelNames[0];
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+    ASSERT_NE(nullptr, kernelHandle);
+    EXPECT_NE(nullptr, driverHandle->moduleBuildWorkerPool);
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+    module->destroy();
+}
+
+TEST_F(ModuleAsyncBuildTest, givenModuleDescriptorWhenCheckingIfAsyncBuildIsAllowedThenOnlyPlainSpirvUserModulesWithoutBuildLogAreBuiltAsynchronously) {
+    DebugManagerStateRestore restorer;
+    uint8_t binary[10]{};
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = sizeof(binary);
+
+    ModuleImp userModule(device, nullptr, ModuleType::user);
+    EXPECT_FALSE(userModule.isAsyncBuildAllowed(&moduleDesc));
+
+    debugManager.flags.AsyncModuleBuildThreads.set(1);
+    EXPECT_TRUE(userModule.isAsyncBuildAllowed(&moduleDesc));
+
+    ModuleImp builtinModule(device, nullptr, ModuleType::builtin);
+    EXPECT_FALSE(builtinModule.isAsyncBuildAllowed(&moduleDesc));
+
+    auto moduleBuildLog = ModuleBuildLog::create();
+    ModuleImp moduleWithBuildLog(device, moduleBuildLog, ModuleType::user);
+    EXPECT_FALSE(moduleWithBuildLog.isAsyncBuildAllowed(&moduleDesc));
+    moduleBuildLog->destroy();
+
+    ze_module_constants_t specConstants = {};
+    uint32_t specConstantId = 0u;
+    uint64_t specConstantValue = 0u;
+    const void *specConstantValues[] = {&specConstantValue};
+    specConstants.numConstants = 1u;
+    specConstants.pConstantIds = &specConstantId;
+    specConstants.pConstantValues = specConstantValues;
+    moduleDesc.pConstants = &specConstants;
+    EXPECT_FALSE(userModule.isAsyncBuildAllowed(&moduleDesc));
+    moduleDesc.pConstants = nullptr;
+
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    EXPECT_FALSE(userModule.isAsyncBuildAllowed(&moduleDesc));
+}
+
 using ModuleInitializeTest = Test<DeviceFixture>;
 
 TEST_F(ModuleInitializeTest, whenModuleInitializeIsCalledThenCorrectResultIsReturned) {
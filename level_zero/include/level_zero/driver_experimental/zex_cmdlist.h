@@ -112,6 +112,16 @@ zexCommandListVerifyMemory(
     size_t sizeOfComparison,
     zex_verify_memory_compare_type_t comparisonMode);
 
+ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernels(
+    ze_command_list_handle_t hCommandList, ///< [in] handle of the command list
+    uint32_t numKernels,                   ///< [in] number of kernels to launch
+    const ze_kernel_handle_t *phKernels,   ///< [in][range(0, numKernels)] handles of the kernels to launch
+    const ze_group_count_t *pGroupCounts,  ///< [in][range(0, numKernels)] thread group launch arguments of each kernel
+    ze_event_handle_t *phSignalEvents,     ///< [in][optional][range(0, numKernels)] handles of the events to signal on completion of each kernel, entries may be null
+    uint32_t numWaitEvents,                ///< [in][optional] number of events to wait on before launching the first kernel
+    ze_event_handle_t *phWaitEvents);      ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait on before launching the first kernel
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
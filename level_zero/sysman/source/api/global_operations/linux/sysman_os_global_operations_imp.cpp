@@ -565,11 +565,12 @@ ze_result_t LinuxGlobalOperationsImp::readClientInfoFromFdInfo(std::map<uint64_t
 
         for (auto &&pid : processes) {
             std::vector<int> fds;
-            pLinuxSysmanImp->getPidFdsForOpenDevice(pid, fds);
+            pLinuxSysmanImp->getPidFdsForOpenDeviceCached(pid, fds);
             if (!fds.empty()) {
                 gpuClientProcessMap.emplace(pid, fds);
             }
         }
+        pLinuxSysmanImp->pruneProcessFdsCache(processes);
     }
 
     // iterate for each process
@@ -8,15 +8,30 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/linux/pmt_util.h"
 
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt_telemetry_snapshot.h"
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 namespace Sysman {
 
 static const std::string baseTelemSysfs("/sys/class/intel_pmt");
 
+ssize_t PlatformMonitoringTech::readTelem(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const uint64_t &telemOffset, uint64_t offset, size_t count, void *data, int &errorNum) {
+    if (pLinuxSysmanImp && PmtTelemetrySnapshot::isEnabled()) {
+        auto [minOffset, maxOffset] = std::minmax_element(keyOffsetMap.begin(), keyOffsetMap.end(), [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+        uint64_t regionBegin = telemOffset + minOffset->second;
+        uint64_t regionEnd = telemOffset + maxOffset->second + sizeof(uint64_t);
+        if (pLinuxSysmanImp->getPmtTelemetrySnapshotCache().get(telemDir)->read(regionBegin, regionEnd, offset, count, data, errorNum)) {
+            return static_cast<ssize_t>(count);
+        }
+    }
+    return NEO::PmtUtil::readTelem(telemDir.data(), count, offset, data, errorNum);
+}
+
 bool PlatformMonitoringTech::getKeyOffsetMap(SysmanProductHelper *pSysmanProductHelper, const std::string &guid, std::map<std::string, uint64_t> &keyOffsetMap) {
     auto pGuidToKeyOffsetMap = pSysmanProductHelper->getGuidToKeyOffsetMap();
     if (pGuidToKeyOffsetMap == nullptr) {
@@ -78,7 +93,7 @@ ze_result_t PlatformMonitoringTech::getTelemOffsetForContainer(SysmanProductHelp
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
+ze_result_t PlatformMonitoringTech::readValue(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -88,7 +103,7 @@ ze_result_t PlatformMonitoringTech::readValue(const std::map<std::string, uint64
 
     uint64_t offset = telemOffset + containerOffset->second;
     int errorNum = 0;
-    ssize_t bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), sizeof(uint32_t), offset, &value, errorNum);
+    ssize_t bytesRead = readTelem(pLinuxSysmanImp, keyOffsetMap, telemDir, telemOffset, offset, sizeof(uint32_t), &value, errorNum);
     if (bytesRead != sizeof(uint32_t)) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for %s key \n", __FUNCTION__, key.c_str());
         return LinuxSysmanImp::getPmtResult(errorNum);
@@ -96,7 +111,7 @@ ze_result_t PlatformMonitoringTech::readValue(const std::map<std::string, uint64
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
+ze_result_t PlatformMonitoringTech::readValue(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -106,7 +121,7 @@ ze_result_t PlatformMonitoringTech::readValue(const std::map<std::string, uint64
 
     uint64_t offset = telemOffset + containerOffset->second;
     int errorNum = 0;
-    ssize_t bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), sizeof(uint64_t), offset, &value, errorNum);
+    ssize_t bytesRead = readTelem(pLinuxSysmanImp, keyOffsetMap, telemDir, telemOffset, offset, sizeof(uint64_t), &value, errorNum);
     if (bytesRead != sizeof(uint64_t)) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for %s key \n", __FUNCTION__, key.c_str());
         return LinuxSysmanImp::getPmtResult(errorNum);
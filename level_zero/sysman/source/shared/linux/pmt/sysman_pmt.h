@@ -33,12 +33,15 @@ class PlatformMonitoringTech : NEO::NonCopyableAndNonMovableClass {
     static ze_result_t getTelemData(const std::map<uint32_t, std::string> telemNodesInPciPath, std::string &telemDir, std::string &guid, uint64_t &telemOffset);
     static ze_result_t getTelemDataForTileAggregator(const std::map<uint32_t, std::string> telemNodesInPciPath, uint32_t subDeviceId, std::string &telemDir, std::string &guid, uint64_t &telemOffset);
     static ze_result_t getTelemOffsetForContainer(SysmanProductHelper *pSysmanProductHelper, const std::string &telemDir, const std::string &key, uint64_t &telemOffset);
-    static ze_result_t readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
-    static ze_result_t readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
+    static ze_result_t readValue(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
+    static ze_result_t readValue(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
     static bool isTelemetrySupportAvailable(LinuxSysmanImp *pLinuxSysmanImp, uint32_t subdeviceId);
     static ze_result_t buildKeyOffsetMapFromTelemNodes(const std::map<std::string, std::map<std::string, uint64_t>> &guidToKeyOffsetMap, const std::string &rootPath,
                                                        std::map<std::string, uint64_t> &keyOffsetMap,
                                                        std::unordered_map<std::string, std::string> &keyTelemInfoMap);
+
+  protected:
+    static ssize_t readTelem(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const uint64_t &telemOffset, uint64_t offset, size_t count, void *data, int &errorNum);
 };
 
 } // namespace Sysman
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt_telemetry_snapshot.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+namespace L0 {
+namespace Sysman {
+
+PmtTelemetrySnapshot::PmtTelemetrySnapshot(const std::string &telemDir) : telemFile(telemDir + "/telem") {}
+
+PmtTelemetrySnapshot::~PmtTelemetrySnapshot() {
+    if (fd >= 0) {
+        NEO::SysCalls::close(fd);
+    }
+}
+
+bool PmtTelemetrySnapshot::isEnabled() {
+    return NEO::debugManager.flags.SysmanTelemetrySnapshotLifetimeUs.get() > 0;
+}
+
+bool PmtTelemetrySnapshot::read(uint64_t regionBegin, uint64_t regionEnd, uint64_t offset, size_t count, void *data, int &errorNum) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    const auto lifetime = std::chrono::microseconds(NEO::debugManager.flags.SysmanTelemetrySnapshotLifetimeUs.get());
+    const bool isStale = std::chrono::steady_clock::now() - snapshotTime > lifetime;
+    if (isStale || !contains(offset, count)) {
+        if (!snapshot.empty()) {
+            // keep previously requested keys in the refreshed region, so callers using different key maps do not evict each other
+            regionBegin = std::min(regionBegin, snapshotBegin);
+            regionEnd = std::max(regionEnd, snapshotBegin + snapshot.size());
+        }
+        regionBegin = std::min(regionBegin, offset);
+        regionEnd = std::min(std::max(regionEnd, offset + count), fileEnd);
+        if (regionEnd <= regionBegin || regionEnd - regionBegin > maxRegionSize) {
+            regionBegin = offset;
+            regionEnd = offset + count;
+        }
+        if (!refresh(regionBegin, regionEnd, errorNum) || !contains(offset, count)) {
+            return false;
+        }
+    }
+
+    memcpy(data, snapshot.data() + (offset - snapshotBegin), count);
+    return true;
+}
+
+bool PmtTelemetrySnapshot::refresh(uint64_t regionBegin, uint64_t regionEnd, int &errorNum) {
+    snapshot.clear();
+    if (fd < 0) {
+        fd = NEO::SysCalls::open(telemFile.c_str(), O_RDONLY);
+        if (fd < 0) {
+            errorNum = errno;
+            return false;
+        }
+    }
+
+    std::vector<uint8_t> region(regionEnd - regionBegin);
+    ssize_t bytesRead = NEO::SysCalls::pread(fd, region.data(), region.size(), static_cast<off_t>(regionBegin));
+    if (bytesRead < 0) {
+        errorNum = errno;
+        // the node may have been removed, e.g. on device reset, reopen it on next refresh
+        NEO::SysCalls::close(fd);
+        fd = -1;
+        return false;
+    }
+    if (static_cast<size_t>(bytesRead) < region.size()) {
+        // short read marks the end of the telemetry region, later refreshes are clamped to it
+        fileEnd = regionBegin + bytesRead;
+        region.resize(bytesRead);
+    }
+
+    snapshot = std::move(region);
+    snapshotBegin = regionBegin;
+    snapshotTime = std::chrono::steady_clock::now();
+    return true;
+}
+
+std::shared_ptr<PmtTelemetrySnapshot> PmtTelemetrySnapshotCache::get(const std::string &telemDir) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &snapshot = snapshots[telemDir];
+    if (!snapshot) {
+        snapshot = std::make_shared<PmtTelemetrySnapshot>(telemDir);
+    }
+    return snapshot;
+}
+
+void PmtTelemetrySnapshotCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    snapshots.clear();
+}
+
+} // namespace Sysman
+} // namespace L0
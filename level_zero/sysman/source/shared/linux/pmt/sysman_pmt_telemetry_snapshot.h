@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+
+// Keeps the telem file of a PMT node open and caches a region of it, so reads of many keys issued within
+// the snapshot lifetime are served from one pread instead of an open/pread/close per key.
+class PmtTelemetrySnapshot : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr size_t maxRegionSize = 64 * 1024;
+
+    explicit PmtTelemetrySnapshot(const std::string &telemDir);
+    ~PmtTelemetrySnapshot();
+
+    // Copies count bytes at offset into data; the snapshot is refreshed with region [regionBegin, regionEnd) when it is stale or does not contain the requested bytes.
+    bool read(uint64_t regionBegin, uint64_t regionEnd, uint64_t offset, size_t count, void *data, int &errorNum);
+
+    static bool isEnabled();
+
+  protected:
+    bool contains(uint64_t offset, size_t count) const {
+        return offset >= snapshotBegin && offset + count <= snapshotBegin + snapshot.size();
+    }
+    bool refresh(uint64_t regionBegin, uint64_t regionEnd, int &errorNum);
+
+    std::mutex mtx;
+    std::string telemFile;
+    int fd = -1;
+    std::vector<uint8_t> snapshot;
+    uint64_t snapshotBegin = 0;
+    uint64_t fileEnd = UINT64_MAX;
+    std::chrono::steady_clock::time_point snapshotTime;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<PmtTelemetrySnapshot>);
+
+// Snapshots of the telem nodes of one device, owned by its LinuxSysmanImp so they are released together with it.
+class PmtTelemetrySnapshotCache : NEO::NonCopyableAndNonMovableClass {
+  public:
+    std::shared_ptr<PmtTelemetrySnapshot> get(const std::string &telemDir);
+    void clear();
+
+  protected:
+    std::mutex mtx;
+    std::map<std::string, std::shared_ptr<PmtTelemetrySnapshot>> snapshots;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<PmtTelemetrySnapshotCache>);
+
+} // namespace Sysman
+} // namespace L0
@@ -78,7 +78,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
 
     uint32_t computeTemperature = 0;
     key = "COMPUTE_TEMPERATURES";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, computeTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, computeTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for COMPUTE_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -88,7 +88,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
 
     uint32_t coreTemperature = 0;
     key = "CORE_TEMPERATURES";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, coreTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, coreTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for CORE_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -98,7 +98,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
 
     uint64_t socTemperature = 0;
     key = "SOC_TEMPERATURES";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, socTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, socTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for SOC_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -133,7 +133,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuMaxTemperature(LinuxSysmanI
     double gpuMaxTemperature = 0;
     uint32_t computeTemperature = 0;
     std::string key("COMPUTE_TEMPERATURES");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, computeTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, computeTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for COMPUTE_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -276,7 +276,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
 
     std::string key = "SOC_TEMPERATURES";
     uint64_t socTemperature = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, socTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, socTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for SOC_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -313,7 +313,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuMaxTemperature(LinuxSysmanI
     double gpuMaxTemperature = 0;
     uint64_t socTemperature = 0;
     std::string key = "SOC_TEMPERATURES";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, socTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, socTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): readValue for SOC_TEMPERATURES returning error:0x%x \n", __FUNCTION__, result);
         return result;
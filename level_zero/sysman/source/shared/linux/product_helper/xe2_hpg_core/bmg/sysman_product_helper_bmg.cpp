@@ -1296,7 +1296,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getVoltageRegulatorMaxTemperature
         std::string key = "PLATFORM_VR_TEMPERATURE_0_2_0_GTTMMADR[" + std::to_string(i) + "]";
 
         uint32_t vrTemperature = 0;
-        ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, vrTemperature);
+        ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, vrTemperature);
         if (result != ZE_RESULT_SUCCESS) {
             PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read VR temperature value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
             return result;
@@ -1309,15 +1309,15 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getVoltageRegulatorMaxTemperature
     return ZE_RESULT_SUCCESS;
 }
 
-static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemNodeDir) {
+static ze_result_t getPciStatsValues(LinuxSysmanImp *pLinuxSysmanImp, zes_pci_stats_t *pStats, std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemNodeDir) {
     uint32_t rxCounterLsb = 0;
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_lsb", 0, rxCounterLsb);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_lsb", 0, rxCounterLsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint32_t rxCounterMsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_msb", 0, rxCounterMsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_msb", 0, rxCounterMsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1325,13 +1325,13 @@ static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::stri
     uint64_t rxCounter = packInto64Bit(rxCounterMsb, rxCounterLsb);
 
     uint32_t txCounterLsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_lsb", 0, txCounterLsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_lsb", 0, txCounterLsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint32_t txCounterMsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_msb", 0, txCounterMsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_msb", 0, txCounterMsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1339,13 +1339,13 @@ static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::stri
     uint64_t txCounter = packInto64Bit(txCounterMsb, txCounterLsb);
 
     uint32_t rxPacketCounterLsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_lsb", 0, rxPacketCounterLsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_lsb", 0, rxPacketCounterLsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint32_t rxPacketCounterMsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_msb", 0, rxPacketCounterMsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_msb", 0, rxPacketCounterMsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1353,13 +1353,13 @@ static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::stri
     uint64_t rxPacketCounter = packInto64Bit(rxPacketCounterMsb, rxPacketCounterLsb);
 
     uint32_t txPacketCounterLsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_lsb", 0, txPacketCounterLsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_lsb", 0, txPacketCounterLsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint32_t txPacketCounterMsb = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_msb", 0, txPacketCounterMsb);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_msb", 0, txPacketCounterMsb);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1402,7 +1402,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPciStats(zes_pci_stats_t *pSta
             continue;
         }
 
-        result = getPciStatsValues(pStats, keyOffsetMapIterator->second, telemNodeDir);
+        result = getPciStatsValues(pLinuxSysmanImp, pStats, keyOffsetMapIterator->second, telemNodeDir);
         if (result == ZE_RESULT_SUCCESS) {
             break;
         }
@@ -1425,7 +1425,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuMaxTemperature(LinuxSysmanI
 
     uint32_t gpuMaxTemperature = 0;
     std::string key("SOC_THERMAL_SENSORS_TEMPERATURE_0_2_0_GTTMMADR[1]");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, gpuMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, gpuMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -1453,7 +1453,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryMaxTemperature(LinuxSysm
 
     uint32_t memoryMaxTemperature = 0;
     std::string key("VRAM_TEMPERATURE_0_2_0_GTTMMADR");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, memoryMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, memoryMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -1495,11 +1495,11 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
     return result;
 }
 
-static ze_result_t getMemoryMaxBandwidth(const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
+static ze_result_t getMemoryMaxBandwidth(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
                                          zes_mem_bandwidth_t *pBandwidth) {
     uint32_t maxBandwidth = 0;
     std::string key = "VRAM_BANDWIDTH";
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, maxBandwidth);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, maxBandwidth);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1511,20 +1511,20 @@ static ze_result_t getMemoryMaxBandwidth(const std::map<std::string, uint64_t> &
     return ZE_RESULT_SUCCESS;
 }
 
-static ze_result_t getCounterValues(const std::vector<std::pair<const std::string, const std::string>> &registerList, const std::string &keyPrefix,
+static ze_result_t getCounterValues(LinuxSysmanImp *pLinuxSysmanImp, const std::vector<std::pair<const std::string, const std::string>> &registerList, const std::string &keyPrefix,
                                     const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap, uint64_t &totalCounter) {
     for (const auto &regPair : registerList) {
         uint32_t regL = 0;
         uint32_t regH = 0;
 
         std::string keyL = keyPrefix + regPair.first;
-        ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[keyL], keyL, 0, regL);
+        ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[keyL], keyL, 0, regL);
         if (result != ZE_RESULT_SUCCESS) {
             return result;
         }
 
         std::string keyH = keyPrefix + regPair.second;
-        result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[keyH], keyH, 0, regH);
+        result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[keyH], keyH, 0, regH);
         if (result != ZE_RESULT_SUCCESS) {
             return result;
         }
@@ -1537,7 +1537,7 @@ static ze_result_t getCounterValues(const std::vector<std::pair<const std::strin
     return ZE_RESULT_SUCCESS;
 }
 
-static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
+static ze_result_t getMemoryBandwidthCounterValues(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
                                                    const uint32_t &supportedMsu, zes_mem_bandwidth_t *pBandwidth) {
     const std::vector<std::pair<const std::string, const std::string>> readBwRegisterList{
         {"_CH0_GT_32B_RD_REQ_LOWER", "_CH0_GT_32B_RD_REQ_UPPER"},
@@ -1574,11 +1574,11 @@ static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, u
             keyStream << "GDDR" << i;
             std::string keyPrefix = keyStream.str();
 
-            if (ZE_RESULT_SUCCESS != getCounterValues(readBwRegisterList, keyPrefix, keyOffsetMap, keyTelemInfoMap, pBandwidth->readCounter)) {
+            if (ZE_RESULT_SUCCESS != getCounterValues(pLinuxSysmanImp, readBwRegisterList, keyPrefix, keyOffsetMap, keyTelemInfoMap, pBandwidth->readCounter)) {
                 return ZE_RESULT_ERROR_NOT_AVAILABLE;
             }
 
-            if (ZE_RESULT_SUCCESS != getCounterValues(writeBwRegisterList, keyPrefix, keyOffsetMap, keyTelemInfoMap, pBandwidth->writeCounter)) {
+            if (ZE_RESULT_SUCCESS != getCounterValues(pLinuxSysmanImp, writeBwRegisterList, keyPrefix, keyOffsetMap, keyTelemInfoMap, pBandwidth->writeCounter)) {
                 return ZE_RESULT_ERROR_NOT_AVAILABLE;
             }
         }
@@ -1629,18 +1629,18 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryBandwidth(zes_mem_bandwi
     // Get Memory Subsystem Bitmask
     uint32_t supportedMsu = 0;
     std::string key = "MSU_BITMASK";
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, supportedMsu);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, supportedMsu);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     // Get Read and Write Counter Values
-    if (ZE_RESULT_SUCCESS != getMemoryBandwidthCounterValues(keyOffsetMap, keyTelemInfoMap, supportedMsu, pBandwidth)) {
+    if (ZE_RESULT_SUCCESS != getMemoryBandwidthCounterValues(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, supportedMsu, pBandwidth)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     // Get Max Bandwidth
-    if (ZE_RESULT_SUCCESS != getMemoryMaxBandwidth(keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
+    if (ZE_RESULT_SUCCESS != getMemoryMaxBandwidth(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
@@ -1693,7 +1693,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getNumberOfMemoryChannels(LinuxSy
     // Get MSU Bitmask
     uint32_t supportedMsu = 0;
     std::string msuBitMaskKey = "MSU_BITMASK";
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[msuBitMaskKey], msuBitMaskKey, 0, supportedMsu);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[msuBitMaskKey], msuBitMaskKey, 0, supportedMsu);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1714,7 +1714,7 @@ static bool isPowerDomainSupported(zes_power_domain_t powerDomain) {
     return supportedPowerDomains.find(powerDomain) != supportedPowerDomains.end();
 }
 
-static ze_result_t readEnergyCounter(const std::map<std::string, uint64_t> &keyOffsetMap,
+static ze_result_t readEnergyCounter(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap,
                                      std::unordered_map<std::string, std::string> &keyTelemInfoMap,
                                      zes_power_domain_t powerDomain,
                                      uint32_t &rawEnergyCounter) {
@@ -1726,7 +1726,7 @@ static ze_result_t readEnergyCounter(const std::map<std::string, uint64_t> &keyO
 
     ze_result_t result = ZE_RESULT_ERROR_NOT_AVAILABLE;
     for (const auto &key : powerDomainToKeyMap.at(powerDomain)) {
-        result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, rawEnergyCounter);
+        result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, rawEnergyCounter);
         if (result == ZE_RESULT_SUCCESS) {
             break;
         }
@@ -1753,7 +1753,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
 
     // Energy Counter calculation
     uint32_t energyCounter = 0;
-    result = readEnergyCounter(keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounter);
+    result = readEnergyCounter(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1762,14 +1762,14 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
     // Timestamp calculation
     uint64_t timestamp64 = 0;
     std::string key = "XTAL_COUNT";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, timestamp64);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, timestamp64);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint32_t frequency = 0;
     key = "XTAL_CLK_FREQUENCY";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, frequency);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, frequency);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -1804,7 +1804,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerUsage(LinuxSysmanImp *pLi
 
     // Read first energy counter sample
     uint32_t energyCounterSample1 = 0;
-    ze_result_t energyResult = readEnergyCounter(keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounterSample1);
+    ze_result_t energyResult = readEnergyCounter(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounterSample1);
     if (energyResult != ZE_RESULT_SUCCESS) {
         return energyResult;
     }
@@ -1816,7 +1816,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerUsage(LinuxSysmanImp *pLi
 
     // Read second energy counter sample
     uint32_t energyCounterSample2 = 0;
-    energyResult = readEnergyCounter(keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounterSample2);
+    energyResult = readEnergyCounter(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, powerDomain, energyCounterSample2);
     if (energyResult != ZE_RESULT_SUCCESS) {
         return energyResult;
     }
@@ -1827,7 +1827,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerUsage(LinuxSysmanImp *pLi
     // Instantaneous power calculation
     uint64_t instantaneousPowerValue = 0;
     std::string key = "INSTANTANEOUS_POWER_CONTAINER"; // 64-bit container with Instantaneous power values at different bit offsets
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, instantaneousPowerValue);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, instantaneousPowerValue);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Instantaneous Power from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -225,7 +225,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getEccState(LinuxSysmanImp *pLinu
     }
 
     uint32_t eccState = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, eccStateKey->second, key, 0, eccState);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, eccStateKey->second, key, 0, eccState);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
                      "Error@ %s(): Failed to read ECC_STATE from PMT, returning error:0x%x \n",
@@ -399,7 +399,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
 
     uint32_t energyCounter = 0;
     std::string key = powerDomainToKeyMapIter->second;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, energyCounter);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, energyCounter);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Energy counter from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -419,7 +419,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
     // Timestamp calculation
     uint32_t timestampValue = 0;
     key = "XTAL_COUNT";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, timestampValue);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, timestampValue);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Xtal clock from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -427,7 +427,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
 
     uint32_t frequency = 0;
     key = "XTAL_CLK_FREQUENCY";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, frequency);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, frequency);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Xtal clock frequency from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -452,7 +452,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerUsage(LinuxSysmanImp *pLi
 
     uint64_t instantaneousPowerValue = 0;
     std::string key = "INSTANTANEOUS_POWER_CONTAINER"; // 64-bit container with Instantaneous power values at different bit offsets
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, instantaneousPowerValue);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, instantaneousPowerValue);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Instantaneous Power from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -460,7 +460,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerUsage(LinuxSysmanImp *pLi
 
     uint64_t averagePowerValue = 0;
     key = "AVERAGE_POWER_CONTAINER"; // 64-bit container with Average power values at different bit offsets
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, averagePowerValue);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, averagePowerValue);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read Average Power from Telemetry, returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -534,33 +534,33 @@ int32_t SysmanProductHelperHw<gfxProduct>::maxPcieGenSupported() {
     return maxPcieGenSupported;
 }
 
-static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemNodeDir) {
+static ze_result_t getPciStatsValues(LinuxSysmanImp *pLinuxSysmanImp, zes_pci_stats_t *pStats, std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemNodeDir) {
     uint64_t rxCounter = 0;
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "PCIE_RECEIVE_BYTES", 0, rxCounter);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "PCIE_RECEIVE_BYTES", 0, rxCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint64_t txCounter = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "PCIE_TRANSMIT_BYTES", 0, txCounter);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "PCIE_TRANSMIT_BYTES", 0, txCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint64_t rxPacketCounter = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "PCIE_RECEIVE_PACKETS", 0, rxPacketCounter);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "PCIE_RECEIVE_PACKETS", 0, rxPacketCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint64_t txPacketCounter = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "PCIE_TRANSMIT_PACKETS", 0, txPacketCounter);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "PCIE_TRANSMIT_PACKETS", 0, txPacketCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
     uint64_t timeStamp = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "LPDDR_TELEM_CAPTURE_TIMESTAMP", 0, timeStamp);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemNodeDir, "LPDDR_TELEM_CAPTURE_TIMESTAMP", 0, timeStamp);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -601,7 +601,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPciStats(zes_pci_stats_t *pSta
             continue;
         }
 
-        result = getPciStatsValues(pStats, keyOffsetMapIterator->second, telemNodeDir);
+        result = getPciStatsValues(pLinuxSysmanImp, pStats, keyOffsetMapIterator->second, telemNodeDir);
         if (result == ZE_RESULT_SUCCESS) {
             break;
         }
@@ -760,7 +760,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getVoltageRegulatorMaxTemperature
         std::string key = "VR_TEMPERATURE_" + std::to_string(i);
 
         uint32_t rawVrTemperature = 0;
-        ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, rawVrTemperature);
+        ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, rawVrTemperature);
         if (result != ZE_RESULT_SUCCESS) {
             PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read VR temperature value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
             return result;
@@ -794,7 +794,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuBoardMaxTemperature(LinuxSy
     std::string key = "AMB_TEMPERATURE";
 
     uint64_t ambientTemperatureContainer = 0;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, 0, ambientTemperatureContainer);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, 0, ambientTemperatureContainer);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read ambient temperature value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -845,7 +845,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getActualFrequency(LinuxSysmanImp
     uint32_t memoryActualFreq = 0;
     uint64_t telemOffset = 0;
     std::string key("VRAM_FREQUENCY");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryActualFreq);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryActualFreq);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -870,7 +870,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getCurrentVoltage(LinuxSysmanImp
     uint32_t memoryVoltage = 0;
     uint64_t telemOffset = 0;
     std::string key("VCCDDRQX_VID");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryVoltage);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryVoltage);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -905,7 +905,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuMaxTemperature(LinuxSysmanI
     uint32_t rawGpuMaxTemperature = 0;
     uint64_t telemOffset = 0;
     std::string key("SOC_TOPDIE_TEMPERATURE");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, rawGpuMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, rawGpuMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -937,7 +937,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getCompositeTemperature(LinuxSysm
     uint32_t compositeTemperature = 0;
     uint64_t telemOffset = 0;
     std::string key("COMPOSITE_TEMPERATURE");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, compositeTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, compositeTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -953,7 +953,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getCompositeTemperature(LinuxSysm
     return ZE_RESULT_SUCCESS;
 }
 
-static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
+static ze_result_t getMemoryBandwidthCounterValues(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
                                                    zes_mem_bandwidth_t *pBandwidth) {
 
     uint64_t readCounter = 0;
@@ -969,7 +969,7 @@ static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, u
 
             std::string readKey = "MEMSS" + std::to_string(i) + "_PERF_CTR_" + mbSuffix + "_CFI_NUM_READ_REQ";
             uint64_t readCounterValue = 0;
-            ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[readKey], readKey, telemOffset, readCounterValue);
+            ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[readKey], readKey, telemOffset, readCounterValue);
             if (result != ZE_RESULT_SUCCESS) {
                 PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, readKey.c_str(), result);
                 return result;
@@ -978,7 +978,7 @@ static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, u
 
             std::string writeKey = "MEMSS" + std::to_string(i) + "_PERF_CTR_" + mbSuffix + "_CFI_NUM_WRITE_REQ";
             uint64_t writeCounterValue = 0;
-            result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[writeKey], writeKey, telemOffset, writeCounterValue);
+            result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[writeKey], writeKey, telemOffset, writeCounterValue);
             if (result != ZE_RESULT_SUCCESS) {
                 PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, writeKey.c_str(), result);
                 return result;
@@ -995,13 +995,13 @@ static ze_result_t getMemoryBandwidthCounterValues(const std::map<std::string, u
     return ZE_RESULT_SUCCESS;
 }
 
-static ze_result_t getMemoryMaxBandwidth(const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
+static ze_result_t getMemoryMaxBandwidth(LinuxSysmanImp *pLinuxSysmanImp, const std::map<std::string, uint64_t> &keyOffsetMap, std::unordered_map<std::string, std::string> &keyTelemInfoMap,
                                          zes_mem_bandwidth_t *pBandwidth) {
 
     uint64_t telemOffset = 0;
     uint32_t maxBandwidth = 0;
     std::string key = "VRAM_BANDWIDTH";
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, maxBandwidth);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, maxBandwidth);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -1029,7 +1029,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryMaxTemperature(LinuxSysm
     uint64_t telemOffset = 0;
     uint32_t memoryMaxTemperature = 0;
     std::string key("VRAM_TEMPERATURE");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memoryMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
@@ -1053,12 +1053,12 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryBandwidth(zes_mem_bandwi
         return result;
     }
 
-    if (ZE_RESULT_SUCCESS != getMemoryBandwidthCounterValues(keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
+    if (ZE_RESULT_SUCCESS != getMemoryBandwidthCounterValues(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to get the Read and Write Counter Values, returning error 0x%x>\n", __func__, ZE_RESULT_ERROR_NOT_AVAILABLE);
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
-    if (ZE_RESULT_SUCCESS != getMemoryMaxBandwidth(keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
+    if (ZE_RESULT_SUCCESS != getMemoryMaxBandwidth(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap, pBandwidth)) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to get the Max Bandwidth Value, returning error 0x%x>\n", __func__, ZE_RESULT_ERROR_NOT_AVAILABLE);
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
@@ -1114,7 +1114,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryVendorId(LinuxSysmanImp
     uint32_t memVendorId = 0;
     uint64_t telemOffset = 0;
     std::string key("MEM_VENDOR_ID");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memVendorId);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, keyTelemInfoMap[key], key, telemOffset, memVendorId);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for key: %s, returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
         return result;
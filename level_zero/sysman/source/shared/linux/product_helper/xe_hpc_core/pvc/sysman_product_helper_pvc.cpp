@@ -147,10 +147,10 @@ void getHBMFrequency(SysmanKmdInterface *pSysmanKmdInterface, SysFsAccessInterfa
     }
 }
 
-ze_result_t getVFIDString(std::map<std::string, uint64_t> keyOffsetMap, std::string &vfID, std::string telemDir, uint64_t telemOffset) {
+ze_result_t getVFIDString(LinuxSysmanImp *pLinuxSysmanImp, std::map<std::string, uint64_t> keyOffsetMap, std::string &vfID, std::string telemDir, uint64_t telemOffset) {
     uint32_t vf0VfIdVal = 0;
     std::string key = "VF0_VFID";
-    ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, vf0VfIdVal);
+    ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, vf0VfIdVal);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for VF0_VFID is returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -158,7 +158,7 @@ ze_result_t getVFIDString(std::map<std::string, uint64_t> keyOffsetMap, std::str
 
     uint32_t vf1VfIdVal = 0;
     key = "VF1_VFID";
-    result = PlatformMonitoringTech::readValue(std::move(keyOffsetMap), telemDir, key, telemOffset, vf1VfIdVal);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, std::move(keyOffsetMap), telemDir, key, telemOffset, vf1VfIdVal);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for VF1_VFID is returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -187,7 +187,7 @@ ze_result_t getHBMBandwidth(std::map<std::string, uint64_t> keyOffsetMap, zes_me
     pBandwidth->maxBandwidth = 0;
     ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
     std::string vfId = "";
-    result = getVFIDString(keyOffsetMap, vfId, telemDir, telemOffset);
+    result = getVFIDString(pLinuxSysmanImp, keyOffsetMap, vfId, telemDir, telemOffset);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():getVFIDString returning error:0x%x while retrieving VFID string \n", __FUNCTION__, result);
         return result;
@@ -196,7 +196,7 @@ ze_result_t getHBMBandwidth(std::map<std::string, uint64_t> keyOffsetMap, zes_me
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
         uint32_t counterValue = 0;
         std::string readCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ";
-        ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, counterValue);
+        ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, readCounterKey, telemOffset, counterValue);
         if (result != ZE_RESULT_SUCCESS) {
             PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterKey returning error:0x%x \n", __FUNCTION__, result);
             return result;
@@ -205,7 +205,7 @@ ze_result_t getHBMBandwidth(std::map<std::string, uint64_t> keyOffsetMap, zes_me
 
         counterValue = 0;
         std::string writeCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE";
-        result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, counterValue);
+        result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, writeCounterKey, telemOffset, counterValue);
         if (result != ZE_RESULT_SUCCESS) {
             PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterKey returning error:0x%x \n", __FUNCTION__, result);
             return result;
@@ -258,7 +258,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
     pBandwidth->maxBandwidth = 0;
 
     std::string vfId = "";
-    result = getVFIDString(keyOffsetMap, vfId, telemDir, telemOffset);
+    result = getVFIDString(pLinuxSysmanImp, keyOffsetMap, vfId, telemDir, telemOffset);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():getVFIDString returning error:0x%x while retrieving VFID string \n", __FUNCTION__, result);
         return result;
@@ -266,7 +266,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
 
     uint32_t readCounterL = 0;
     std::string readCounterKey = vfId + "_HBM_READ_L";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterL);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterL);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterL returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -274,7 +274,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
 
     uint32_t readCounterH = 0;
     readCounterKey = vfId + "_HBM_READ_H";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterH);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterH);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterH returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -287,7 +287,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
 
     uint32_t writeCounterL = 0;
     std::string writeCounterKey = vfId + "_HBM_WRITE_L";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterL);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterL);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterL returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -295,7 +295,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
 
     uint32_t writeCounterH = 0;
     writeCounterKey = vfId + "_HBM_WRITE_H";
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterH);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterH);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterH returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -363,7 +363,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGlobalMaxTemperature(LinuxSysm
 
     uint32_t globalMaxTemperature = 0;
     std::string key("TileMaxTemperature");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, globalMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, globalMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for TileMaxTemperature returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -393,7 +393,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getGpuMaxTemperature(LinuxSysmanI
 
     uint32_t gpuMaxTemperature = 0;
     std::string key("GTMaxTemperature");
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, gpuMaxTemperature);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, gpuMaxTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for GTMaxTemperature returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -426,7 +426,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryMaxTemperature(LinuxSysm
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
         uint32_t maxDeviceTemperature = 0;
         std::string key = "HBM" + std::to_string(hbmModuleIndex) + "MaxDeviceTemperature";
-        ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, maxDeviceTemperature);
+        ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, maxDeviceTemperature);
         if (result != ZE_RESULT_SUCCESS) {
             PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for %s returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
             return result;
@@ -137,7 +137,7 @@ const std::map<std::string, std::map<std::string, uint64_t>> *SysmanProductHelpe
     return &guidToKeyOffsetMap;
 }
 
-ze_result_t readMcChannelCounters(std::map<std::string, uint64_t> keyOffsetMap, uint64_t &readCounters, uint64_t &writeCounters, std::string telemDir, uint64_t telemOffset) {
+ze_result_t readMcChannelCounters(LinuxSysmanImp *pLinuxSysmanImp, std::map<std::string, uint64_t> keyOffsetMap, uint64_t &readCounters, uint64_t &writeCounters, std::string telemDir, uint64_t telemOffset) {
     uint32_t numMcChannels = 16u;
     std::vector<std::string> nameOfCounters{"IDI_READS", "IDI_WRITES", "DISPLAY_VC1_READS"};
     std::vector<uint64_t> counterValues(3, 0);
@@ -145,7 +145,7 @@ ze_result_t readMcChannelCounters(std::map<std::string, uint64_t> keyOffsetMap,
         for (uint32_t mcChannelIndex = 0; mcChannelIndex < numMcChannels; mcChannelIndex++) {
             uint64_t val = 0;
             std::string readCounterKey = nameOfCounters[counterIndex] + "[" + std::to_string(mcChannelIndex) + "]";
-            ze_result_t result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, val);
+            ze_result_t result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, readCounterKey, telemOffset, val);
             if (result != ZE_RESULT_SUCCESS) {
                 PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterKey returning error:0x%x \n", __FUNCTION__, result);
                 return result;
@@ -186,7 +186,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryBandwidth(zes_mem_bandwi
     }
     keyOffsetMap = keyOffsetMapEntry->second;
 
-    result = readMcChannelCounters(std::move(keyOffsetMap), pBandwidth->readCounter, pBandwidth->writeCounter, std::move(telemDir), telemOffset);
+    result = readMcChannelCounters(pLinuxSysmanImp, std::move(keyOffsetMap), pBandwidth->readCounter, pBandwidth->writeCounter, std::move(telemDir), telemOffset);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readMcChannelCounters returning error:0x%x  \n", __FUNCTION__, result);
         return result;
@@ -224,7 +224,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPowerEnergyCounter(zes_power_e
     const std::string key("PACKAGE_ENERGY");
     uint64_t energyCounter = 0;
     constexpr uint64_t fixedPointToJoule = 1048576;
-    result = PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, energyCounter);
+    result = PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, telemDir, key, telemOffset, energyCounter);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
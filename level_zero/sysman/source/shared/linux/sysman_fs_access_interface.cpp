@@ -356,6 +356,7 @@ ProcFsAccessInterface::~ProcFsAccessInterface() = default;
 
 const std::string ProcFsAccessInterface::procDir = "/proc/";
 const std::string ProcFsAccessInterface::fdDir = "/fd/";
+const std::string ProcFsAccessInterface::statFile = "/stat";
 
 std::string ProcFsAccessInterface::fullPath(const ::pid_t pid) {
     // Returns the full path for proc entry for process pid
@@ -427,6 +428,36 @@ ze_result_t ProcFsAccessInterface::getFileName(const ::pid_t pid, const int fd,
     return FsAccessInterface::readSymLink(fullFdPath(pid, fd), val);
 }
 
+ze_result_t ProcFsAccessInterface::getProcessStartTime(const ::pid_t pid, uint64_t &startTime) {
+    // Returns the start time of the process in clock ticks since boot (field 22 of /proc/<pid>/stat).
+    // Together with the pid it uniquely identifies a process instance, as pids can be reused.
+    std::vector<std::string> lines;
+    ze_result_t result = FsAccessInterface::read(fullPath(pid) + statFile, lines);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    if (lines.empty()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    // Process name in field 2 is enclosed in parentheses and may contain spaces,
+    // so fields are counted from the last closing parenthesis, which ends field 2.
+    constexpr uint32_t fieldsToSkipBeforeStartTime = 19u;
+    auto nameEnd = lines[0].rfind(')');
+    if (nameEnd == std::string::npos) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    std::istringstream stream(lines[0].substr(nameEnd + 1));
+    std::string field;
+    for (uint32_t i = 0; i < fieldsToSkipBeforeStartTime; i++) {
+        stream >> field;
+    }
+    stream >> startTime;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 bool ProcFsAccessInterface::isAlive(const ::pid_t pid) {
     return FsAccessInterface::fileExists(fullPath(pid));
 }
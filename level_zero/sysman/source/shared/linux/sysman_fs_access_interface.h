@@ -88,6 +88,7 @@ class ProcFsAccessInterface : private FsAccessInterface {
     MOCKABLE_VIRTUAL ::pid_t myProcessId();
     MOCKABLE_VIRTUAL ze_result_t getFileDescriptors(const ::pid_t pid, std::vector<int> &list);
     MOCKABLE_VIRTUAL ze_result_t getFileName(const ::pid_t pid, const int fd, std::string &val);
+    MOCKABLE_VIRTUAL ze_result_t getProcessStartTime(const ::pid_t pid, uint64_t &startTime);
     MOCKABLE_VIRTUAL bool isAlive(const ::pid_t pid);
     MOCKABLE_VIRTUAL void kill(const ::pid_t pid);
 
@@ -100,6 +101,7 @@ class ProcFsAccessInterface : private FsAccessInterface {
     std::string fullFdPath(const ::pid_t pid, const int fd);
     static const std::string procDir;
     static const std::string fdDir;
+    static const std::string statFile;
 };
 
 class SysFsAccessInterface : protected FsAccessInterface {
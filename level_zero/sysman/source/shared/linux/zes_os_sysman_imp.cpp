@@ -30,6 +30,7 @@
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 
+#include <algorithm>
 #include <cstdlib>
 
 namespace L0 {
@@ -263,6 +264,79 @@ void LinuxSysmanImp::getPidFdsForOpenDevice(const ::pid_t pid, std::vector<int>
     }
 }
 
+void LinuxSysmanImp::getPidFdsForOpenDeviceCached(const ::pid_t pid, std::vector<int> &deviceFds) {
+    // Same as getPidFdsForOpenDevice, but resolves /proc/<pid>/fd links only for file descriptors
+    // not seen before in the same process instance (identified by pid and start time).
+    // Entries older than the cache lifetime are fully revalidated to catch reused fd numbers.
+    auto lifetimeMs = NEO::debugManager.flags.SysmanProcessFdsCacheLifetimeMs.get();
+    if (lifetimeMs <= 0) {
+        getPidFdsForOpenDevice(pid, deviceFds);
+        return;
+    }
+
+    deviceFds.clear();
+    uint64_t startTime = 0;
+    std::vector<int> fds;
+    std::lock_guard<std::mutex> lock(processFdsCacheLock);
+    if (ZE_RESULT_SUCCESS != pProcfsAccess->getProcessStartTime(pid, startTime) ||
+        ZE_RESULT_SUCCESS != pProcfsAccess->getFileDescriptors(pid, fds)) {
+        // Process exited. Not an error. Just ignore.
+        processFdsCache.erase(pid);
+        return;
+    }
+    std::sort(fds.begin(), fds.end());
+
+    auto now = std::chrono::steady_clock::now();
+    auto [it, inserted] = processFdsCache.try_emplace(pid);
+    auto &entry = it->second;
+    bool sameProcess = !inserted && (entry.startTime == startTime) && (now - entry.validationTime <= std::chrono::milliseconds(lifetimeMs));
+    if (sameProcess && entry.fds == fds) {
+        deviceFds = entry.deviceFds;
+        return;
+    }
+
+    for (auto &&fd : fds) {
+        if (sameProcess && std::binary_search(entry.fds.begin(), entry.fds.end(), fd)) {
+            if (std::binary_search(entry.deviceFds.begin(), entry.deviceFds.end(), fd)) {
+                deviceFds.push_back(fd);
+            }
+            continue;
+        }
+        std::string file;
+        if (pProcfsAccess->getFileName(pid, fd, file) != ZE_RESULT_SUCCESS) {
+            // Process closed this file. Not an error. Just ignore.
+            continue;
+        }
+        if (pSysfsAccess->isMyDeviceFile(std::move(file))) {
+            deviceFds.push_back(fd);
+        }
+    }
+
+    if (!sameProcess) {
+        entry.startTime = startTime;
+        entry.validationTime = now;
+    }
+    entry.fds = std::move(fds);
+    entry.deviceFds = deviceFds;
+}
+
+void LinuxSysmanImp::pruneProcessFdsCache(const std::vector<::pid_t> &processes) {
+    // Drop entries of processes which exited since the last scan
+    std::lock_guard<std::mutex> lock(processFdsCacheLock);
+    if (processFdsCache.empty()) {
+        return;
+    }
+    std::vector<::pid_t> sortedProcesses(processes);
+    std::sort(sortedProcesses.begin(), sortedProcesses.end());
+    for (auto it = processFdsCache.begin(); it != processFdsCache.end();) {
+        if (!std::binary_search(sortedProcesses.begin(), sortedProcesses.end(), it->first)) {
+            it = processFdsCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 ze_result_t LinuxSysmanImp::gpuProcessCleanup(ze_bool_t force) {
     ::pid_t myPid = pProcfsAccess->myProcessId();
     std::vector<::pid_t> processes;
@@ -15,10 +15,12 @@
 #include "level_zero/sysman/source/device/os_sysman.h"
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
 #include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt_telemetry_snapshot.h"
 #include "level_zero/sysman/source/shared/linux/sysman_hw_device_id_linux.h"
 #include "level_zero/sysman/source/sysman_const.h"
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 
@@ -68,6 +70,8 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableAndNonMovableClass {
     MOCKABLE_VIRTUAL ze_result_t reInitSysmanDeviceResources();
     MOCKABLE_VIRTUAL void reInitSysmanDeviceCache();
     MOCKABLE_VIRTUAL void getPidFdsForOpenDevice(const ::pid_t, std::vector<int> &);
+    void getPidFdsForOpenDeviceCached(const ::pid_t pid, std::vector<int> &deviceFds);
+    void pruneProcessFdsCache(const std::vector<::pid_t> &processes);
     MOCKABLE_VIRTUAL ze_result_t osWarmReset();
     MOCKABLE_VIRTUAL ze_result_t osColdReset();
     ze_result_t gpuProcessCleanup(ze_bool_t force);
@@ -89,6 +93,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableAndNonMovableClass {
     bool isMemoryDiagnostics = false;
     std::string gtDevicePath;
     SysmanKmdInterface *getSysmanKmdInterface() { return pSysmanKmdInterface.get(); }
+    PmtTelemetrySnapshotCache &getPmtTelemetrySnapshotCache() { return pmtTelemetrySnapshotCache; }
     static ze_result_t getResult(int err);
     static ze_result_t getPmtResult(int err);
     ze_result_t getTelemData(uint32_t subDeviceId, std::string &telemDir, std::string &guid, uint64_t &telemOffset);
@@ -114,12 +119,21 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableAndNonMovableClass {
     std::map<uint32_t, std::unique_ptr<PlatformMonitoringTech::TelemData>> mapOfSubDeviceIdToTelemData;
     std::map<uint32_t, std::string> telemNodesInPciPath;
     std::unique_ptr<PlatformMonitoringTech::TelemData> pTelemData = nullptr;
+    PmtTelemetrySnapshotCache pmtTelemetrySnapshotCache;
     struct Uuid {
         bool isValid = false;
         std::array<uint8_t, NEO::ProductHelper::uuidSize> id{};
     };
     std::vector<Uuid> uuidVec;
     NEO::PhysicalDevicePciBusInfo pciBdfInfo = {};
+    struct ProcessFdsCacheEntry {
+        uint64_t startTime = 0;
+        std::vector<int> fds;       // sorted
+        std::vector<int> deviceFds; // sorted
+        std::chrono::steady_clock::time_point validationTime{};
+    };
+    std::map<::pid_t, ProcessFdsCacheEntry> processFdsCache;
+    std::mutex processFdsCacheLock;
 
   private:
     LinuxSysmanImp() = delete;
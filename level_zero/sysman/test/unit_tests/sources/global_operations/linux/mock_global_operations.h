@@ -510,7 +510,9 @@ struct MockGlobalOperationsProcfsAccess : public L0::Sysman::ProcFsAccessInterfa
 
     ze_result_t mockGetFileNameError = ZE_RESULT_SUCCESS;
     ze_result_t getFileNameResult = ZE_RESULT_SUCCESS;
+    uint32_t getFileNameCalled = 0u;
     ze_result_t getFileName(const ::pid_t pid, const int fd, std::string &val) override {
+        getFileNameCalled++;
         if (mockGetFileNameError != ZE_RESULT_SUCCESS) {
             return mockGetFileNameError;
         }
@@ -524,6 +526,13 @@ struct MockGlobalOperationsProcfsAccess : public L0::Sysman::ProcFsAccessInterfa
         return getFileNameResult;
     }
 
+    std::map<::pid_t, uint64_t> mockStartTimes{};
+    ze_result_t getProcessStartTime(const ::pid_t pid, uint64_t &startTime) override {
+        auto it = mockStartTimes.find(pid);
+        startTime = (it != mockStartTimes.end()) ? it->second : 0u;
+        return ZE_RESULT_SUCCESS;
+    }
+
     bool isAlive(const ::pid_t pid) override {
         if (pid == ourDevicePid) {
             return true;
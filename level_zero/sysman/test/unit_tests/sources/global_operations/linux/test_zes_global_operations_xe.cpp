@@ -90,6 +90,70 @@ TEST_F(SysmanGlobalOperationsFixtureXe, GivenValidDeviceHandleWhileRetrievingInf
     EXPECT_EQ(processes[0].sharedSize, expectedSharedSize);
 }
 
+TEST_F(SysmanGlobalOperationsFixtureXe, GivenProcessFdsCacheEnabledWhenRetrievingProcessesStateRepeatedlyThenFileDescriptorLinksAreResolvedOnlyOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SysmanProcessFdsCacheLifetimeMs.set(60000);
+
+    pProcfsAccess->ourDevicePid = pProcfsAccess->extraPid;
+    pProcfsAccess->ourDeviceFd = pProcfsAccess->extraFd;
+    pProcfsAccess->ourDeviceFd1 = pProcfsAccess->extraFd1;
+    pProcfsAccess->mockListProcessCall.push_back(DEVICE_IN_USE);
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, 1u);
+    auto getFileNameCalledAfterFirstScan = pProcfsAccess->getFileNameCalled;
+    EXPECT_NE(0u, getFileNameCalledAfterFirstScan);
+
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(getFileNameCalledAfterFirstScan, pProcfsAccess->getFileNameCalled);
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(processes[0].processId, static_cast<uint32_t>(pProcfsAccess->extraPid));
+    constexpr int64_t expectedEngines = ZES_ENGINE_TYPE_FLAG_DMA | ZES_ENGINE_TYPE_FLAG_COMPUTE;
+    EXPECT_EQ(processes[0].engines, expectedEngines);
+}
+
+TEST_F(SysmanGlobalOperationsFixtureXe, GivenProcessFdsCacheEnabledWhenProcessStartTimeChangesThenFileDescriptorLinksOfThatProcessAreResolvedAgain) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SysmanProcessFdsCacheLifetimeMs.set(60000);
+
+    pProcfsAccess->ourDevicePid = pProcfsAccess->extraPid;
+    pProcfsAccess->ourDeviceFd = pProcfsAccess->extraFd;
+    pProcfsAccess->mockListProcessCall.push_back(DEVICE_IN_USE);
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, 1u);
+    auto getFileNameCalledAfterFirstScan = pProcfsAccess->getFileNameCalled;
+
+    pProcfsAccess->mockStartTimes[pProcfsAccess->extraPid] = 100u;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, 1u);
+    auto extraPidFdsCount = static_cast<uint32_t>(pProcfsAccess->fdList.size()) + 1u;
+    EXPECT_EQ(getFileNameCalledAfterFirstScan + extraPidFdsCount, pProcfsAccess->getFileNameCalled);
+}
+
+TEST_F(SysmanGlobalOperationsFixtureXe, GivenProcessFdsCacheEnabledWhenProcessesOpenNewFilesThenOnlyNewFileDescriptorLinksAreResolved) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SysmanProcessFdsCacheLifetimeMs.set(60000);
+
+    pProcfsAccess->ourDevicePid = pProcfsAccess->extraPid;
+    pProcfsAccess->ourDeviceFd = pProcfsAccess->extraFd;
+    pProcfsAccess->mockListProcessCall.push_back(DEVICE_IN_USE);
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, 1u);
+    auto getFileNameCalledAfterFirstScan = pProcfsAccess->getFileNameCalled;
+
+    constexpr int newFd = 10;
+    pProcfsAccess->fdList.push_back(newFd);
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(processes[0].processId, static_cast<uint32_t>(pProcfsAccess->extraPid));
+    auto processesCount = static_cast<uint32_t>(pProcfsAccess->pidList.size()) + 1u;
+    EXPECT_EQ(getFileNameCalledAfterFirstScan + processesCount, pProcfsAccess->getFileNameCalled);
+}
+
 TEST_F(SysmanGlobalOperationsFixtureXe,
        GivenSrcVersionFileIsPresentWhenCallingZesDeviceGetPropertiesForCheckingDriverVersionThenZesDeviceGetPropertiesCallSucceedsAndDriverVersionIsReturned) {
     zes_device_properties_t properties = {ZES_STRUCTURE_TYPE_DEVICE_PROPERTIES};
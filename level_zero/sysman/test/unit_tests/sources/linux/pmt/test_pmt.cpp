@@ -5,12 +5,17 @@
  *
  */
 
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt_telemetry_snapshot.h"
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper_hw.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mocks/mock_sysman_product_helper.h"
 
 #include "mock_pmt.h"
 
+#include <array>
+#include <chrono>
+#include <thread>
+
 namespace L0 {
 namespace Sysman {
 namespace ult {
@@ -106,6 +111,64 @@ static ssize_t mockReadIncorrectGuid(int fd, void *buf, size_t count, off_t offs
 
 using ZesPmtFixture = SysmanDeviceFixture;
 
+struct FakeTelemFile {
+    static constexpr size_t size = 2048u;
+    static inline std::array<uint8_t, size> contents{};
+    static inline uint32_t openCalled = 0u;
+    static inline uint32_t preadCalled = 0u;
+    static inline uint32_t closeCalled = 0u;
+
+    static void reset() {
+        for (size_t i = 0; i < size; i++) {
+            contents[i] = static_cast<uint8_t>(i);
+        }
+        openCalled = 0u;
+        preadCalled = 0u;
+        closeCalled = 0u;
+    }
+    static int open(const char *pathname, int flags) {
+        openCalled++;
+        return std::string(pathname) == telem1TelemFileName ? 6 : -1;
+    }
+    static ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
+        preadCalled++;
+        if (fd != 6 || static_cast<size_t>(offset) > size) {
+            errno = EINVAL;
+            return -1;
+        }
+        count = std::min(count, size - static_cast<size_t>(offset));
+        memcpy(buf, contents.data() + offset, count);
+        return static_cast<ssize_t>(count);
+    }
+    static int close(int fd) {
+        closeCalled++;
+        return 0;
+    }
+};
+
+struct ZesPmtTelemetrySnapshotFixture : public ZesPmtFixture {
+    void SetUp() override {
+        ZesPmtFixture::SetUp();
+        FakeTelemFile::reset();
+        debugManager.flags.SysmanTelemetrySnapshotLifetimeUs.set(60 * 1000 * 1000);
+        mockOpen = std::make_unique<VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)>>(&NEO::SysCalls::sysCallsOpen, &FakeTelemFile::open);
+        mockPread = std::make_unique<VariableBackup<decltype(NEO::SysCalls::sysCallsPread)>>(&NEO::SysCalls::sysCallsPread, &FakeTelemFile::pread);
+        mockClose = std::make_unique<VariableBackup<decltype(NEO::SysCalls::sysCallsClose)>>(&NEO::SysCalls::sysCallsClose, &FakeTelemFile::close);
+    }
+    void TearDown() override {
+        pLinuxSysmanImp->getPmtTelemetrySnapshotCache().clear();
+        mockClose.reset();
+        mockPread.reset();
+        mockOpen.reset();
+        ZesPmtFixture::TearDown();
+    }
+
+    std::unique_ptr<VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)>> mockOpen;
+    std::unique_ptr<VariableBackup<decltype(NEO::SysCalls::sysCallsPread)>> mockPread;
+    std::unique_ptr<VariableBackup<decltype(NEO::SysCalls::sysCallsClose)>> mockClose;
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}, {"GPU_FREQUENCY", 512}};
+};
+
 HWTEST2_F(ZesPmtFixture, GivenTelemNodesAreNotAvailableWhenCallingIsTelemetrySupportAvailableThenFalseValueIsReturned, IsPVC) {
     auto pSysmanProductHelper = L0::Sysman::SysmanProductHelper::create(defaultHwInfo->platform.eProductFamily);
     std::swap(pLinuxSysmanImp->pSysmanProductHelper, pSysmanProductHelper);
@@ -189,7 +252,7 @@ TEST_F(ZesPmtFixture, GivenKeyDoesNotExistinKeyOffsetMapWhenCallingReadValueForU
     uint64_t mockOffset = 0;
     std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
     std::string mockKey = "ABCDE";
-    EXPECT_NE(PlatformMonitoringTech::readValue(keyOffsetMap, mockTelemDir, mockKey, mockOffset, value), ZE_RESULT_SUCCESS);
+    EXPECT_NE(PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, mockTelemDir, mockKey, mockOffset, value), ZE_RESULT_SUCCESS);
 }
 
 TEST_F(ZesPmtFixture, GivenKeyDoesNotExistinKeyOffsetMapWhenCallingReadValueForUnsignedLongThenFalseValueIsReturned) {
@@ -198,7 +261,103 @@ TEST_F(ZesPmtFixture, GivenKeyDoesNotExistinKeyOffsetMapWhenCallingReadValueForU
     uint64_t mockOffset = 0;
     std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
     std::string mockKey = "ABCDE";
-    EXPECT_NE(PlatformMonitoringTech::readValue(keyOffsetMap, mockTelemDir, mockKey, mockOffset, value), ZE_RESULT_SUCCESS);
+    EXPECT_NE(PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, mockTelemDir, mockKey, mockOffset, value), ZE_RESULT_SUCCESS);
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenTelemetrySnapshotEnabledWhenReadingManyKeysThenTelemFileIsOpenedAndReadOnce) {
+    uint64_t energy = 0;
+    uint32_t temperature = 0;
+    uint32_t frequency = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", 0, energy));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "GPU_FREQUENCY", 0, frequency));
+    }
+
+    uint64_t expectedEnergy = 0;
+    uint32_t expectedTemperature = 0;
+    uint32_t expectedFrequency = 0;
+    memcpy(&expectedEnergy, FakeTelemFile::contents.data() + 1032, sizeof(expectedEnergy));
+    memcpy(&expectedTemperature, FakeTelemFile::contents.data() + 56, sizeof(expectedTemperature));
+    memcpy(&expectedFrequency, FakeTelemFile::contents.data() + 512, sizeof(expectedFrequency));
+    EXPECT_EQ(expectedEnergy, energy);
+    EXPECT_EQ(expectedTemperature, temperature);
+    EXPECT_EQ(expectedFrequency, frequency);
+
+    EXPECT_EQ(1u, FakeTelemFile::openCalled);
+    EXPECT_EQ(1u, FakeTelemFile::preadCalled);
+    EXPECT_EQ(0u, FakeTelemFile::closeCalled);
+
+    pLinuxSysmanImp->getPmtTelemetrySnapshotCache().clear();
+    EXPECT_EQ(1u, FakeTelemFile::closeCalled);
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenTelemetrySnapshotOlderThanLifetimeWhenReadingKeyThenSnapshotIsRefreshedWithoutReopeningTelemFile) {
+    debugManager.flags.SysmanTelemetrySnapshotLifetimeUs.set(1);
+    uint32_t temperature = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+
+    FakeTelemFile::contents[56] = 0xab;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+    EXPECT_EQ(0xabu, temperature & 0xff);
+
+    EXPECT_EQ(1u, FakeTelemFile::openCalled);
+    EXPECT_EQ(2u, FakeTelemFile::preadCalled);
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenKeyBeyondEndOfTelemFileWhenReadingWithTelemetrySnapshotThenKeysWithinFileAreServedAndReadOfOtherKeyFails) {
+    keyOffsetMap["OUT_OF_RANGE"] = FakeTelemFile::size + 64;
+    uint32_t temperature = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+    EXPECT_EQ(56u, temperature & 0xff);
+
+    uint32_t outOfRange = 0;
+    EXPECT_NE(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "OUT_OF_RANGE", 0, outOfRange));
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenTelemetrySnapshotDisabledWhenReadingKeysThenEachReadOpensTelemFile) {
+    debugManager.flags.SysmanTelemetrySnapshotLifetimeUs.set(-1);
+    uint32_t temperature = 0;
+    uint32_t frequency = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "GPU_FREQUENCY", 0, frequency));
+
+    EXPECT_EQ(2u, FakeTelemFile::openCalled);
+    EXPECT_EQ(2u, FakeTelemFile::preadCalled);
+    EXPECT_EQ(2u, FakeTelemFile::closeCalled);
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenSnapshotCacheOfAnotherDeviceWhenItIsClearedThenSnapshotOfThisDeviceIsKept) {
+    uint32_t temperature = 0;
+    auto otherDeviceCache = std::make_unique<PmtTelemetrySnapshotCache>();
+    uint32_t otherTemperature = 0;
+    int errorNum = 0;
+    EXPECT_TRUE(otherDeviceCache->get(sysfsPathTelem1)->read(56, 64, 56, sizeof(otherTemperature), &otherTemperature, errorNum));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+    EXPECT_EQ(2u, FakeTelemFile::openCalled);
+
+    otherDeviceCache.reset();
+    EXPECT_EQ(1u, FakeTelemFile::closeCalled);
+
+    uint32_t frequency = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::readValue(pLinuxSysmanImp, keyOffsetMap, sysfsPathTelem1, "GPU_FREQUENCY", 0, frequency));
+    EXPECT_EQ(2u, FakeTelemFile::openCalled);
+    EXPECT_EQ(1u, FakeTelemFile::closeCalled);
+}
+
+TEST_F(ZesPmtTelemetrySnapshotFixture, GivenSnapshotInUseWhenSnapshotCacheIsClearedThenTelemFileIsClosedOnlyAfterLastUserReleasesIt) {
+    auto snapshot = pLinuxSysmanImp->getPmtTelemetrySnapshotCache().get(sysfsPathTelem1);
+    pLinuxSysmanImp->getPmtTelemetrySnapshotCache().clear();
+
+    uint32_t temperature = 0;
+    int errorNum = 0;
+    EXPECT_TRUE(snapshot->read(56, 64, 56, sizeof(temperature), &temperature, errorNum));
+    EXPECT_EQ(56u, temperature & 0xff);
+    EXPECT_EQ(0u, FakeTelemFile::closeCalled);
+
+    snapshot.reset();
+    EXPECT_EQ(1u, FakeTelemFile::closeCalled);
 }
 
 } // namespace ult
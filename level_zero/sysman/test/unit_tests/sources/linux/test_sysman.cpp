@@ -618,6 +618,53 @@ TEST_F(SysmanDeviceFixture, GivenInvalidPidWhenCallingProcfsAccessIsAliveThenErr
     EXPECT_FALSE(procfsAccess->isAlive(reinterpret_cast<::pid_t>(-1)));
 }
 
+TEST_F(SysmanDeviceFixture, GivenProcessNameWithSpacesAndParenthesesWhenCallingProcfsAccessGetProcessStartTimeThenStartTimeIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsClose)> mockClose(&NEO::SysCalls::sysCallsClose, [](int fileDescriptor) -> int {
+        return 0;
+    });
+    VariableBackup<decltype(NEO::SysCalls::readFuncCalled)> readCalledBackup{&NEO::SysCalls::readFuncCalled, 0u};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRead)> mockRead(&NEO::SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        if (++NEO::SysCalls::readFuncCalled == 1) {
+            constexpr std::string_view val = "1234 (my (app) 1) S 1 1234 1234 0 -1 4194560 100 0 0 0 5 3 0 0 20 0 1 0 98765 1000 200\n";
+            auto size = std::min(count, val.size());
+            memcpy(buf, val.data(), size);
+            return static_cast<ssize_t>(size);
+        }
+        return 0;
+    });
+
+    auto procfsAccess = &pLinuxSysmanImp->getProcfsAccess();
+    uint64_t startTime = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess->getProcessStartTime(1234, startTime));
+    EXPECT_EQ(98765u, startTime);
+}
+
+TEST_F(SysmanDeviceFixture, GivenMalformedStatFileWhenCallingProcfsAccessGetProcessStartTimeThenErrorIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsClose)> mockClose(&NEO::SysCalls::sysCallsClose, [](int fileDescriptor) -> int {
+        return 0;
+    });
+    VariableBackup<decltype(NEO::SysCalls::readFuncCalled)> readCalledBackup{&NEO::SysCalls::readFuncCalled, 0u};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRead)> mockRead(&NEO::SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        if (++NEO::SysCalls::readFuncCalled == 1) {
+            constexpr std::string_view val = "1234 (app) S 1 1234\n";
+            auto size = std::min(count, val.size());
+            memcpy(buf, val.data(), size);
+            return static_cast<ssize_t>(size);
+        }
+        return 0;
+    });
+
+    auto procfsAccess = &pLinuxSysmanImp->getProcfsAccess();
+    uint64_t startTime = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, procfsAccess->getProcessStartTime(1234, startTime));
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidPciPathWhileGettingCardBusPortThenReturnedPathIs1LevelUpThenTheCurrentPath) {
     const std::string mockBdf = "0000:00:02.0";
     const std::string mockRealPath = "/sys/devices/pci0000:00/0000:00:01.0/0000:01:00.0/0000:02:01.0/" + mockBdf;
@@ -7,6 +7,7 @@
 
 #include "os_metric_ip_sampling_imp_linux.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
@@ -22,12 +23,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 namespace L0 {
 
 MetricIpSamplingLinuxImp::MetricIpSamplingLinuxImp(Device &device) : device(device) {}
 
+MetricIpSamplingLinuxImp::~MetricIpSamplingLinuxImp() {
+    stopStreamReader();
+}
+
 ze_result_t MetricIpSamplingLinuxImp::startMeasurement(uint32_t &notifyEveryNReports, uint32_t &samplingPeriodNs) {
 
     const auto drm = device.getOsInterface()->getDriverModel()->as<NEO::Drm>();
@@ -59,6 +65,103 @@ ze_result_t MetricIpSamplingLinuxImp::startMeasurement(uint32_t &notifyEveryNRep
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
+    if (NEO::debugManager.flags.IpSamplingStreamingRingSizeKB.get() > 0) {
+        startStreamReader(notifyEveryNReports);
+    } else {
+        ringBuffer.reset();
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+void MetricIpSamplingLinuxImp::startStreamReader(uint32_t notifyEveryNReports) {
+    const size_t ringSize = static_cast<size_t>(NEO::debugManager.flags.IpSamplingStreamingRingSizeKB.get()) * MemoryConstants::kiloByte;
+    ringBuffer = std::make_unique<NEO::SpscRingBuffer>(std::max<size_t>(ringSize, getUnitReportSize()));
+    discardBuffer = std::make_unique<uint8_t[]>(discardBufferSize);
+    ringNotifyEveryNReports = std::max(notifyEveryNReports, 1u);
+    reportedDataLossCount = 0;
+    overflowCount = 0;
+    droppedReportsCount = 0;
+    streamReaderFailed = false;
+    stopReader = false;
+    streamReaderThread = std::thread(&MetricIpSamplingLinuxImp::streamReaderLoop, this);
+}
+
+void MetricIpSamplingLinuxImp::stopStreamReader() {
+    if (!streamReaderThread.joinable()) {
+        return;
+    }
+    stopReader = true;
+    streamReaderThread.join();
+    METRICS_LOG_INFO("EU stall streaming stopped, KMD overflows: %llu, reports dropped on full ring: %llu",
+                     static_cast<unsigned long long>(overflowCount.load()), static_cast<unsigned long long>(droppedReportsCount.load()));
+}
+
+void MetricIpSamplingLinuxImp::streamReaderLoop() {
+    while (!stopReader.load()) {
+        struct pollfd pollParams = {};
+        pollParams.fd = stream;
+        pollParams.events = POLLIN;
+        if (NEO::SysCalls::poll(&pollParams, 1, streamReaderPollTimeoutMs) <= 0) {
+            continue;
+        }
+
+        // KMD copies reports straight into the ring. When the ring is full, the stream is still drained
+        // to keep KMD buffer from overflowing, but the reports are discarded and accounted for.
+        uint8_t *span = nullptr;
+        size_t spanSize = ringBuffer->getWritableSpan(span);
+        spanSize -= spanSize % getUnitReportSize();
+        const bool discard = (spanSize == 0);
+        if (discard) {
+            span = discardBuffer.get();
+            spanSize = discardBufferSize;
+        }
+
+        ssize_t ret = NEO::SysCalls::read(stream, span, spanSize);
+        if (ret > 0) {
+            if (discard) {
+                droppedReportsCount += static_cast<uint64_t>(ret) / getUnitReportSize();
+            } else {
+                ringBuffer->commitWrite(static_cast<size_t>(ret));
+            }
+        } else if (ret < 0) {
+            if (errno == EIO) {
+                overflowCount++;
+            } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                METRICS_LOG_ERR("read() failed errno = %d | ret = %d", errno, ret);
+                streamReaderFailed = true;
+                return;
+            }
+        }
+    }
+}
+
+ze_result_t MetricIpSamplingLinuxImp::readDataFromRing(uint8_t *pRawData, size_t *pRawDataSize) {
+    // At most two contiguous spans (before and after ring wrap) are copied into the user buffer.
+    // Only whole reports are copied, a report split across two reads could not be decoded.
+    const size_t requestedSize = *pRawDataSize - (*pRawDataSize % getUnitReportSize());
+    size_t copiedSize = 0;
+    while (copiedSize < requestedSize) {
+        const uint8_t *span = nullptr;
+        const size_t spanSize = std::min(ringBuffer->getReadableSpan(span), requestedSize - copiedSize);
+        if (spanSize == 0) {
+            break;
+        }
+        memcpy(pRawData + copiedSize, span, spanSize);
+        ringBuffer->commitRead(spanSize);
+        copiedSize += spanSize;
+    }
+    *pRawDataSize = copiedSize;
+
+    if (copiedSize == 0 && streamReaderFailed.load()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    const uint64_t dataLossCount = overflowCount.load() + droppedReportsCount.load();
+    if (dataLossCount != reportedDataLossCount) {
+        reportedDataLossCount = dataLossCount;
+        METRICS_LOG_INFO("%s", "Some data was lost during EU stall streaming");
+        return ZE_RESULT_WARNING_DROPPED_DATA;
+    }
     return ZE_RESULT_SUCCESS;
 }
 
@@ -95,6 +198,7 @@ ze_result_t MetricIpSamplingLinuxImp::clampNReports(uint32_t &notifyEveryNReport
 ze_result_t MetricIpSamplingLinuxImp::stopMeasurement() {
     const auto drm = device.getOsInterface()->getDriverModel()->as<NEO::Drm>();
     auto ioctlHelper = drm->getIoctlHelper();
+    stopStreamReader();
     bool result = ioctlHelper->perfDisableEuStallStream(&stream);
 
     return result ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
@@ -102,6 +206,10 @@ ze_result_t MetricIpSamplingLinuxImp::stopMeasurement() {
 
 ze_result_t MetricIpSamplingLinuxImp::readData(uint8_t *pRawData, size_t *pRawDataSize) {
 
+    if (ringBuffer) {
+        return readDataFromRing(pRawData, pRawDataSize);
+    }
+
     ssize_t ret = NEO::SysCalls::read(stream, pRawData, *pRawDataSize);
     if (ret >= 0) {
         *pRawDataSize = ret;
@@ -137,6 +245,10 @@ uint32_t MetricIpSamplingLinuxImp::getUnitReportSize() {
 }
 
 bool MetricIpSamplingLinuxImp::isNReportsAvailable() {
+    if (ringBuffer) {
+        return ringBuffer->getUsedSize() >= static_cast<size_t>(ringNotifyEveryNReports) * getUnitReportSize();
+    }
+
     struct pollfd pollParams;
     memset(&pollParams, 0, sizeof(pollParams));
 
@@ -6,14 +6,19 @@
  */
 
 #pragma once
+#include "shared/source/utilities/spsc_ring_buffer.h"
+
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 
+#include <atomic>
+#include <thread>
+
 namespace L0 {
 
 class MetricIpSamplingLinuxImp : public MetricIpSamplingOsInterface {
   public:
     MetricIpSamplingLinuxImp(Device &device);
-    ~MetricIpSamplingLinuxImp() override = default;
+    ~MetricIpSamplingLinuxImp() override;
     ze_result_t startMeasurement(uint32_t &notifyEveryNReports, uint32_t &samplingPeriodNs) override;
     ze_result_t stopMeasurement() override;
     ze_result_t readData(uint8_t *pRawData, size_t *pRawDataSize) override;
@@ -23,6 +28,27 @@ class MetricIpSamplingLinuxImp : public MetricIpSamplingOsInterface {
     bool isNReportsAvailable() override;
     bool isOsSupportAvailable() override;
     ze_result_t getMetricsTimerResolution(uint64_t &timerResolution) override;
+    uint64_t getOverflowCount() override { return overflowCount.load(); }
+    uint64_t getDroppedReportsCount() override { return droppedReportsCount.load(); }
+
+  protected:
+    // Streaming mode: a background thread drains the KMD stream into a ring, readData() is served from the ring.
+    void startStreamReader(uint32_t notifyEveryNReports);
+    void stopStreamReader();
+    void streamReaderLoop();
+    ze_result_t readDataFromRing(uint8_t *pRawData, size_t *pRawDataSize);
+
+    std::unique_ptr<NEO::SpscRingBuffer> ringBuffer;
+    std::unique_ptr<uint8_t[]> discardBuffer;
+    std::thread streamReaderThread;
+    std::atomic<bool> stopReader{false};
+    std::atomic<bool> streamReaderFailed{false};
+    std::atomic<uint64_t> overflowCount{0};
+    std::atomic<uint64_t> droppedReportsCount{0};
+    uint64_t reportedDataLossCount = 0;
+    uint32_t ringNotifyEveryNReports = 1;
+    static constexpr size_t discardBufferSize = 64 * MemoryConstants::kiloByte;
+    static constexpr int streamReaderPollTimeoutMs = 10;
 
   private:
     int32_t stream = -1;
@@ -7,9 +7,11 @@
 
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
@@ -21,7 +23,9 @@
 #include "level_zero/zet_intel_gpu_metric_export.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 namespace L0 {
 constexpr uint32_t ipSamplinDomainId = 100u;
@@ -755,6 +759,13 @@ ze_result_t IpSamplingCalculation::updateStallDataMapFromData(const size_t rawDa
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
+    const size_t recordCount = rawDataSize / rawReportSize;
+    const uint32_t maxThreads = getCalculationThreads();
+    if (maxThreads > 1u && recordCount > calculationChunkRecordCount) {
+        *dataOverflow |= updateStallDataMapFromDataParallel(recordCount, pRawData, stallReportDataMap, maxThreads);
+        return ZE_RESULT_SUCCESS;
+    }
+
     size_t processedSize = 0;
     const uint8_t *dataToProcess = pRawData;
 
@@ -767,6 +778,38 @@ ze_result_t IpSamplingCalculation::updateStallDataMapFromData(const size_t rawDa
     return ZE_RESULT_SUCCESS;
 }
 
+uint32_t IpSamplingCalculation::getCalculationThreads() {
+    auto maxThreads = NEO::debugManager.flags.IpSamplingCalculationThreads.get();
+    return maxThreads > 1 ? static_cast<uint32_t>(maxThreads) : 1u;
+}
+
+bool IpSamplingCalculation::updateStallDataMapFromDataParallel(const size_t recordCount, const uint8_t *pRawData,
+                                                               std::map<uint64_t, void *> &stallReportDataMap, uint32_t maxThreads) {
+    // Every chunk is decoded into its own map. Chunk maps are merged in raw data order afterwards,
+    // so the result does not depend on thread scheduling.
+    const size_t chunkCount = (recordCount + calculationChunkRecordCount - 1) / calculationChunkRecordCount;
+    std::vector<std::map<uint64_t, void *>> chunkDataMaps(chunkCount);
+    std::vector<uint8_t> chunkDataOverflows(chunkCount, 0u);
+
+    NEO::parallelFor(chunkCount, maxThreads, 1u, [&](size_t chunk) {
+        const size_t firstRecord = chunk * calculationChunkRecordCount;
+        const size_t lastRecord = std::min(firstRecord + calculationChunkRecordCount, recordCount);
+        bool chunkDataOverflow = false;
+        for (size_t record = firstRecord; record < lastRecord; record++) {
+            chunkDataOverflow |= gfxCoreHelper.stallIpDataMapUpdateFromData(pRawData + record * rawReportSize, chunkDataMaps[chunk]);
+        }
+        chunkDataOverflows[chunk] = chunkDataOverflow;
+    });
+
+    bool dataOverflow = false;
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        gfxCoreHelper.stallIpDataMapUpdateFromMap(chunkDataMaps[chunk], stallReportDataMap);
+        gfxCoreHelper.stallIpDataMapDeleteSumData(chunkDataMaps[chunk]);
+        dataOverflow |= (chunkDataOverflows[chunk] != 0u);
+    }
+    return dataOverflow;
+}
+
 void IpSamplingCalculation::multiDataMapToMetricResults(std::map<uint32_t, std::map<uint64_t, void *> *> &perScopeIpDataCaches,
                                                         uint32_t metricReportCount,
                                                         std::vector<uint32_t> includedMetricIndexes,
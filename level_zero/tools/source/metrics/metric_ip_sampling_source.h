@@ -194,6 +194,8 @@ struct IpSamplingCalculation {
     ~IpSamplingCalculation() = default;
 
     static constexpr uint32_t rawReportSize = 64u;
+    // Raw data spanning multiple chunks may be decoded on multiple threads, see IpSamplingCalculationThreads.
+    size_t calculationChunkRecordCount = 16384u;
 
     static bool isMultiDeviceCaptureData(const size_t rawDataSize, const uint8_t *pRawData);
     ze_result_t getIpsInRawData(const size_t rawDataSize, const uint8_t *pRawData,
@@ -232,6 +234,10 @@ struct IpSamplingCalculation {
                                    zet_typed_value_t *pTypedValues);
 
   protected:
+    static uint32_t getCalculationThreads();
+    bool updateStallDataMapFromDataParallel(const size_t recordCount, const uint8_t *pRawData,
+                                            std::map<uint64_t, void *> &stallReportDataMap, uint32_t maxThreads);
+
     L0::L0GfxCoreHelper &gfxCoreHelper;
     IpSamplingMetricSourceImp &metricSource;
 };
@@ -37,6 +37,10 @@ class MetricIpSamplingOsInterface : public MetricOsInterface {
     virtual uint32_t getUnitReportSize() = 0;
     virtual bool isNReportsAvailable() = 0;
     virtual bool isOsSupportAvailable() = 0;
+    // Data loss since measurement start: number of overflows reported by KMD stream and
+    // number of reports discarded because the streaming ring was full.
+    virtual uint64_t getOverflowCount() { return 0; }
+    virtual uint64_t getDroppedReportsCount() { return 0; }
     static std::unique_ptr<MetricIpSamplingOsInterface> create(Device &device);
 
     uint32_t maxDssBufferSize = 512 * MemoryConstants::kiloByte;
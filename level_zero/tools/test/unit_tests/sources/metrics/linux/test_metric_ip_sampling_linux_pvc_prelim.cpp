@@ -11,6 +11,7 @@
 #include "shared/source/os_interface/linux/ioctl_helper.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/xe_hpc_core/pvc/device_ids_configs_pvc.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/libult/linux/drm_mock.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
@@ -23,6 +24,10 @@
 #include "level_zero/tools/source/metrics/linux/os_metric_ip_sampling_imp_linux.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace NEO {
 namespace SysCalls {
 extern int closeFuncRetVal;
@@ -311,6 +316,166 @@ HWTEST2_F(MetricIpSamplingLinuxTestPrelim, GivenPollIsFailureWhenisNReportsAvail
     EXPECT_FALSE(metricIpSamplingOsInterface->isNReportsAvailable());
 }
 
+static std::atomic<uint32_t> streamReadCalls{0u};
+
+template <typename ConditionT>
+static bool waitForStreamReader(ConditionT condition) {
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > timeout) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+HWTEST2_F(MetricIpSamplingLinuxTestPrelim, givenStreamingRingEnabledWhenReportsAreStreamedThenReadDataReturnsThemInOrder, IsPVC) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingStreamingRingSizeKB.set(64);
+    streamReadCalls = 0u;
+
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsRead)> mockRead(&SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        auto call = streamReadCalls++;
+        if (call < 4u) {
+            constexpr size_t reportsSize = 2 * 64u;
+            memset(buf, static_cast<int>(call + 1), reportsSize);
+            return static_cast<ssize_t>(reportsSize);
+        }
+        errno = EAGAIN;
+        return -1;
+    });
+
+    uint32_t notifyEveryNReports = 4u, samplingPeriodNs = 10000;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->startMeasurement(notifyEveryNReports, samplingPeriodNs));
+    EXPECT_TRUE(waitForStreamReader([&]() { return metricIpSamplingOsInterface->isNReportsAvailable(); }));
+
+    std::vector<uint8_t> rawData(8 * 64u);
+    size_t totalSize = 0;
+    EXPECT_TRUE(waitForStreamReader([&]() {
+        size_t rawDataSize = rawData.size() - totalSize;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data() + totalSize, &rawDataSize));
+        totalSize += rawDataSize;
+        return totalSize == rawData.size();
+    }));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->stopMeasurement());
+
+    for (size_t i = 0; i < rawData.size(); i++) {
+        EXPECT_EQ(static_cast<uint8_t>(i / (2 * 64u) + 1), rawData[i]);
+    }
+    EXPECT_EQ(0u, metricIpSamplingOsInterface->getOverflowCount());
+    EXPECT_EQ(0u, metricIpSamplingOsInterface->getDroppedReportsCount());
+}
+
+HWTEST2_F(MetricIpSamplingLinuxTestPrelim, givenStreamingRingEnabledWhenReadDataIsCalledWithBufferNotMultipleOfReportSizeThenOnlyWholeReportsAreReturned, IsPVC) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingStreamingRingSizeKB.set(64);
+    streamReadCalls = 0u;
+
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsRead)> mockRead(&SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        if (streamReadCalls++ == 0u) {
+            constexpr size_t reportsSize = 4 * 64u;
+            for (size_t i = 0; i < reportsSize; i++) {
+                static_cast<uint8_t *>(buf)[i] = static_cast<uint8_t>(i / 64u + 1);
+            }
+            return static_cast<ssize_t>(reportsSize);
+        }
+        errno = EAGAIN;
+        return -1;
+    });
+
+    uint32_t notifyEveryNReports = 4u, samplingPeriodNs = 10000;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->startMeasurement(notifyEveryNReports, samplingPeriodNs));
+    EXPECT_TRUE(waitForStreamReader([&]() { return metricIpSamplingOsInterface->isNReportsAvailable(); }));
+
+    std::vector<uint8_t> rawData(4 * 64u);
+    size_t rawDataSize = 64u + 17u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data(), &rawDataSize));
+    EXPECT_EQ(64u, rawDataSize);
+
+    size_t secondReadSize = 3 * 64u - 1u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data() + rawDataSize, &secondReadSize));
+    EXPECT_EQ(2 * 64u, secondReadSize);
+    rawDataSize += secondReadSize;
+
+    size_t smallReadSize = 63u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data() + rawDataSize, &smallReadSize));
+    EXPECT_EQ(0u, smallReadSize);
+
+    size_t lastReadSize = 64u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data() + rawDataSize, &lastReadSize));
+    EXPECT_EQ(64u, lastReadSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->stopMeasurement());
+
+    for (size_t i = 0; i < rawData.size(); i++) {
+        EXPECT_EQ(static_cast<uint8_t>(i / 64u + 1), rawData[i]);
+    }
+}
+
+HWTEST2_F(MetricIpSamplingLinuxTestPrelim, givenStreamingRingFullOrKmdOverflowWhenReadDataIsCalledThenDroppedDataWarningIsReturnedOnce, IsPVC) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingStreamingRingSizeKB.set(1);
+    streamReadCalls = 0u;
+
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsRead)> mockRead(&SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        auto call = streamReadCalls++;
+        if (call < 2u) {
+            // First read fills the whole ring, second one has to be discarded.
+            constexpr size_t readSize = MemoryConstants::kiloByte;
+            memset(buf, 0, readSize);
+            return static_cast<ssize_t>(readSize);
+        }
+        errno = (call == 2u) ? EIO : EAGAIN;
+        return -1;
+    });
+
+    uint32_t notifyEveryNReports = 0u, samplingPeriodNs = 10000;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->startMeasurement(notifyEveryNReports, samplingPeriodNs));
+    EXPECT_TRUE(waitForStreamReader([&]() { return metricIpSamplingOsInterface->getOverflowCount() == 1u; }));
+    EXPECT_EQ(MemoryConstants::kiloByte / 64u, metricIpSamplingOsInterface->getDroppedReportsCount());
+
+    std::vector<uint8_t> rawData(2 * MemoryConstants::kiloByte);
+    size_t rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_WARNING_DROPPED_DATA, metricIpSamplingOsInterface->readData(rawData.data(), &rawDataSize));
+    EXPECT_EQ(MemoryConstants::kiloByte, rawDataSize);
+
+    rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->readData(rawData.data(), &rawDataSize));
+    EXPECT_EQ(0u, rawDataSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->stopMeasurement());
+}
+
+HWTEST2_F(MetricIpSamplingLinuxTestPrelim, givenStreamReaderFailsWhenRingIsEmptyThenReadDataReturnsFailure, IsPVC) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingStreamingRingSizeKB.set(64);
+
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsRead)> mockRead(&SysCalls::sysCallsRead, [](int fd, void *buf, size_t count) -> ssize_t {
+        errno = EBADF;
+        return -1;
+    });
+
+    uint32_t notifyEveryNReports = 0u, samplingPeriodNs = 10000;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->startMeasurement(notifyEveryNReports, samplingPeriodNs));
+    uint8_t rawData[64] = {};
+    EXPECT_TRUE(waitForStreamReader([&]() {
+        size_t rawDataSize = sizeof(rawData);
+        return metricIpSamplingOsInterface->readData(rawData, &rawDataSize) == ZE_RESULT_ERROR_UNKNOWN;
+    }));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricIpSamplingOsInterface->stopMeasurement());
+}
+
 struct MetricIpSamplingLinuxMultiDeviceTest : public ::testing::Test {
 
     std::unique_ptr<UltDeviceFactory> createDevices(uint32_t numSubDevices) {
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/xe_hpc_core/hw_cmds_pvc.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -806,6 +807,42 @@ HWTEST2_F(MetricIpSamplingCalculateMetricGroupTest, GivenSubDeviceDataWhenCalcul
     }
 }
 
+HWTEST2_F(MetricIpSamplingCalculateMetricGroupTest, GivenMultipleCalculationThreadsWhenCalculateMetricValuesIsCalledThenResultsMatchSerialCalculation, HasIPSamplingSupport) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingCalculationThreads.set(4);
+
+    for (auto device : rootOneSubDev) {
+        ze_device_properties_t props = {};
+        device->getProperties(&props);
+        if (!(props.flags & ZE_DEVICE_PROPERTY_FLAG_SUBDEVICE)) {
+            continue;
+        }
+
+        zet_metric_group_handle_t hMetricGroup = MetricIpSamplingMultiDevFixture::getMetricGroupForDevice(device);
+        auto &metricSource = (static_cast<Device *>(device))->getMetricDeviceContext().getMetricSource<IpSamplingMetricSourceImp>();
+        // Every raw report becomes its own chunk, so chunk maps have to be merged.
+        metricSource.ipSamplingCalculation->calculationChunkRecordCount = 1u;
+
+        zet_metric_group_properties_t metricGroupProperties = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES, nullptr};
+        EXPECT_EQ(zetMetricGroupGetProperties(hMetricGroup, &metricGroupProperties), ZE_RESULT_SUCCESS);
+        uint32_t expectedResultCount = metricGroupProperties.metricCount * IpSamplingTestProductHelper::numberOfIpsInRawData;
+        uint32_t metricValueCount = expectedResultCount;
+        std::vector<zet_typed_value_t> metricValues(expectedResultCount);
+        EXPECT_EQ(zetMetricGroupCalculateMetricValues(hMetricGroup, ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                      rawReportsBytesSize, reinterpret_cast<uint8_t *>(rawReports.data()), &metricValueCount, metricValues.data()),
+                  ZE_RESULT_SUCCESS);
+        EXPECT_EQ(metricValueCount, expectedResultCount);
+
+        std::vector<uint64_t> expectedMetricCalculateValues = {};
+        ipSamplingTestProductHelper->getExpectedCalculateResults(productFamily, IpSamplingTestProductHelper::CalculationResultType::CompleteResults, expectedMetricCalculateValues);
+
+        for (uint32_t i = 0; i < metricValueCount; i++) {
+            EXPECT_EQ(metricValues[i].type, ZET_VALUE_TYPE_UINT64);
+            EXPECT_EQ(metricValues[i].value.ui64, expectedMetricCalculateValues[i]);
+        }
+    }
+}
+
 HWTEST2_F(MetricIpSamplingCalculateMetricGroupTest, GivenRootDeviceDataWhenCalculateMetricValuesIsCalledThenReturnError, HasIPSamplingSupport) {
 
     for (auto device : rootOneSubDev) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -36,6 +38,32 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+namespace {
+// Events waiting on a copy engine as well complete out of order with the gpgpu task count, they stay polled.
+bool isTrackedByTaskCount(Event &event) {
+    auto executionStatus = event.peekExecutionStatus();
+    return (event.getCommandQueue() != nullptr) &&
+           !event.isExternallySynchronized() &&
+           !event.isBcsEvent() &&
+           (executionStatus > CL_COMPLETE) && (executionStatus < CL_QUEUED) &&
+           (event.peekTaskCount() < CompletionStamp::notReady);
+}
+} // namespace
+
+bool AsyncEventsHandler::isHigherTaskCount(const TaskCountHeapEntry &lhs, const TaskCountHeapEntry &rhs) {
+    return lhs.taskCount > rhs.taskCount;
+}
+
+void AsyncEventsHandler::pushToTaskCountHeap(Event *event) {
+    auto &heap = taskCountHeaps[&event->getCommandQueue()->getGpgpuCommandStreamReceiver()];
+    heap.push_back({event->peekTaskCount(), event});
+    std::push_heap(heap.begin(), heap.end(), isHigherTaskCount);
+}
+
+bool AsyncEventsHandler::hasPendingEvents() const {
+    return !list.empty() || !taskCountHeaps.empty();
+}
+
 Event *AsyncEventsHandler::processList() {
     TaskCountType lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
@@ -44,6 +72,10 @@ Event *AsyncEventsHandler::processList() {
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+            if (isTrackedByTaskCount(*event)) {
+                pushToTaskCountHeap(event);
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -55,6 +87,32 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+
+    for (auto heapIt = taskCountHeaps.begin(); heapIt != taskCountHeaps.end();) {
+        auto &heap = heapIt->second;
+        // Task counts on a CSR complete in order, so events below the first not completed one are not visited.
+        while (!heap.empty()) {
+            auto event = heap.front().event;
+            event->updateExecutionStatus();
+            if (event->peekHasCallbacks()) {
+                break;
+            }
+            std::pop_heap(heap.begin(), heap.end(), isHigherTaskCount);
+            heap.pop_back();
+            event->decRefInternal();
+        }
+
+        if (heap.empty()) {
+            heapIt = taskCountHeaps.erase(heapIt);
+            continue;
+        }
+        if (heap.front().taskCount < lowestTaskCount) {
+            sleepCandidate = heap.front().event;
+            lowestTaskCount = heap.front().taskCount;
+        }
+        ++heapIt;
+    }
+
     return sleepCandidate;
 }
 
@@ -72,7 +130,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasPendingEvents()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -118,6 +176,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &heap : taskCountHeaps) {
+        for (auto &entry : heap.second) {
+            entry.event->decRefInternal();
+        }
+    }
+    taskCountHeaps.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
@@ -1,18 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,14 +28,26 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    struct TaskCountHeapEntry {
+        TaskCountType taskCount;
+        Event *event;
+    };
+    using TaskCountHeap = std::vector<TaskCountHeapEntry>;
+
+    static bool isHigherTaskCount(const TaskCountHeapEntry &lhs, const TaskCountHeapEntry &rhs);
     Event *processList();
+    void pushToTaskCountHeap(Event *event);
+    bool hasPendingEvents() const;
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
     std::vector<Event *> registerList;
+    // Events polled on every pass: blocked, not yet submitted or externally synchronized.
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    // Submitted events, min-heap on awaited task count per CSR. Only the top of each heap is checked on a pass.
+    std::unordered_map<const CommandStreamReceiver *, TaskCountHeap> taskCountHeaps;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,25 @@ void CpuPageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
     UNRECOVERABLE_IF(allocData == nullptr);
 }
+void CpuPageFaultManager::transferChunkToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    transferToCpu(ptrOffset(ptr, offset), size, cmdQ);
+}
+void CpuPageFaultManager::transferChunkToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    commandQueue->getDevice().stopDirectSubmissionForCopyEngine();
+
+    // chunks are mapped one by one in transferChunkToCpu, unmap them with the same granularity so no map operation is left behind
+    auto &pageFaultData = memoryData[ptr];
+    const auto chunkSize = pageFaultData.chunkSize > 0u ? pageFaultData.chunkSize : size;
+    for (auto chunkOffset = offset; chunkOffset < offset + size; chunkOffset += chunkSize) {
+        auto chunkPtr = ptrOffset(ptr, chunkOffset);
+        pageFaultData.unifiedMemoryManager->insertSvmMapOperation(chunkPtr, std::min(chunkSize, offset + size - chunkOffset), ptr, chunkOffset, false);
+        auto retVal = commandQueue->enqueueSVMUnmap(chunkPtr, 0, nullptr, nullptr, false);
+        UNRECOVERABLE_IF(retVal);
+    }
+    auto retVal = commandQueue->finish(false);
+    UNRECOVERABLE_IF(retVal);
+}
 void CpuPageFaultManager::allowCPUMemoryEviction(bool evict, void *ptr, PageFaultData &pageFaultData) {
     auto commandQueue = static_cast<CommandQueue *>(pageFaultData.cmdQ);
 
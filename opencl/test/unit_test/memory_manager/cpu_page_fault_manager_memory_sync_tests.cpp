@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
@@ -107,6 +108,39 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     cmdQ->device = nullptr;
 }
 
+TEST_F(PageFaultManagerTest, givenChunkedUnifiedMemoryAllocWhenNeighbouringChunksAreTransferredToGpuThenEachChunkIsUnmappedSeparately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    MockExecutionEnvironment executionEnvironment;
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get());
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(3 * chunkSize, {}, rootDeviceIndices, deviceBitfields);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    cmdQ->device = device.get();
+    pageFaultManager->insertAllocation(alloc, 3 * chunkSize, svmAllocsManager.get(), cmdQ.get(), {});
+    ASSERT_EQ(chunkSize, pageFaultManager->memoryData.at(alloc).chunkSize);
+
+    pageFaultManager->baseChunkGpuTransfer(alloc, chunkSize, 2 * chunkSize, cmdQ.get());
+    EXPECT_EQ(2, cmdQ->transferToGpuCalled);
+    EXPECT_EQ(1, cmdQ->finishCalled);
+
+    for (auto chunkOffset : {chunkSize, 2 * chunkSize}) {
+        auto mapOperation = svmAllocsManager->getSvmMapOperation(ptrOffset(alloc, chunkOffset));
+        ASSERT_NE(nullptr, mapOperation);
+        EXPECT_EQ(chunkOffset, mapOperation->offset);
+        EXPECT_EQ(chunkSize, mapOperation->regionSize);
+    }
+
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenAllowCPUMemoryEvictionIsCalledThenSelectCorrectCsrWithOsContextForEviction) {
     MockExecutionEnvironment executionEnvironment;
 
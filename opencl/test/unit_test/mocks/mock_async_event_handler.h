@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
     using AsyncEventsHandler::openThread;
+    using AsyncEventsHandler::taskCountHeaps;
     using AsyncEventsHandler::thread;
 
     ~MockHandler() override {
@@ -61,7 +62,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && taskCountHeaps.empty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -42,6 +42,11 @@ class AsyncEventsHandlerTests : public ::testing::Test {
             this->updateTaskCount(taskCount, 0);
         }
 
+        void updateExecutionStatus() override {
+            updateExecutionStatusCalled++;
+            Event::updateExecutionStatus();
+        }
+
         WaitStatus wait(bool blocking, bool quickKmdSleep) override {
             waitCalled++;
             handler->allowAsyncProcess.store(false);
@@ -49,6 +54,7 @@ class AsyncEventsHandlerTests : public ::testing::Test {
         }
 
         uint32_t waitCalled = 0u;
+        uint32_t updateExecutionStatusCalled = 0u;
         WaitStatus waitResult = WaitStatus::ready;
         std::unique_ptr<MockHandler> handler;
     };
@@ -351,6 +357,76 @@ TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontR
     event2->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenProcessedThenOnlyEventsUpToFirstNotCompletedTaskCountAreChecked) {
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+    const TaskCountType taskCountBase = commandQueue->getHeaplessModeEnabled() ? 1 : 0;
+
+    event1->setTaskStamp(0, taskCountBase + 1);
+    event2->setTaskStamp(0, taskCountBase + 2);
+    event3->setTaskStamp(0, taskCountBase + 3);
+
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event3.get());
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    handler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    EXPECT_EQ(1u, handler->taskCountHeaps.size());
+
+    auto event2UpdatesBefore = event2->updateExecutionStatusCalled;
+    auto event3UpdatesBefore = event3->updateExecutionStatusCalled;
+    EXPECT_EQ(event1.get(), handler->process());
+    EXPECT_EQ(event2UpdatesBefore, event2->updateExecutionStatusCalled);
+    EXPECT_EQ(event3UpdatesBefore, event3->updateExecutionStatusCalled);
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = static_cast<TagAddressType>(taskCountBase + 2);
+    EXPECT_EQ(event3.get(), handler->process());
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(0, event3Counter);
+    EXPECT_EQ(1, event1->getRefInternalCount());
+    EXPECT_EQ(1, event2->getRefInternalCount());
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = static_cast<TagAddressType>(taskCountBase + 3);
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenBlockedEventWithCallbackWhenProcessedThenItIsNotTrackedByTaskCount) {
+    event1->setTaskStamp(CompletionStamp::notReady, 0);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+
+    handler->process();
+    EXPECT_TRUE(handler->taskCountHeaps.empty());
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    event1->setStatus(CL_COMPLETE);
+    handler->process();
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedBcsEventWithCallbackWhenProcessedThenItIsNotTrackedByTaskCount) {
+    const TaskCountType taskCountBase = commandQueue->getHeaplessModeEnabled() ? 1 : 0;
+    event1->setupBcs(aub_stream::EngineType::ENGINE_BCS);
+    event1->updateTaskCount(taskCountBase + 1, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    EXPECT_TRUE(handler->taskCountHeaps.empty());
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    event1->setStatus(CL_COMPLETE);
+    handler->process();
+    EXPECT_EQ(1, counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
 TEST_F(AsyncEventsHandlerTests, givenNoGpuHangAndSleepCandidateWhenProcessedThenCallWaitWithQuickKmdSleepRequest) {
     event1->setTaskStamp(0, commandQueue->getHeaplessModeEnabled() ? 2 : 1);
     event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
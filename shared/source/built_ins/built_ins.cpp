@@ -7,6 +7,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 
+#include "shared/source/built_ins/built_ins_binary_cache.h"
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
@@ -21,9 +22,47 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <string>
+#include <vector>
+
 namespace NEO {
 
+namespace {
+// sip cache entry: binary size, binary, state save area header
+std::string getSipCacheEntryName(SipKernelType type) {
+    return "sip_" + std::to_string(static_cast<uint32_t>(type));
+}
+
+bool loadCachedSipBinary(BuiltIn::BinaryCache &cache, const std::string &entryName, std::vector<char> &sipBinary, std::vector<char> &stateSaveAreaHeader) {
+    auto entry = cache.load(entryName);
+    uint64_t binarySize = 0u;
+    if (entry.size <= sizeof(binarySize)) {
+        return false;
+    }
+    memcpy_s(&binarySize, sizeof(binarySize), entry.data, sizeof(binarySize));
+    if (binarySize == 0u || binarySize > entry.size - sizeof(binarySize)) {
+        return false;
+    }
+
+    auto binaryBegin = entry.data + sizeof(binarySize);
+    auto binaryEnd = binaryBegin + binarySize;
+    sipBinary.assign(binaryBegin, binaryEnd);
+    stateSaveAreaHeader.assign(binaryEnd, entry.data + entry.size);
+    return true;
+}
+
+void cacheSipBinary(BuiltIn::BinaryCache &cache, const std::string &entryName, const std::vector<char> &sipBinary, const std::vector<char> &stateSaveAreaHeader) {
+    const uint64_t binarySize = sipBinary.size();
+    std::vector<char> entry(sizeof(binarySize) + sipBinary.size() + stateSaveAreaHeader.size());
+    memcpy_s(entry.data(), entry.size(), &binarySize, sizeof(binarySize));
+    std::copy(sipBinary.begin(), sipBinary.end(), entry.begin() + sizeof(binarySize));
+    std::copy(stateSaveAreaHeader.begin(), stateSaveAreaHeader.end(), entry.begin() + sizeof(binarySize) + sipBinary.size());
+    cache.store(entryName, entry);
+}
+} // namespace
+
 BuiltIns::BuiltIns() {
     builtinsLib.reset(new BuiltIn::ResourceLoader());
 }
@@ -38,13 +77,25 @@ const SipKernel &BuiltIns::getSipKernel(SipKernelType type, Device &device) {
     auto initializer = [&] {
         std::vector<char> sipBinary;
         std::vector<char> stateSaveAreaHeader;
-        auto compilerInterface = device.getCompilerInterface();
-        UNRECOVERABLE_IF(compilerInterface == nullptr);
+        auto binaryCache = getBuiltinsLib().getBinaryCache(device);
+        std::string binaryCacheEntryName;
+        if (binaryCache) {
+            binaryCacheEntryName = getBuiltinsLib().getBinaryCacheEntryName(getSipCacheEntryName(type), device, {}, {});
+        }
+        const bool useBinaryCache = !binaryCacheEntryName.empty();
+        if (!useBinaryCache || !loadCachedSipBinary(*binaryCache, binaryCacheEntryName, sipBinary, stateSaveAreaHeader)) {
+            auto compilerInterface = device.getCompilerInterface();
+            UNRECOVERABLE_IF(compilerInterface == nullptr);
 
-        auto ret = compilerInterface->getSipKernelBinary(device, type, sipBinary, stateSaveAreaHeader);
+            auto ret = compilerInterface->getSipKernelBinary(device, type, sipBinary, stateSaveAreaHeader);
 
-        UNRECOVERABLE_IF(ret != TranslationErrorCode::success);
-        UNRECOVERABLE_IF(sipBinary.size() == 0);
+            UNRECOVERABLE_IF(ret != TranslationErrorCode::success);
+            UNRECOVERABLE_IF(sipBinary.size() == 0);
+
+            if (useBinaryCache) {
+                cacheSipBinary(*binaryCache, binaryCacheEntryName, sipBinary, stateSaveAreaHeader);
+            }
+        }
 
         if (NEO::debugManager.flags.DumpSipHeaderFile.get() != "unk") {
             std::string name = NEO::debugManager.flags.DumpSipHeaderFile.get() + "_header.bin";
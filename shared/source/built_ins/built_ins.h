@@ -11,6 +11,7 @@
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/mem_lifetime.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -218,18 +219,34 @@ class EmbeddedStorage : public Storage {
     Resource loadImpl(const std::string &fullResourceName) override;
 };
 
+class BinaryCache;
+
 class ResourceLoader {
   public:
     ResourceLoader();
+    MOCKABLE_VIRTUAL ~ResourceLoader();
     Code getBuiltinCode(BaseKernel kernel, const AddressingMode &mode, CodeType requestedCodeType, Device &device);
 
+    // device binaries of built-ins compiled in previous processes, see EnablePersistentBuiltInsCache;
+    // apiOptions and internalOptions have to be the options the built-in is compiled with
+    Code getCachedBuiltinBinary(BaseKernel kernel, const AddressingMode &mode, Device &device, ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions);
+    void cacheBuiltinBinary(BaseKernel kernel, const AddressingMode &mode, Device &device, ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions, ArrayRef<const char> binary);
+    // one cache per device IP version, so entries are validated against the IP they were built for
+    BinaryCache *getBinaryCache(const Device &device);
+    // empty when the compiler identity is not known, such entries must not be cached
+    std::string getBinaryCacheEntryName(const std::string &name, Device &device, ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions);
+
   protected:
     Resource getBuiltinResource(BaseKernel kernel, const AddressingMode &mode, CodeType requestedCodeType, Device &device);
+    MOCKABLE_VIRTUAL std::unique_ptr<BinaryCache> createBinaryCache(const Device &device);
 
     using StoragesContainerT = std::vector<std::unique_ptr<Storage>>;
     StoragesContainerT allStorages; // sorted by priority allStorages[0] will be checked before allStorages[1], etc.
 
     std::mutex mutex;
+
+    std::mutex binaryCachesMutex;
+    std::unordered_map<uint32_t, std::unique_ptr<BinaryCache>> binaryCaches;
 };
 
 } // namespace BuiltIn
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/built_ins_binary_cache.h"
+
+#include "shared/source/helpers/casts.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/neo_driver_version.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+namespace NEO {
+
+std::string BuiltIn::BinaryCache::getEntryName(const std::string &name, uint64_t compilerIdentityHash, const HardwareInfo &hwInfo,
+                                               ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions) {
+    Hash hash;
+    hash.update("----", 4);
+    hash.update(safePodCast<const char *>(&compilerIdentityHash), sizeof(compilerIdentityHash));
+    hash.update("----", 4);
+    hash.update(apiOptions.begin(), apiOptions.size());
+    hash.update("----", 4);
+    hash.update(internalOptions.begin(), internalOptions.size());
+    hash.update("----", 4);
+    hash.update(safePodCast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
+    hash.update("----", 4);
+
+    const auto featureTableHashStr = std::to_string(hwInfo.featureTable.asHash());
+    hash.update(featureTableHashStr.c_str(), featureTableHashStr.length());
+    hash.update("----", 4);
+
+    const auto workaroundTableHashStr = std::to_string(hwInfo.workaroundTable.asHash());
+    hash.update(workaroundTableHashStr.c_str(), workaroundTableHashStr.length());
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << name << "_"
+           << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res;
+    return stream.str();
+}
+
+uint64_t BuiltIn::BinaryCache::getDriverBuildKey() {
+    const std::string_view buildId = NEO::driverVersion;
+    return Hash::hash(buildId.data(), buildId.size());
+}
+
+bool BuiltIn::BinaryCache::isEntryValid(const BinaryCacheEntryHeader &header, const HardwareIpVersion &ipVersion, size_t entrySize) {
+    return entrySize > sizeof(BinaryCacheEntryHeader) &&
+           header.entryMagic == BinaryCacheEntryHeader::magic &&
+           header.version == cacheVersion &&
+           header.ipVersion == ipVersion.value &&
+           header.driverBuildKey == getDriverBuildKey() &&
+           header.payloadSize == entrySize - sizeof(BinaryCacheEntryHeader);
+}
+
+} // namespace NEO
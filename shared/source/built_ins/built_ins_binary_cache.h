@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/built_ins/built_ins.h"
+#include "shared/source/helpers/hw_ip_version.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+struct HardwareInfo;
+
+namespace BuiltIn {
+
+struct BinaryCacheEntryHeader {
+    static constexpr uint32_t magic = 0x4e424943; // "CIBN"
+
+    uint32_t entryMagic = magic;
+    uint32_t version = 0u;
+    uint32_t ipVersion = 0u;
+    uint32_t reserved = 0u;
+    uint64_t driverBuildKey = 0u;
+    uint64_t payloadSize = 0u;
+};
+
+// Persistent cache of device binaries built from built-in kernels and of SIP binaries, kept per HardwareIpVersion.
+// Entries are tagged with the driver build they were produced by, entry names carry the compiler identity and build options
+// (see getEntryName). Entries are memory-mapped on load, so a hit needs neither a compilation nor a copy of the binary.
+class BinaryCache : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static std::unique_ptr<BinaryCache> create(const std::string &cacheDir, const HardwareIpVersion &ipVersion);
+    virtual ~BinaryCache() = default;
+
+    // returned resource points to memory owned by the cache and stays valid for its lifetime
+    virtual Resource load(const std::string &entryName) = 0;
+    virtual bool store(const std::string &entryName, ArrayRef<const char> data) = 0;
+
+    // Keyed the same way as CompilerCache::getCachedFileName, so a compiler change or different options select another entry.
+    static std::string getEntryName(const std::string &name, uint64_t compilerIdentityHash, const HardwareInfo &hwInfo,
+                                    ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions);
+    static uint64_t getDriverBuildKey();
+    static bool isEntryValid(const BinaryCacheEntryHeader &header, const HardwareIpVersion &ipVersion, size_t entrySize);
+
+    static constexpr uint32_t cacheVersion = 1u;
+    static constexpr const char *fileExtension = ".builtin_cache";
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<BinaryCache>);
+
+} // namespace BuiltIn
+} // namespace NEO
@@ -6,7 +6,10 @@
  */
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/built_ins/built_ins_binary_cache.h"
 #include "shared/source/built_ins/registry/built_ins_registry.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -122,6 +125,8 @@ BuiltIn::ResourceLoader::ResourceLoader() {
     allStorages.push_back(std::make_unique<BuiltIn::FileStorage>(getDriverInstallationPath()));
 }
 
+BuiltIn::ResourceLoader::~ResourceLoader() = default;
+
 BuiltIn::Code BuiltIn::ResourceLoader::getBuiltinCode(BuiltIn::BaseKernel kernel, const BuiltIn::AddressingMode &mode, BuiltIn::CodeType requestedCodeType, Device &device) {
     std::lock_guard<std::mutex> lockRaii{mutex};
 
@@ -169,4 +174,77 @@ BuiltIn::Resource BuiltIn::ResourceLoader::getBuiltinResource(BuiltIn::BaseKerne
     return builtinResource;
 }
 
+std::unique_ptr<BuiltIn::BinaryCache> BuiltIn::ResourceLoader::createBinaryCache(const Device &device) {
+    if (debugManager.flags.EnablePersistentBuiltInsCache.get() != 1 || debugManager.flags.RebuildPrecompiledKernels.get()) {
+        return nullptr;
+    }
+
+    // binaries built for debugging carry debug data and debug SIP variants, keep them out of the cache
+    if (device.getExecutionEnvironment()->isDebuggingEnabled()) {
+        return nullptr;
+    }
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    if (!cacheConfig.enabled) {
+        return nullptr;
+    }
+    return BuiltIn::BinaryCache::create(cacheConfig.cacheDir, device.getHardwareInfo().ipVersion);
+}
+
+BuiltIn::BinaryCache *BuiltIn::ResourceLoader::getBinaryCache(const Device &device) {
+    std::lock_guard<std::mutex> lock(binaryCachesMutex);
+    auto ipVersion = device.getHardwareInfo().ipVersion.value;
+    auto binaryCache = binaryCaches.find(ipVersion);
+    if (binaryCache == binaryCaches.end()) {
+        binaryCache = binaryCaches.emplace(ipVersion, createBinaryCache(device)).first;
+    }
+    return binaryCache->second.get();
+}
+
+std::string BuiltIn::ResourceLoader::getBinaryCacheEntryName(const std::string &name, Device &device, ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions) {
+    auto compilerInterface = device.getCompilerInterface();
+    uint64_t compilerIdentityHash = 0u;
+    if (compilerInterface == nullptr || !compilerInterface->getCompilerIdentityHash(device, compilerIdentityHash)) {
+        return {};
+    }
+    return BuiltIn::BinaryCache::getEntryName(name, compilerIdentityHash, device.getHardwareInfo(), apiOptions, internalOptions);
+}
+
+BuiltIn::Code BuiltIn::ResourceLoader::getCachedBuiltinBinary(BuiltIn::BaseKernel kernel, const BuiltIn::AddressingMode &mode, Device &device,
+                                                              ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions) {
+    BuiltIn::Code ret = {};
+    ret.type = BuiltIn::CodeType::invalid;
+    ret.targetDevice = &device;
+
+    auto cache = getBinaryCache(device);
+    if (cache == nullptr) {
+        return ret;
+    }
+
+    auto entryName = getBinaryCacheEntryName(mode.toString() + BuiltIn::getAsString(kernel), device, apiOptions, internalOptions);
+    if (entryName.empty()) {
+        return ret;
+    }
+
+    ret.resource = cache->load(entryName);
+    if (!ret.resource.empty()) {
+        ret.type = BuiltIn::CodeType::binary;
+    }
+    return ret;
+}
+
+void BuiltIn::ResourceLoader::cacheBuiltinBinary(BuiltIn::BaseKernel kernel, const BuiltIn::AddressingMode &mode, Device &device,
+                                                 ArrayRef<const char> apiOptions, ArrayRef<const char> internalOptions, ArrayRef<const char> binary) {
+    auto cache = getBinaryCache(device);
+    if (cache == nullptr) {
+        return;
+    }
+
+    auto entryName = getBinaryCacheEntryName(mode.toString() + BuiltIn::getAsString(kernel), device, apiOptions, internalOptions);
+    if (entryName.empty()) {
+        return;
+    }
+    cache->store(entryName, binary);
+}
+
 } // namespace NEO
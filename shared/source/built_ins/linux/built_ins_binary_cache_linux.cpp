@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/linux/built_ins_binary_cache_linux.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace NEO {
+
+std::unique_ptr<BuiltIn::BinaryCache> BuiltIn::BinaryCache::create(const std::string &cacheDir, const HardwareIpVersion &ipVersion) {
+    if (cacheDir.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<BuiltIn::BinaryCacheLinux>(cacheDir, ipVersion);
+}
+
+BuiltIn::BinaryCacheLinux::BinaryCacheLinux(const std::string &cacheDir, const HardwareIpVersion &ipVersion)
+    : cacheDir(cacheDir), ipVersion(ipVersion) {
+}
+
+BuiltIn::BinaryCacheLinux::~BinaryCacheLinux() {
+    for (const auto &[entryName, mapping] : mappings) {
+        NEO::SysCalls::munmap(mapping.first, mapping.second);
+    }
+}
+
+std::string BuiltIn::BinaryCacheLinux::getEntryPath(const std::string &entryName) const {
+    const auto deviceIp = std::to_string(ipVersion.architecture) + "_" + std::to_string(ipVersion.release) + "_" + std::to_string(ipVersion.revision);
+    return joinPath(cacheDir, deviceIp + "_" + entryName + fileExtension);
+}
+
+BuiltIn::Resource BuiltIn::BinaryCacheLinux::getMappedPayload(const void *address) {
+    const auto header = reinterpret_cast<const BinaryCacheEntryHeader *>(address);
+    return BuiltIn::createResource(reinterpret_cast<const char *>(ptrOffset(address, sizeof(BinaryCacheEntryHeader))), static_cast<size_t>(header->payloadSize), true);
+}
+
+BuiltIn::Resource BuiltIn::BinaryCacheLinux::load(const std::string &entryName) {
+    std::lock_guard<std::mutex> lock(mappingsMtx);
+    auto mapping = mappings.find(entryName);
+    if (mapping != mappings.end()) {
+        return getMappedPayload(mapping->second.first);
+    }
+
+    const auto entryPath = getEntryPath(entryName);
+    int fd = NEO::SysCalls::open(entryPath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return {};
+    }
+
+    struct stat statBuf = {};
+    if (NEO::SysCalls::fstat(fd, &statBuf) != 0 || static_cast<size_t>(statBuf.st_size) <= sizeof(BinaryCacheEntryHeader)) {
+        NEO::SysCalls::close(fd);
+        return {};
+    }
+
+    const auto entrySize = static_cast<size_t>(statBuf.st_size);
+    auto address = NEO::SysCalls::mmap(nullptr, entrySize, PROT_READ, MAP_PRIVATE, fd, 0);
+    NEO::SysCalls::close(fd);
+    if (address == MAP_FAILED) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Built-ins cache failure]: Mapping cache entry failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return {};
+    }
+
+    const auto header = reinterpret_cast<const BinaryCacheEntryHeader *>(address);
+    if (!isEntryValid(*header, ipVersion, entrySize)) {
+        NEO::SysCalls::munmap(address, entrySize);
+        return {};
+    }
+
+    mappings.emplace(entryName, std::make_pair(address, entrySize));
+    return getMappedPayload(address);
+}
+
+bool BuiltIn::BinaryCacheLinux::store(const std::string &entryName, ArrayRef<const char> data) {
+    if (data.empty()) {
+        return false;
+    }
+
+    std::string tmpFilePath = joinPath(cacheDir, "builtin_XXXXXX");
+    int fd = NEO::SysCalls::mkstemp(tmpFilePath.data());
+    if (fd == -1) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Built-ins cache failure]: Creating temporary file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+
+    BinaryCacheEntryHeader header = {};
+    header.version = cacheVersion;
+    header.ipVersion = ipVersion.value;
+    header.driverBuildKey = getDriverBuildKey();
+    header.payloadSize = data.size();
+
+    bool written = NEO::SysCalls::pwrite(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                   NEO::SysCalls::pwrite(fd, data.begin(), data.size(), sizeof(header)) == static_cast<ssize_t>(data.size());
+    written &= (NEO::SysCalls::close(fd) == 0);
+
+    // rename is atomic, so concurrent loaders see either the previous entry or the complete new one
+    if (!written || NEO::SysCalls::rename(tmpFilePath.c_str(), getEntryPath(entryName).c_str()) != 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Built-ins cache failure]: Storing cache entry failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        NEO::SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/built_ins/built_ins_binary_cache.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace NEO {
+namespace BuiltIn {
+
+class BinaryCacheLinux : public BinaryCache {
+  public:
+    BinaryCacheLinux(const std::string &cacheDir, const HardwareIpVersion &ipVersion);
+    ~BinaryCacheLinux() override;
+
+    Resource load(const std::string &entryName) override;
+    bool store(const std::string &entryName, ArrayRef<const char> data) override;
+
+  protected:
+    std::string getEntryPath(const std::string &entryName) const;
+    static Resource getMappedPayload(const void *address);
+
+    std::string cacheDir;
+    HardwareIpVersion ipVersion;
+
+    // every entry is mapped at most once, repeated loads return the existing mapping
+    std::mutex mappingsMtx;
+    std::unordered_map<std::string, std::pair<void *, size_t>> mappings;
+};
+
+} // namespace BuiltIn
+} // namespace NEO
@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/built_ins_binary_cache.h"
+
+namespace NEO {
+
+std::unique_ptr<BuiltIn::BinaryCache> BuiltIn::BinaryCache::create(const std::string &cacheDir, const HardwareIpVersion &ipVersion) {
+    return nullptr;
+}
+
+} // namespace NEO
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_container/dispatch_template_cache.h"
 #include "shared/source/command_container/encode_surface_state.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
@@ -91,53 +92,152 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    WalkerType walkerCmd = Family::template getInitGpuWalker<WalkerType>();
-    auto &idd = walkerCmd.getInterfaceDescriptor();
-
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, rootDeviceEnvironment);
-
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
+    auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
 
-    {
-        auto isaAllocation = args.dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == isaAllocation);
+    auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
+    bool sshProgrammingRequired = true;
 
-        uint64_t kernelStartPointer = args.dispatchInterface->getIsaOffsetInParentAllocation();
-        if constexpr (heaplessModeEnabled) {
-            kernelStartPointer += isaAllocation->getGpuAddress();
-        } else {
-            kernelStartPointer += isaAllocation->getGpuAddressToPatch();
-        }
+    auto &productHelper = args.device->getProductHelper();
+    if (productHelper.isSkippingStatefulInformationRequired(kernelDescriptor)) {
+        bindingTableStateCount = 0u;
+        sshProgrammingRequired = false;
+    }
 
-        if (!localIdsGenerationByRuntime) {
-            kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
+    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
+
+    uint32_t samplerCount = 0;
+    if constexpr (Family::supportsSampler) {
+        if (args.device->getDeviceInfo().imageSupport && !args.makeCommandView) {
+            samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
         }
-        idd.setKernelStartPointer(kernelStartPointer);
     }
-    if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
-        idd.setSoftwareExceptionEnable(1);
+
+    constexpr uint32_t inlineDataSize = WalkerType::getInlineDataSize();
+    uint32_t inlineDataProgrammingOffset = 0u;
+    bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
+    if (inlineDataProgramming) {
+        inlineDataProgrammingOffset = std::min(inlineDataSize, sizeCrossThreadData);
+        inlineDataProgramming = inlineDataProgrammingOffset != 0;
     }
 
-    auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+    auto kernelExecutionType = args.isCooperative ? KernelExecutionType::concurrent : KernelExecutionType::defaultType;
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor);
+    EncodeWalkerArgs walkerArgs{
+        .argsExtended = args.extendedArgs,
+        .kernelExecutionType = kernelExecutionType,
+        .requiredDispatchWalkOrder = args.requiredDispatchWalkOrder,
+        .maxFrontEndThreads = args.device->getDeviceInfo().maxFrontEndThreads,
+        .requiredSystemFence = args.postSyncArgs.requiresSystemMemoryFence(),
+        .hasSample = kernelDescriptor.kernelAttributes.flags.hasSample,
+        .l0DebuggerEnabled = args.device->getL0Debugger() != nullptr,
+        .kernelUsesRayTracing = args.kernelUsesRayTracing};
 
-    EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
+    auto isaAllocation = args.dispatchInterface->getIsaAllocation();
+    UNRECOVERABLE_IF(nullptr == isaAllocation);
 
-    EncodeDispatchKernel<Family>::encodeSlmSizePerThreadGroup(&idd, rootDeviceEnvironment, args.dispatchInterface->getSlmTotalSizePerThreadGroup(), heaplessModeEnabled);
+    uint64_t kernelStartPointer = args.dispatchInterface->getIsaOffsetInParentAllocation();
+    if constexpr (heaplessModeEnabled) {
+        kernelStartPointer += isaAllocation->getGpuAddress();
+    } else {
+        kernelStartPointer += isaAllocation->getGpuAddressToPatch();
+    }
 
-    auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
-    bool sshProgrammingRequired = true;
+    if (!localIdsGenerationByRuntime) {
+        kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
+    }
 
-    auto &productHelper = args.device->getProductHelper();
-    if (productHelper.isSkippingStatefulInformationRequired(kernelDescriptor)) {
-        bindingTableStateCount = 0u;
-        sshProgrammingRequired = false;
+    WalkerType walkerCmd = Family::template getInitGpuWalker<WalkerType>();
+    auto &idd = walkerCmd.getInterfaceDescriptor();
+
+    // fields derived only from kernel and dispatch dimensions are programmed here, per-dispatch state is programmed below
+    static_assert(sizeof(WalkerType) <= DispatchTemplateCache::maxWalkerSize);
+    auto dispatchTemplateCache = (args.makeCommandView || args.isIndirect) ? nullptr : args.dispatchInterface->getDispatchTemplateCache();
+    DispatchTemplateKey dispatchTemplateKey{};
+    if (dispatchTemplateCache) {
+        dispatchTemplateKey.device = args.device;
+        dispatchTemplateKey.kernelStartPointer = kernelStartPointer;
+        for (uint32_t i = 0; i < 3; i++) {
+            dispatchTemplateKey.groupSize[i] = args.dispatchInterface->getGroupSize()[i];
+            dispatchTemplateKey.threadGroupDimensions[i] = threadDimsVec[i];
+        }
+        dispatchTemplateKey.crossThreadDataSize = sizeCrossThreadData;
+        dispatchTemplateKey.perThreadDataSize = sizePerThreadData;
+        dispatchTemplateKey.threadsPerThreadGroup = threadsPerThreadGroup;
+        dispatchTemplateKey.threadExecutionMask = args.dispatchInterface->getThreadExecutionMask();
+        dispatchTemplateKey.slmTotalSizePerThreadGroup = args.dispatchInterface->getSlmTotalSizePerThreadGroup();
+        dispatchTemplateKey.requiredWorkgroupOrder = requiredWorkgroupOrder;
+        dispatchTemplateKey.defaultPipelinedThreadArbitrationPolicy = args.defaultPipelinedThreadArbitrationPolicy;
+        dispatchTemplateKey.threadArbitrationPolicy = static_cast<int32_t>(kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+        dispatchTemplateKey.slmPolicy = static_cast<uint32_t>(args.dispatchInterface->getSlmPolicy());
+        dispatchTemplateKey.preemptionMode = preemptionMode;
+        dispatchTemplateKey.requiredDispatchWalkOrder = args.requiredDispatchWalkOrder;
+        dispatchTemplateKey.localIdsGenerationByRuntime = localIdsGenerationByRuntime;
+        dispatchTemplateKey.isCooperative = args.isCooperative;
+        dispatchTemplateKey.kernelUsesRayTracing = args.kernelUsesRayTracing;
+    }
+
+    if (!dispatchTemplateCache || !dispatchTemplateCache->loadWalker(dispatchTemplateKey, &walkerCmd, sizeof(WalkerType))) {
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, rootDeviceEnvironment);
+
+        idd.setKernelStartPointer(kernelStartPointer);
+        if (kernelDescriptor.kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
+            idd.setSoftwareExceptionEnable(1);
+        }
+
+        idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor);
+
+        EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
+
+        EncodeDispatchKernel<Family>::encodeSlmSizePerThreadGroup(&idd, rootDeviceEnvironment, args.dispatchInterface->getSlmTotalSizePerThreadGroup(), heaplessModeEnabled);
+
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
+
+        if constexpr (heaplessModeEnabled == false) {
+            EncodeDispatchKernelWithHeap<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
+        }
+
+        EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
+                                                       nullptr,
+                                                       threadGroupDims,
+                                                       args.dispatchInterface->getGroupSize(),
+                                                       kernelDescriptor.kernelAttributes.simdSize,
+                                                       kernelDescriptor.kernelAttributes.numLocalIdChannels,
+                                                       threadsPerThreadGroup,
+                                                       args.dispatchInterface->getThreadExecutionMask(),
+                                                       localIdsGenerationByRuntime,
+                                                       inlineDataProgramming,
+                                                       args.isIndirect,
+                                                       requiredWorkgroupOrder,
+                                                       rootDeviceEnvironment);
+
+        auto workloadThreadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
+        EncodeDispatchKernel<Family>::encodeThreadGroupDispatch(idd, *args.device, hwInfo, threadDimsVec, workloadThreadGroupCount,
+                                                                kernelDescriptor.kernelMetadata.requiredThreadGroupDispatchSize, kernelDescriptor.kernelAttributes.numGrfRequired, threadsPerThreadGroup, walkerCmd);
+
+        EncodeSlmSizePerSubSliceArgs slmArgs{
+            .threadsPerThreadGroup = threadsPerThreadGroup,
+            .workloadThreadGroupCount = workloadThreadGroupCount,
+            .slmTotalSizePerThreadGroup = args.dispatchInterface->getSlmTotalSizePerThreadGroup(),
+            .slmPolicy = args.dispatchInterface->getSlmPolicy()};
+
+        EncodeDispatchKernel<Family>::encodeSlmSizePerSubSlice(&idd, rootDeviceEnvironment, slmArgs);
+
+        EncodeDispatchKernel<Family>::encodeAdditionalWalkerFields(rootDeviceEnvironment, walkerCmd, walkerArgs);
+        EncodeDispatchKernel<Family>::encodeComputeDispatchAllWalker(walkerCmd, &idd, rootDeviceEnvironment, walkerArgs);
+
+        EncodeDispatchKernel<Family>::overrideDefaultValues(walkerCmd, idd);
+
+        if (dispatchTemplateCache) {
+            dispatchTemplateCache->storeWalker(dispatchTemplateKey, &walkerCmd, sizeof(WalkerType));
+        }
     }
+    auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
 
     if (sshProgrammingRequired && !args.makeCommandView) {
         bool isBindlessKernel = NEO::KernelDescriptor::isBindlessAddressingKernel(kernelDescriptor);
@@ -187,11 +287,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
-
-    uint32_t samplerCount = 0;
-
     if constexpr (Family::supportsSampler) {
         if (args.device->getDeviceInfo().imageSupport && !args.makeCommandView) {
 
@@ -207,7 +302,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                 UNRECOVERABLE_IF(!dsHeap);
 
                 auto bindlessHeapsHelper = args.device->getBindlessHeapsHelper();
-                samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
                 uint64_t samplerStateOffset = EncodeStates<Family>::copySamplerState(
                     dsHeap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
                     kernelDescriptor.payloadMappings.samplerTable.numSamplers,
@@ -231,23 +325,14 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    if constexpr (heaplessModeEnabled == false) {
-        EncodeDispatchKernelWithHeap<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
-    }
-
     uint64_t offsetThreadData = 0u;
-    constexpr uint32_t inlineDataSize = WalkerType::getInlineDataSize();
     auto crossThreadData = args.dispatchInterface->getCrossThreadData();
 
-    uint32_t inlineDataProgrammingOffset = 0u;
-    bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
     if (inlineDataProgramming) {
-        inlineDataProgrammingOffset = std::min(inlineDataSize, sizeCrossThreadData);
         auto dest = reinterpret_cast<char *>(walkerCmd.getInlineDataPointer());
         memcpy_s(dest, inlineDataSize, crossThreadData, inlineDataProgrammingOffset);
         sizeCrossThreadData -= inlineDataProgrammingOffset;
         crossThreadData = ptrOffset(crossThreadData, inlineDataProgrammingOffset);
-        inlineDataProgramming = inlineDataProgrammingOffset != 0;
     }
 
     auto scratchAddressForImmediatePatching = EncodeDispatchKernel<Family>::getScratchAddressForImmediatePatching(container, args);
@@ -390,20 +475,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     container.getIndirectHeap(HeapType::indirectObject)->align(NEO::EncodeDispatchKernel<Family>::getDefaultIOHAlignment(container.isIndirectHeapInLocalMemory(), hwInfo));
 
-    EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
-                                                   nullptr,
-                                                   threadGroupDims,
-                                                   args.dispatchInterface->getGroupSize(),
-                                                   kernelDescriptor.kernelAttributes.simdSize,
-                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
-                                                   threadsPerThreadGroup,
-                                                   args.dispatchInterface->getThreadExecutionMask(),
-                                                   localIdsGenerationByRuntime,
-                                                   inlineDataProgramming,
-                                                   args.isIndirect,
-                                                   requiredWorkgroupOrder,
-                                                   rootDeviceEnvironment);
-
     if (args.postSyncArgs.inOrderExecInfo) {
         EncodePostSync<Family>::setupPostSyncForInOrderExec(walkerCmd, args.postSyncArgs);
     } else if (args.postSyncArgs.isRegularEvent()) {
@@ -420,9 +491,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     walkerCmd.setPredicateEnable(args.isPredicate);
 
-    auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
-    EncodeDispatchKernel<Family>::encodeThreadGroupDispatch(idd, *args.device, hwInfo, threadDimsVec, threadGroupCount,
-                                                            kernelDescriptor.kernelMetadata.requiredThreadGroupDispatchSize, kernelDescriptor.kernelAttributes.numGrfRequired, threadsPerThreadGroup, walkerCmd);
     PRINT_STRING(debugManager.flags.PrintKernelDispatchParameters.get(), stdout,
                  "kernel, %s, grfCount, %d, simdSize, %d, tilesCount, %d, implicitScaling, %s, slmTotalSize, %d, threadGroupCount, %d, threadsPerThreadGroup, %d, numberOfThreadsInGpgpuThreadGroup, %d, threadGroupDimensions, %d, %d, %d, threadGroupDispatchSize enum, %d\n",
                  kernelDescriptor.kernelMetadata.kernelName.c_str(),
@@ -439,31 +507,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                  walkerCmd.getThreadGroupIdZDimension(),
                  idd.getThreadGroupDispatchSize());
 
-    EncodeSlmSizePerSubSliceArgs slmArgs{
-        .threadsPerThreadGroup = threadsPerThreadGroup,
-        .workloadThreadGroupCount = threadGroupCount,
-        .slmTotalSizePerThreadGroup = args.dispatchInterface->getSlmTotalSizePerThreadGroup(),
-        .slmPolicy = args.dispatchInterface->getSlmPolicy()};
-
-    EncodeDispatchKernel<Family>::encodeSlmSizePerSubSlice(&idd, rootDeviceEnvironment, slmArgs);
-
-    auto kernelExecutionType = args.isCooperative ? KernelExecutionType::concurrent : KernelExecutionType::defaultType;
-
-    EncodeWalkerArgs walkerArgs{
-        .argsExtended = args.extendedArgs,
-        .kernelExecutionType = kernelExecutionType,
-        .requiredDispatchWalkOrder = args.requiredDispatchWalkOrder,
-        .maxFrontEndThreads = args.device->getDeviceInfo().maxFrontEndThreads,
-        .requiredSystemFence = args.postSyncArgs.requiresSystemMemoryFence(),
-        .hasSample = kernelDescriptor.kernelAttributes.flags.hasSample,
-        .l0DebuggerEnabled = args.device->getL0Debugger() != nullptr,
-        .kernelUsesRayTracing = args.kernelUsesRayTracing};
-
-    EncodeDispatchKernel<Family>::encodeAdditionalWalkerFields(rootDeviceEnvironment, walkerCmd, walkerArgs);
     EncodeDispatchKernel<Family>::encodeWalkerPostSyncFields(walkerCmd, rootDeviceEnvironment, walkerArgs);
-    EncodeDispatchKernel<Family>::encodeComputeDispatchAllWalker(walkerCmd, &idd, rootDeviceEnvironment, walkerArgs);
-
-    EncodeDispatchKernel<Family>::overrideDefaultValues(walkerCmd, idd);
 
     uint32_t workgroupSize = args.dispatchInterface->getGroupSize()[0] * args.dispatchInterface->getGroupSize()[1] * args.dispatchInterface->getGroupSize()[2];
     bool isRequiredDispatchWorkGroupOrder = args.requiredDispatchWalkOrder != NEO::RequiredDispatchWalkOrder::none;
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/dispatch_template_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+
+namespace NEO {
+
+bool DispatchTemplateCache::loadWalker(const DispatchTemplateKey &key, void *walker, size_t walkerSize) {
+    UNRECOVERABLE_IF(walkerSize > maxWalkerSize);
+
+    std::lock_guard<SpinLock> lock(mtx);
+    for (const auto &entry : entries) {
+        if (entry.valid && entry.key == key) {
+            memcpy_s(walker, walkerSize, entry.walker.data(), walkerSize);
+            hits++;
+            return true;
+        }
+    }
+    misses++;
+    return false;
+}
+
+void DispatchTemplateCache::storeWalker(const DispatchTemplateKey &key, const void *walker, size_t walkerSize) {
+    UNRECOVERABLE_IF(walkerSize > maxWalkerSize);
+
+    std::lock_guard<SpinLock> lock(mtx);
+    auto &entry = entries[nextEntry];
+    nextEntry = (nextEntry + 1) % entriesCount;
+
+    entry.key = key;
+    memcpy_s(entry.walker.data(), maxWalkerSize, walker, walkerSize);
+    entry.valid = true;
+}
+
+} // namespace NEO
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/definitions/command_encoder_args.h"
+#include "shared/source/utilities/spinlock.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class Device;
+
+// everything the kernel-static part of a walker is derived from, besides the kernel itself
+struct DispatchTemplateKey {
+    const Device *device = nullptr;
+    uint64_t kernelStartPointer = 0u;
+    uint32_t groupSize[3] = {};
+    uint32_t threadGroupDimensions[3] = {};
+    uint32_t crossThreadDataSize = 0u;
+    uint32_t perThreadDataSize = 0u;
+    uint32_t threadsPerThreadGroup = 0u;
+    uint32_t threadExecutionMask = 0u;
+    uint32_t slmTotalSizePerThreadGroup = 0u;
+    uint32_t requiredWorkgroupOrder = 0u;
+    int32_t defaultPipelinedThreadArbitrationPolicy = 0;
+    int32_t threadArbitrationPolicy = 0;
+    uint32_t slmPolicy = 0u;
+    PreemptionMode preemptionMode = PreemptionMode::Initial;
+    RequiredDispatchWalkOrder requiredDispatchWalkOrder = RequiredDispatchWalkOrder::none;
+    bool localIdsGenerationByRuntime = false;
+    bool isCooperative = false;
+    bool kernelUsesRayTracing = false;
+
+    bool operator==(const DispatchTemplateKey &other) const = default;
+};
+
+class DispatchTemplateCache {
+  public:
+    static constexpr size_t maxWalkerSize = 256u;
+    static constexpr size_t entriesCount = 4u;
+
+    // same kernel may be appended from multiple threads, so walkers are copied in and out under lock
+    bool loadWalker(const DispatchTemplateKey &key, void *walker, size_t walkerSize);
+    void storeWalker(const DispatchTemplateKey &key, const void *walker, size_t walkerSize);
+
+    uint32_t getHitsCount() const { return hits; }
+    uint32_t getMissesCount() const { return misses; }
+
+  protected:
+    struct Entry {
+        DispatchTemplateKey key{};
+        alignas(uint64_t) std::array<uint8_t, maxWalkerSize> walker{};
+        bool valid = false;
+    };
+
+    std::array<Entry, entriesCount> entries{};
+    SpinLock mtx;
+    uint32_t nextEntry = 0u;
+    uint32_t hits = 0u;
+    uint32_t misses = 0u;
+};
+} // namespace NEO
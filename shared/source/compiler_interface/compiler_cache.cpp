@@ -7,6 +7,7 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/compiler_cache_index.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
@@ -140,7 +141,16 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig) {};
+    : config(cacheConfig) {
+    if (config.enabled && config.indexedStorage) {
+        index = CompilerCacheIndex::create(config);
+        if (index && config.statsEnabled) {
+            createStats(joinPath(config.cacheDir, "stats"));
+        }
+    }
+};
+
+CompilerCache::~CompilerCache() = default;
 
 std::string CompilerCache::getCachedFilePath(const std::string &cacheFile) {
     std::string path = config.cacheDir;
@@ -160,6 +170,14 @@ std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kerne
         return nullptr;
     }
 
+    if (index) {
+        auto data = index->load(cacheFilename, cachedBinarySize);
+        if (config.statsEnabled) {
+            updateStats(joinPath(config.cacheDir, "stats"), data != nullptr);
+        }
+        return data;
+    }
+
     std::string filePath = getCachedFilePath(cacheFilename);
     auto data = NEO::loadDataFromFile(filePath.c_str(), cachedBinarySize);
 
@@ -299,7 +317,27 @@ CompilerCache::StatsResult CompilerCache::zeroStats() {
 }
 
 bool CompilerCache::clear() {
+    if (index) {
+        return index->clear();
+    }
     return clearDirectoryContents(config.cacheDir);
 }
 
+CompilerCache::InFlightBuildStatus CompilerCache::tryAcquireBuild(const std::string &kernelFileHash, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(inFlightBuildsMtx);
+    if (inFlightBuilds.insert(kernelFileHash).second) {
+        return InFlightBuildStatus::acquired;
+    }
+    auto released = inFlightBuildsCondVar.wait_for(lock, timeout, [&]() { return inFlightBuilds.find(kernelFileHash) == inFlightBuilds.end(); });
+    return released ? InFlightBuildStatus::released : InFlightBuildStatus::timedOut;
+}
+
+void CompilerCache::releaseBuild(const std::string &kernelFileHash) {
+    {
+        std::lock_guard<std::mutex> lock(inFlightBuildsMtx);
+        inFlightBuilds.erase(kernelFileHash);
+    }
+    inFlightBuildsCondVar.notify_all();
+}
+
 } // namespace NEO
@@ -12,16 +12,20 @@
 #include "shared/source/utilities/arrayref.h"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
 struct HardwareInfo;
 struct ElementsStruct;
+class CompilerCacheIndex;
 
 struct CacheStats {
     uint64_t hits = 0;
@@ -35,12 +39,13 @@ struct CompilerCacheConfig {
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    bool indexedStorage = false;
 };
 
 class CompilerCache : NEO::NonCopyableAndNonMovableClass {
   public:
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     const CompilerCacheConfig &getConfig() {
         return config;
@@ -64,6 +69,17 @@ class CompilerCache : NEO::NonCopyableAndNonMovableClass {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
+    enum class InFlightBuildStatus {
+        acquired,
+        released,
+        timedOut
+    };
+
+    // Returns acquired when the caller became the builder of kernelFileHash. Otherwise waits up to timeout for
+    // the current builder to release it, the caller should then retry loading from cache and build on its own on a miss.
+    InFlightBuildStatus tryAcquireBuild(const std::string &kernelFileHash, std::chrono::milliseconds timeout);
+    void releaseBuild(const std::string &kernelFileHash);
+
     constexpr static uint64_t cacheVersion = 1;
 
   protected:
@@ -87,8 +103,25 @@ class CompilerCache : NEO::NonCopyableAndNonMovableClass {
     constexpr static int maxCacheDepth = 2;
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    std::unique_ptr<CompilerCacheIndex> index;
+
+    std::mutex inFlightBuildsMtx;
+    std::condition_variable inFlightBuildsCondVar;
+    std::unordered_set<std::string> inFlightBuilds;
 };
 
 static_assert(NEO::NonCopyableAndNonMovable<CompilerCache>);
 
+class CompilerCacheInFlightBuild : NEO::NonCopyableAndNonMovableClass {
+  public:
+    CompilerCacheInFlightBuild(CompilerCache &cache, const std::string &kernelFileHash) : cache(cache), kernelFileHash(kernelFileHash) {}
+    ~CompilerCacheInFlightBuild() { cache.releaseBuild(kernelFileHash); }
+
+  protected:
+    CompilerCache &cache;
+    std::string kernelFileHash;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<CompilerCacheInFlightBuild>);
+
 } // namespace NEO
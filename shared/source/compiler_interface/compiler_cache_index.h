@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace NEO {
+struct CompilerCacheConfig;
+
+// Single-file storage backend for CompilerCache: a memory-mapped hash index and an append-only blob file,
+// so that lookups never touch the directory tree and eviction does not need to enumerate cached files.
+class CompilerCacheIndex : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static std::unique_ptr<CompilerCacheIndex> create(const CompilerCacheConfig &config);
+    virtual ~CompilerCacheIndex() = default;
+
+    virtual bool store(const std::string &cacheFileName, const char *pBinary, size_t binarySize) = 0;
+    virtual std::unique_ptr<char[]> load(const std::string &cacheFileName, size_t &binarySize) = 0;
+    virtual bool clear() = 0;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<CompilerCacheIndex>);
+
+} // namespace NEO
@@ -17,7 +17,9 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_inc_base.h"
 
@@ -71,6 +73,7 @@ TranslationErrorCode CompilerInterface::build(
     CachingMode cachingMode = CompilerCacheHelper::getCachingMode(cache.get(), srcCodeType, input.src);
 
     std::string kernelFileHash;
+    std::unique_ptr<CompilerCacheInFlightBuild> inFlightBuild;
     const auto &igc = *getIgc(&device);
     if (cachingMode == CachingMode::direct) {
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
@@ -78,7 +81,7 @@ TranslationErrorCode CompilerInterface::build(
                                                   input.apiOptions,
                                                   input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igc.revision, igc.igcRegKeys, igc.libSize, igc.libMTime);
 
-        bool success = CompilerCacheHelper::loadCacheAndSetOutput(*cache, kernelFileHash, output);
+        bool success = CompilerCacheHelper::loadCacheOrAcquireBuild(*cache, kernelFileHash, output, inFlightBuild);
         if (success) {
             return TranslationErrorCode::success;
         }
@@ -144,7 +147,7 @@ TranslationErrorCode CompilerInterface::build(
                                                   input.apiOptions,
                                                   input.internalOptions, specIdsRef, specValuesRef, igc.revision, igc.igcRegKeys, igc.libSize, igc.libMTime);
 
-        bool success = CompilerCacheHelper::loadCacheAndSetOutput(*cache, kernelFileHash, output);
+        bool success = CompilerCacheHelper::loadCacheOrAcquireBuild(*cache, kernelFileHash, output, inFlightBuild);
         if (success) {
             return TranslationErrorCode::success;
         }
@@ -427,6 +430,23 @@ std::string CompilerInterface::getSpirvExtensionsYAML(const NEO::Device &device)
     return SpirvCapabilitiesParser::getSpirvExtensionsYAMLFromDeviceCtx(getIgcDeviceCtx(device), igc->entryPoint.get());
 }
 
+bool CompilerInterface::getCompilerIdentityHash(const NEO::Device &device, uint64_t &identityHash) {
+    auto *igc = getIgc(&device);
+    if (igc == nullptr) {
+        return false;
+    }
+
+    Hash hash;
+    hash.update("----", 4);
+    hash.update(igc->revision.c_str(), igc->revision.size());
+    hash.update(safePodCast<const char *>(&igc->libSize), sizeof(igc->libSize));
+    hash.update(safePodCast<const char *>(&igc->libMTime), sizeof(igc->libMTime));
+    hash.update("----", 4);
+    hash.update(igc->igcRegKeys.c_str(), igc->igcRegKeys.size());
+    identityHash = hash.finish();
+    return true;
+}
+
 bool CompilerInterface::loadFcl() {
     return NEO::loadCompiler<IGC::FclOclDeviceCtx>(Os::frontEndDllName, fcl.library, fcl.entryPoint);
 }
@@ -717,6 +737,23 @@ bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, co
     return false;
 }
 
+bool CompilerCacheHelper::loadCacheOrAcquireBuild(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, std::unique_ptr<CompilerCacheInFlightBuild> &inFlightBuild) {
+    if (loadCacheAndSetOutput(compilerCache, kernelFileHash, output)) {
+        return true;
+    }
+    // concurrent builds of the same input are only expected from asynchronous module builds
+    if (debugManager.flags.AsyncModuleBuildThreads.get() <= 0) {
+        return false;
+    }
+
+    if (compilerCache.tryAcquireBuild(kernelFileHash, inFlightBuildWaitTimeout) == CompilerCache::InFlightBuildStatus::acquired) {
+        inFlightBuild = std::make_unique<CompilerCacheInFlightBuild>(compilerCache, kernelFileHash);
+        return false;
+    }
+    // waited once, when the other build left nothing in cache all waiters build in parallel instead of one after another
+    return loadCacheAndSetOutput(compilerCache, kernelFileHash, output);
+}
+
 CachingMode CompilerCacheHelper::getCachingMode(CompilerCache *compilerCache, IGC::CodeType::CodeType_t srcCodeType, const ArrayRef<const char> source) {
     if (compilerCache == nullptr || !compilerCache->getConfig().enabled) {
         return CachingMode::none;
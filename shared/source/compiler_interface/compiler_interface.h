@@ -19,12 +19,14 @@
 #include "ocl_igc_interface/fcl_ocl_device_ctx.h"
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
+#include <chrono>
 #include <unordered_map>
 
 namespace NEO {
 enum class SipKernelType : std::uint32_t;
 class OsLibrary;
 class CompilerCache;
+class CompilerCacheInFlightBuild;
 class Device;
 struct TargetDevice;
 
@@ -142,6 +144,10 @@ class CompilerInterface : NEO::NonCopyableAndNonMovableClass {
 
     MOCKABLE_VIRTUAL std::string getSpirvExtensionsYAML(const NEO::Device &device);
 
+    // Hash of the compiler identity used by CompilerCache (revision, library size and mtime, IGC registry keys),
+    // returns false when no compiler is available for the device.
+    MOCKABLE_VIRTUAL bool getCompilerIdentityHash(const NEO::Device &device, uint64_t &identityHash);
+
   protected:
     struct CompilerLibraryEntry {
         std::string revision;
@@ -239,6 +245,8 @@ class CompilerCacheHelper {
   public:
     static void packAndCacheBinary(CompilerCache &compilerCache, const std::string &kernelFileHash, const NEO::TargetDevice &targetDevice, const NEO::TranslationOutput &translationOutput);
     static bool loadCacheAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output);
+    static bool loadCacheOrAcquireBuild(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, std::unique_ptr<CompilerCacheInFlightBuild> &inFlightBuild);
+    static constexpr std::chrono::milliseconds inFlightBuildWaitTimeout{30000};
     static CachingMode getCachingMode(CompilerCache *compilerCache, IGC::CodeType::CodeType_t srcCodeType, const ArrayRef<const char> source);
 
   protected:
@@ -23,6 +23,7 @@ const std::string neoCachePersistent = "NEO_CACHE_PERSISTENT";
 const std::string neoCacheMaxSize = "NEO_CACHE_MAX_SIZE";
 const std::string neoCacheDir = "NEO_CACHE_DIR";
 const std::string neoCacheStats = "NEO_CACHE_STATS";
+const std::string neoCacheIndexed = "NEO_CACHE_INDEXED";
 
 const int64_t neoCacheMaxSizeDefault = static_cast<int64_t>(MemoryConstants::gigaByte);
 
@@ -60,6 +61,8 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
             ret.cacheSize = std::numeric_limits<size_t>::max();
         }
 
+        ret.indexedStorage = (envReader.getSetting(neoCacheIndexed.c_str(), 0) != 0);
+
         PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "NEO_CACHE_PERSISTENT is enabled. Cache is located in: %s\n\n",
                      ret.cacheDir.c_str());
 
@@ -0,0 +1,583 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/linux/compiler_cache_index_linux.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <sys/file.h>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+constexpr int cacheFileMode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH;
+
+class IndexFileLock : NonCopyableAndNonMovableClass {
+  public:
+    explicit IndexFileLock(int fd) : fd(fd) {
+        locked = NEO::SysCalls::flock(fd, LOCK_EX) == 0;
+        if (!locked) {
+            int error = errno;
+            PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Locking cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        }
+    }
+    ~IndexFileLock() {
+        if (locked) {
+            NEO::SysCalls::flock(fd, LOCK_UN);
+        }
+    }
+    bool isLocked() const {
+        return locked;
+    }
+
+  protected:
+    int fd = -1;
+    bool locked = false;
+};
+
+std::string_view getEntryKey(const CompilerCacheIndexFormat::Entry &entry) {
+    return std::string_view(entry.key, strnlen(entry.key, CompilerCacheIndexFormat::maxKeyLength));
+}
+} // namespace
+
+std::unique_ptr<CompilerCacheIndex> CompilerCacheIndex::create(const CompilerCacheConfig &config) {
+    auto index = std::make_unique<CompilerCacheIndexLinux>(config, CompilerCacheIndexFormat::defaultBucketCount);
+    if (!index->open()) {
+        return nullptr;
+    }
+    index->startEvictionThread();
+    return index;
+}
+
+CompilerCacheIndexLinux::CompilerCacheIndexLinux(const CompilerCacheConfig &config, uint32_t bucketCount)
+    : config(config),
+      indexPath(joinPath(config.cacheDir, std::string(indexFileName))),
+      blobPath(joinPath(config.cacheDir, std::string(blobFileName))),
+      bucketCount(bucketCount) {
+    DEBUG_BREAK_IF(bucketCount == 0u || (bucketCount & (bucketCount - 1)) != 0u);
+}
+
+CompilerCacheIndexLinux::~CompilerCacheIndexLinux() {
+    if (evictionThread) {
+        {
+            std::lock_guard<std::mutex> lock(evictionMtx);
+            evictionThreadActive.store(false);
+        }
+        evictionCondition.notify_all();
+        evictionThread->join();
+        evictionThread.reset();
+    }
+
+    if (header) {
+        NEO::SysCalls::munmap(header, getMappingSize());
+        header = nullptr;
+    }
+    if (blobFd >= 0) {
+        NEO::SysCalls::close(blobFd);
+    }
+    if (indexFd >= 0) {
+        NEO::SysCalls::close(indexFd);
+    }
+}
+
+bool CompilerCacheIndexLinux::open() {
+    indexFd = NEO::SysCalls::openWithMode(indexPath.c_str(), O_CREAT | O_RDWR, cacheFileMode);
+    if (indexFd < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Opening cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+
+    IndexFileLock fileLock(indexFd);
+    if (!fileLock.isLocked()) {
+        return false;
+    }
+
+    Header onDiskHeader = {};
+    bool reuseIndex = false;
+    if (NEO::SysCalls::pread(indexFd, &onDiskHeader, sizeof(onDiskHeader), 0) == static_cast<ssize_t>(sizeof(onDiskHeader)) &&
+        onDiskHeader.magic == CompilerCacheIndexFormat::magic &&
+        onDiskHeader.version == CompilerCacheIndexFormat::version &&
+        onDiskHeader.bucketCount != 0u && (onDiskHeader.bucketCount & (onDiskHeader.bucketCount - 1)) == 0u &&
+        (onDiskHeader.sequence & 1u) == 0u) {
+        // an odd sequence means a writer died in the middle of an update, so the index is rebuilt from scratch
+        struct stat statBuf = {};
+        const auto requiredSize = sizeof(Header) + static_cast<size_t>(onDiskHeader.bucketCount) * sizeof(Entry);
+        if (NEO::SysCalls::fstat(indexFd, &statBuf) == 0 && static_cast<size_t>(statBuf.st_size) >= requiredSize) {
+            bucketCount = onDiskHeader.bucketCount;
+            reuseIndex = true;
+        }
+    }
+
+    if (!reuseIndex) {
+        const char zero = 0;
+        if (NEO::SysCalls::pwrite(indexFd, &zero, sizeof(zero), getMappingSize() - sizeof(zero)) < 0) {
+            int error = errno;
+            PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Resizing cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+            return false;
+        }
+    }
+
+    auto mappedIndex = NEO::SysCalls::mmap(nullptr, getMappingSize(), PROT_READ | PROT_WRITE, MAP_SHARED, indexFd, 0);
+    if (mappedIndex == MAP_FAILED || mappedIndex == nullptr) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Mapping cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+    header = reinterpret_cast<Header *>(mappedIndex);
+
+    if (!reuseIndex) {
+        header->sequence = 0u;
+        header->blobGeneration = 0u;
+        initializeIndex(bucketCount);
+    }
+
+    blobFd = NEO::SysCalls::openWithMode(blobPath.c_str(), O_CREAT | O_RDWR, cacheFileMode);
+    if (blobFd < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Opening cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+    blobGeneration.store(header->blobGeneration);
+
+    evictionPending = needsEviction();
+    return true;
+}
+
+void CompilerCacheIndexLinux::initializeIndex(uint32_t newBucketCount) {
+    memset(getEntries(), 0, static_cast<size_t>(newBucketCount) * sizeof(Entry));
+
+    header->version = CompilerCacheIndexFormat::version;
+    header->bucketCount = newBucketCount;
+    header->usedBytes = 0u;
+    header->blobSize = 0u;
+    header->accessClock = 0u;
+    header->entryCount = 0u;
+    header->tombstoneCount = 0u;
+    std::atomic_ref<uint64_t>(header->blobGeneration).fetch_add(1u, std::memory_order_release);
+    std::atomic_ref<uint64_t>(header->magic).store(CompilerCacheIndexFormat::magic, std::memory_order_release);
+}
+
+void CompilerCacheIndexLinux::startEvictionThread() {
+    evictionThreadActive.store(true);
+    evictionThread = Thread::createFunc(evictionThreadFunc, reinterpret_cast<void *>(this));
+    if (evictionPending) {
+        requestEviction();
+    }
+}
+
+void *CompilerCacheIndexLinux::evictionThreadFunc(void *self) {
+    auto index = reinterpret_cast<CompilerCacheIndexLinux *>(self);
+    while (index->evictionThreadActive.load()) {
+        {
+            std::unique_lock<std::mutex> lock(index->evictionMtx);
+            index->evictionCondition.wait(lock, [index]() { return index->evictionRequested || !index->evictionThreadActive.load(); });
+            index->evictionRequested = false;
+        }
+
+        while (index->evictionThreadActive.load() && index->evictionStep()) {
+        }
+    }
+    return nullptr;
+}
+
+void CompilerCacheIndexLinux::requestEviction() {
+    {
+        std::lock_guard<std::mutex> lock(evictionMtx);
+        evictionRequested = true;
+    }
+    evictionCondition.notify_one();
+}
+
+void CompilerCacheIndexLinux::beginDestructiveUpdate() {
+    std::atomic_ref<uint64_t>(header->sequence).fetch_add(1u, std::memory_order_acq_rel);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void CompilerCacheIndexLinux::endDestructiveUpdate() {
+    std::atomic_thread_fence(std::memory_order_release);
+    std::atomic_ref<uint64_t>(header->sequence).fetch_add(1u, std::memory_order_acq_rel);
+}
+
+CompilerCacheIndexLinux::Entry *CompilerCacheIndexLinux::findEntry(std::string_view key) const {
+    const auto mask = bucketCount - 1;
+    const auto firstBucket = static_cast<uint32_t>(Hash::hash(key.data(), key.size())) & mask;
+    auto entries = getEntries();
+
+    for (uint32_t probe = 0u; probe < bucketCount; probe++) {
+        auto &entry = entries[(firstBucket + probe) & mask];
+        const auto state = std::atomic_ref<uint32_t>(entry.state).load(std::memory_order_acquire);
+        if (state == CompilerCacheIndexFormat::empty) {
+            return nullptr;
+        }
+        if (state == CompilerCacheIndexFormat::valid && getEntryKey(entry) == key) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CompilerCacheIndexLinux::Entry *CompilerCacheIndexLinux::findFreeSlot(std::string_view key) const {
+    const auto mask = bucketCount - 1;
+    const auto firstBucket = static_cast<uint32_t>(Hash::hash(key.data(), key.size())) & mask;
+    auto entries = getEntries();
+
+    for (uint32_t probe = 0u; probe < bucketCount; probe++) {
+        auto &entry = entries[(firstBucket + probe) & mask];
+        if (entry.state != CompilerCacheIndexFormat::valid) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CompilerCacheIndexLinux::removeEntry(Entry &entry) {
+    std::atomic_ref<uint32_t>(entry.state).store(CompilerCacheIndexFormat::tombstone, std::memory_order_release);
+    header->usedBytes -= entry.size;
+    header->entryCount--;
+    header->tombstoneCount++;
+}
+
+bool CompilerCacheIndexLinux::needsEviction() const {
+    const auto highWatermark = config.cacheSize - config.cacheSize / 8;
+    return header->usedBytes > highWatermark || header->entryCount > bucketCount / 4 * 3;
+}
+
+bool CompilerCacheIndexLinux::isAboveEvictionTarget() const {
+    const auto evictionTarget = config.cacheSize - config.cacheSize / 3;
+    return header->usedBytes > evictionTarget || header->entryCount > bucketCount / 2;
+}
+
+bool CompilerCacheIndexLinux::needsCompaction() const {
+    const auto deadBytes = header->blobSize - header->usedBytes;
+    return header->tombstoneCount > bucketCount / 4 ||
+           (deadBytes > header->usedBytes && deadBytes > config.cacheSize / 8);
+}
+
+bool CompilerCacheIndexLinux::reopenBlobFile() {
+    std::unique_lock<std::shared_mutex> lock(blobMtx);
+    const auto currentGeneration = std::atomic_ref<uint64_t>(header->blobGeneration).load(std::memory_order_acquire);
+    if (currentGeneration == blobGeneration.load()) {
+        return true;
+    }
+
+    int newBlobFd = NEO::SysCalls::openWithMode(blobPath.c_str(), O_CREAT | O_RDWR, cacheFileMode);
+    if (newBlobFd < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Reopening cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+
+    NEO::SysCalls::close(blobFd);
+    blobFd = newBlobFd;
+    blobGeneration.store(currentGeneration);
+    return true;
+}
+
+bool CompilerCacheIndexLinux::store(const std::string &cacheFileName, const char *pBinary, size_t binarySize) {
+    if (cacheFileName.length() > CompilerCacheIndexFormat::maxKeyLength) {
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Cache binary failed - cache file name is too long for cache index!\n", NEO::SysCalls::getProcessId());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(writerMtx);
+    IndexFileLock fileLock(indexFd);
+    if (!fileLock.isLocked()) {
+        return false;
+    }
+
+    if (findEntry(cacheFileName) != nullptr) {
+        return true;
+    }
+
+    const uint32_t maxEntryCount = bucketCount / 4 * 3;
+    while (header->usedBytes + binarySize > config.cacheSize || header->entryCount >= maxEntryCount) {
+        const uint32_t entriesToEvict = header->entryCount >= maxEntryCount ? header->entryCount - maxEntryCount + 1 : 0u;
+        const uint64_t bytesToFree = header->usedBytes + binarySize > config.cacheSize ? header->usedBytes + binarySize - config.cacheSize : 0u;
+        if (evictLocked(entriesToEvict, bytesToFree) == 0u) {
+            return false;
+        }
+    }
+
+    auto slot = findFreeSlot(cacheFileName);
+    if (slot == nullptr) {
+        if (!compactLocked()) {
+            return false;
+        }
+        slot = findFreeSlot(cacheFileName);
+        UNRECOVERABLE_IF(slot == nullptr);
+    }
+
+    if (!reopenBlobFile()) {
+        return false;
+    }
+
+    const auto offset = header->blobSize;
+    if (NEO::SysCalls::pwrite(blobFd, pBinary, binarySize, offset) != static_cast<ssize_t>(binarySize)) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Writing to cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+
+    if (slot->state == CompilerCacheIndexFormat::tombstone) {
+        header->tombstoneCount--;
+    }
+    memset(slot->key, 0, sizeof(slot->key));
+    memcpy(slot->key, cacheFileName.c_str(), cacheFileName.length());
+    slot->offset = offset;
+    slot->size = binarySize;
+    slot->lastAccess = std::atomic_ref<uint64_t>(header->accessClock).fetch_add(1u, std::memory_order_relaxed) + 1u;
+    std::atomic_ref<uint32_t>(slot->state).store(CompilerCacheIndexFormat::valid, std::memory_order_release);
+
+    header->blobSize += binarySize;
+    header->usedBytes += binarySize;
+    header->entryCount++;
+
+    if (needsEviction()) {
+        evictionPending = true;
+    }
+    if (evictionPending || needsCompaction()) {
+        requestEviction();
+    }
+    return true;
+}
+
+std::unique_ptr<char[]> CompilerCacheIndexLinux::load(const std::string &cacheFileName, size_t &binarySize) {
+    binarySize = 0u;
+    if (cacheFileName.length() > CompilerCacheIndexFormat::maxKeyLength) {
+        return nullptr;
+    }
+
+    std::atomic_ref<uint64_t> sequence(header->sequence);
+    for (uint32_t retry = 0u; retry < maxReadRetries; retry++) {
+        const auto sequenceBefore = sequence.load(std::memory_order_acquire);
+        if ((sequenceBefore & 1u) != 0u) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        auto entry = findEntry(cacheFileName);
+        if (entry == nullptr) {
+            if (sequence.load(std::memory_order_acquire) == sequenceBefore) {
+                return nullptr;
+            }
+            continue;
+        }
+
+        const auto offset = std::atomic_ref<uint64_t>(entry->offset).load(std::memory_order_relaxed);
+        const auto size = std::atomic_ref<uint64_t>(entry->size).load(std::memory_order_relaxed);
+        if (size == 0u || size > config.cacheSize) {
+            continue;
+        }
+
+        if (std::atomic_ref<uint64_t>(header->blobGeneration).load(std::memory_order_acquire) != blobGeneration.load() && !reopenBlobFile()) {
+            return nullptr;
+        }
+
+        auto data = std::make_unique<char[]>(size);
+        ssize_t readBytes = 0;
+        {
+            std::shared_lock<std::shared_mutex> lock(blobMtx);
+            readBytes = NEO::SysCalls::pread(blobFd, data.get(), size, offset);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_acquire) != sequenceBefore) {
+            continue;
+        }
+        if (readBytes != static_cast<ssize_t>(size)) {
+            return nullptr;
+        }
+
+        const auto accessTime = std::atomic_ref<uint64_t>(header->accessClock).fetch_add(1u, std::memory_order_relaxed) + 1u;
+        std::atomic_ref<uint64_t>(entry->lastAccess).store(accessTime, std::memory_order_relaxed);
+
+        binarySize = size;
+        return data;
+    }
+
+    return nullptr;
+}
+
+uint32_t CompilerCacheIndexLinux::evictLocked(uint32_t minEntriesToEvict, uint64_t minBytesToFree) {
+    using Candidate = std::pair<uint64_t, Entry *>;
+    std::priority_queue<Candidate> oldestEntries;
+
+    auto entries = getEntries();
+    for (uint32_t i = 0u; i < bucketCount; i++) {
+        auto &entry = entries[i];
+        if (entry.state != CompilerCacheIndexFormat::valid) {
+            continue;
+        }
+        const auto lastAccess = std::atomic_ref<uint64_t>(entry.lastAccess).load(std::memory_order_relaxed);
+        if (oldestEntries.size() < entriesEvictedPerStep) {
+            oldestEntries.push({lastAccess, &entry});
+        } else if (lastAccess < oldestEntries.top().first) {
+            oldestEntries.pop();
+            oldestEntries.push({lastAccess, &entry});
+        }
+    }
+
+    std::vector<Entry *> candidates;
+    candidates.reserve(oldestEntries.size());
+    while (!oldestEntries.empty()) {
+        candidates.push_back(oldestEntries.top().second);
+        oldestEntries.pop();
+    }
+
+    uint32_t evictedCount = 0u;
+    uint64_t freedBytes = 0u;
+
+    beginDestructiveUpdate();
+    for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+        if (evictedCount >= minEntriesToEvict && freedBytes >= minBytesToFree) {
+            break;
+        }
+        freedBytes += (*it)->size;
+        removeEntry(**it);
+        evictedCount++;
+    }
+    endDestructiveUpdate();
+
+    return evictedCount;
+}
+
+bool CompilerCacheIndexLinux::compactLocked() {
+    if (!reopenBlobFile()) {
+        return false;
+    }
+
+    std::string tmpBlobPath = blobPath + ".XXXXXX";
+    int newBlobFd = NEO::SysCalls::mkstemp(tmpBlobPath.data());
+    if (newBlobFd < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Creating temporary cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        return false;
+    }
+
+    std::vector<Entry> liveEntries;
+    liveEntries.reserve(header->entryCount);
+    std::vector<char> copyBuffer;
+    uint64_t newBlobSize = 0u;
+
+    auto entries = getEntries();
+    for (uint32_t i = 0u; i < bucketCount; i++) {
+        if (entries[i].state != CompilerCacheIndexFormat::valid) {
+            continue;
+        }
+        auto entry = entries[i];
+        copyBuffer.resize(entry.size);
+        if (NEO::SysCalls::pread(blobFd, copyBuffer.data(), entry.size, entry.offset) != static_cast<ssize_t>(entry.size) ||
+            NEO::SysCalls::pwrite(newBlobFd, copyBuffer.data(), entry.size, newBlobSize) != static_cast<ssize_t>(entry.size)) {
+            int error = errno;
+            PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Compacting cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+            NEO::SysCalls::close(newBlobFd);
+            NEO::SysCalls::unlink(tmpBlobPath);
+            return false;
+        }
+        entry.offset = newBlobSize;
+        newBlobSize += entry.size;
+        liveEntries.push_back(entry);
+    }
+
+    beginDestructiveUpdate();
+
+    if (NEO::SysCalls::rename(tmpBlobPath.c_str(), blobPath.c_str()) < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Replacing cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        endDestructiveUpdate();
+        NEO::SysCalls::close(newBlobFd);
+        NEO::SysCalls::unlink(tmpBlobPath);
+        return false;
+    }
+
+    memset(entries, 0, static_cast<size_t>(bucketCount) * sizeof(Entry));
+    for (const auto &liveEntry : liveEntries) {
+        auto slot = findFreeSlot(getEntryKey(liveEntry));
+        *slot = liveEntry;
+    }
+    header->tombstoneCount = 0u;
+    header->blobSize = newBlobSize;
+
+    {
+        std::unique_lock<std::shared_mutex> lock(blobMtx);
+        NEO::SysCalls::close(blobFd);
+        blobFd = newBlobFd;
+        blobGeneration.store(std::atomic_ref<uint64_t>(header->blobGeneration).fetch_add(1u, std::memory_order_release) + 1u);
+    }
+
+    endDestructiveUpdate();
+    return true;
+}
+
+bool CompilerCacheIndexLinux::evictionStep() {
+    std::lock_guard<std::mutex> lock(writerMtx);
+    IndexFileLock fileLock(indexFd);
+    if (!fileLock.isLocked()) {
+        return false;
+    }
+
+    if (evictionPending) {
+        if (isAboveEvictionTarget()) {
+            const auto evictionTarget = config.cacheSize - config.cacheSize / 3;
+            const auto maxEntryCount = bucketCount / 2;
+            const uint32_t entriesToEvict = header->entryCount > maxEntryCount ? header->entryCount - maxEntryCount : 0u;
+            const uint64_t bytesToFree = header->usedBytes > evictionTarget ? header->usedBytes - evictionTarget : 0u;
+            if (evictLocked(entriesToEvict, bytesToFree) > 0u) {
+                return true;
+            }
+        }
+        evictionPending = false;
+    }
+
+    if (needsCompaction()) {
+        compactLocked();
+    }
+    return false;
+}
+
+bool CompilerCacheIndexLinux::clear() {
+    std::lock_guard<std::mutex> lock(writerMtx);
+    IndexFileLock fileLock(indexFd);
+    if (!fileLock.isLocked()) {
+        return false;
+    }
+
+    beginDestructiveUpdate();
+
+    int truncatedBlobFd = NEO::SysCalls::openWithMode(blobPath.c_str(), O_CREAT | O_TRUNC | O_RDWR, cacheFileMode);
+    if (truncatedBlobFd < 0) {
+        int error = errno;
+        PRINT_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Truncating cache blob file failed! errno: %d\n", NEO::SysCalls::getProcessId(), error);
+        endDestructiveUpdate();
+        return false;
+    }
+
+    initializeIndex(bucketCount);
+    {
+        std::unique_lock<std::shared_mutex> blobLock(blobMtx);
+        NEO::SysCalls::close(blobFd);
+        blobFd = truncatedBlobFd;
+        blobGeneration.store(header->blobGeneration);
+    }
+    evictionPending = false;
+
+    endDestructiveUpdate();
+    return true;
+}
+
+} // namespace NEO
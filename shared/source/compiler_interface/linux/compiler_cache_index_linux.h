@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_index.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
+namespace NEO {
+class Thread;
+
+namespace CompilerCacheIndexFormat {
+inline constexpr uint64_t magic = 0x58494343'4f454e00; // "\0NEOCCIX"
+inline constexpr uint32_t version = 1u;
+inline constexpr uint32_t defaultBucketCount = 65536u;
+inline constexpr size_t maxKeyLength = 31u;
+
+enum EntryState : uint32_t {
+    empty = 0u,
+    valid = 1u,
+    tombstone = 2u
+};
+
+struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t bucketCount;
+    uint64_t sequence;
+    uint64_t usedBytes;
+    uint64_t blobSize;
+    uint64_t blobGeneration;
+    uint64_t accessClock;
+    uint32_t entryCount;
+    uint32_t tombstoneCount;
+};
+static_assert(sizeof(Header) == 64);
+
+struct Entry {
+    char key[maxKeyLength + 1];
+    uint64_t offset;
+    uint64_t size;
+    uint64_t lastAccess;
+    uint32_t state;
+    uint32_t reserved;
+};
+static_assert(sizeof(Entry) == 64);
+} // namespace CompilerCacheIndexFormat
+
+class CompilerCacheIndexLinux : public CompilerCacheIndex {
+  public:
+    using Header = CompilerCacheIndexFormat::Header;
+    using Entry = CompilerCacheIndexFormat::Entry;
+
+    CompilerCacheIndexLinux(const CompilerCacheConfig &config, uint32_t bucketCount);
+    ~CompilerCacheIndexLinux() override;
+
+    bool open();
+    void startEvictionThread();
+
+    bool store(const std::string &cacheFileName, const char *pBinary, size_t binarySize) override;
+    std::unique_ptr<char[]> load(const std::string &cacheFileName, size_t &binarySize) override;
+    bool clear() override;
+
+    static constexpr std::string_view indexFileName = "cache.index";
+    static constexpr std::string_view blobFileName = "cache.blob";
+    static constexpr uint32_t maxReadRetries = 8u;
+    static constexpr uint32_t entriesEvictedPerStep = 64u;
+
+  protected:
+    MOCKABLE_VIRTUAL bool evictionStep();
+    MOCKABLE_VIRTUAL uint32_t evictLocked(uint32_t minEntriesToEvict, uint64_t minBytesToFree);
+    MOCKABLE_VIRTUAL bool compactLocked();
+    static void *evictionThreadFunc(void *self);
+
+    void initializeIndex(uint32_t newBucketCount);
+    bool reopenBlobFile();
+    Entry *findEntry(std::string_view key) const;
+    Entry *findFreeSlot(std::string_view key) const;
+    void removeEntry(Entry &entry);
+    bool needsEviction() const;
+    bool isAboveEvictionTarget() const;
+    bool needsCompaction() const;
+    void requestEviction();
+    void beginDestructiveUpdate();
+    void endDestructiveUpdate();
+
+    size_t getMappingSize() const {
+        return sizeof(Header) + static_cast<size_t>(bucketCount) * sizeof(Entry);
+    }
+    Entry *getEntries() const {
+        return reinterpret_cast<Entry *>(reinterpret_cast<char *>(header) + sizeof(Header));
+    }
+
+    const CompilerCacheConfig config;
+    const std::string indexPath;
+    const std::string blobPath;
+
+    Header *header = nullptr;
+    uint32_t bucketCount = 0u;
+    int indexFd = -1;
+
+    std::shared_mutex blobMtx;
+    int blobFd = -1;
+    std::atomic<uint64_t> blobGeneration{0u};
+
+    std::mutex writerMtx;
+    bool evictionPending = false;
+
+    std::unique_ptr<Thread> evictionThread;
+    std::mutex evictionMtx;
+    std::condition_variable evictionCondition;
+    bool evictionRequested = false;
+    std::atomic<bool> evictionThreadActive{false};
+};
+
+} // namespace NEO
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_index.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
@@ -425,6 +426,10 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
         return false;
     }
 
+    if (index) {
+        return index->store(kernelFileHash + config.cacheFileExtension, pBinary, binarySize);
+    }
+
     std::unique_lock<std::mutex> lock(cacheAccessMtx);
     constexpr std::string_view configFileName = "config.file";
 
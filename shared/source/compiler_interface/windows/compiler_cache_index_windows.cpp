@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_index.h"
+
+namespace NEO {
+
+std::unique_ptr<CompilerCacheIndex> CompilerCacheIndex::create(const CompilerCacheConfig &config) {
+    return nullptr;
+}
+
+} // namespace NEO
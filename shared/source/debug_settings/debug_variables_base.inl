@@ -233,6 +233,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedKernelIsaSize, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, FillBufferTailWithPattern, 0, "Fill extended buffer tail with pattern when ForceExtendedBufferSize is enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceSimdMessageSizeInWalker, -1, "-1: default, >=0 Program given value in Walker command for SIMD size")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuStreamMemcpy, -1, "-1: default, 0: disable, 1: enable, Use CPU stream memcpy for L0 in zeAppendMemoryCopy")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyNonTemporalThreshold, -1, "-1: default - disabled, >=0: size in KB from which CPU copies use non-temporal stores")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyThreads, -1, "-1: default - single thread, >1: max number of threads, the calling one included, large CPU copies are split across")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyParallelThreshold, -1, "-1: default - 64 MB, >=0: size in KB from which CPU copies are split across threads when CpuCopyThreads is set")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRecoverablePageFaults, -1, "-1: default - ignore, 0: disable, 1: enable recoverable page faults on all VMs (on faultable hardware)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImplicitMigrationOnFaultableHardware, -1, "-1: default - ignore, 0: disable, 1: enable implicit migration on faultable hardware (for all allocations)")
 DECLARE_DEBUG_VARIABLE(int32_t, UseDrmVirtualEnginesForCcs, -1, "-1: default, 0: disable, 1: enable,  Combine all CCS nodes to single VE (per context)")
@@ -287,6 +290,8 @@ DECLARE_DEBUG_VARIABLE(int64_t, InitialCounterBasedEventValue, -1, "-1: default,
 DECLARE_DEBUG_VARIABLE(int32_t, ForceTlbFlush, -1, "-1: default,  0: Tlb flush disabled, 1: Tlb Flush enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, AllowDcFlush, -1, "-1: default,  0: DC flush disabled, 1: DC flush enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugSetMemoryDiagnosticsDelay, -1, "-1: default, >=0: delay time in minutes necessary for completion of Memory diagnostics")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySnapshotLifetimeUs, -1, "-1: default (disabled), 0: disabled, >0: Sysman keeps PMT telem files open and serves telemetry reads from a snapshot of the whole key region refreshed by a single pread once older than given number of microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanProcessFdsCacheLifetimeMs, -1, "-1: default (disabled), 0: disabled, >0: zesDeviceProcessesGetState caches device file descriptors per process and re-resolves /proc fd links only for processes whose start time or fd list changed; entries are fully revalidated once older than given number of milliseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceStateVerification, -1, "-1: default, 0: disable, 1: enable check of device state before submit on Windows")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceStateVerificationAfterFailedSubmission, -1, "-1: default, 0: disable, 1: enable check of device state after failed submit on Windows")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintTimestampPacketUsage, -1, "-1: default, 0: Disabled, 1: Print when TSP is allocated, initialized, returned to pool, etc.")
@@ -318,6 +323,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceScratchAndMTPBufferSizeMode, -1, "-1: defau
 DECLARE_DEBUG_VARIABLE(int32_t, CFEStackIDControl, -1, "Set Stack ID Control in CFE_STATE on Xe2+, -1 - do not set")
 DECLARE_DEBUG_VARIABLE(int32_t, ClearStandaloneInOrderTimestampAllocation, -1, "-1: default, 0: disabled, 1: enabled. If clear allocation before sending to GPU")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPoolAllocator, -1, "-1: default, 0: disabled, 1: enabled. If enabled, timestamp allocations are pooled and reused across multiple event pools")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLockFreeTagAllocator, -1, "-1: default, 0: disabled, 1: enabled. If enabled, TagAllocator keeps free tags on a lock-free stack with per-thread caches and does not track used tags")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceComputeWalkerPostSyncFlushWithWrite, -1, "-1: ignore. >=0: Force PostSync cache flush and override postSync immediate write address to given value")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferStateInitSubmissionToFirstRegularUsage, -1, "-1: ignore, 0: disabled, 1: enabled. If set, instead of initializing at Device creation, submit initial state during first usage (eg. kernel submission)")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceNonWalkerSplitMemoryCopy, -1, "-1: default, 0: disabled, 1: enabled. If set, memory copy will be executed as single byte copy Walker without performance optimizations")
@@ -329,6 +335,11 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceIndirectDetectionForCMKernels, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, PipelinedEuThreadArbitration, -1, "-1: default. 1: Use Walker field, 0: Use StateComputeMode command to program pipelinedEuThreadArbitration")
 DECLARE_DEBUG_VARIABLE(bool, ForceUseOnlyGlobalTimestamps, 0, "0: default disabled, 1: enable use only global timestamp")
 DECLARE_DEBUG_VARIABLE(int32_t, GetSipBinaryFromExternalLib, -1, "-1: default, 0: disabled, 1: enabled. If enabled, then retrieve Sip from external library")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePersistentBuiltInsCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, device binaries of built-in kernels and SIP are kept in NEO_CACHE_DIR per device IP version and driver build and reused by later processes")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelModuleInitializationThreads, -1, "-1: default (disabled), 0, 1: disabled, >1: max number of threads decoding kernels, initializing kernel data and staging kernel ISA during Level Zero module initialization")
+DECLARE_DEBUG_VARIABLE(int32_t, UseVectorizedZeInfoTokenizer, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, .ze_info is tokenized by scanning character runs in SIMD blocks with caches reserved upfront from the input size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyIsaUpload, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, ISA of user module kernels is uploaded on first zeKernelCreate instead of module creation; deferred and never uploaded bytes are printed with PrintDebugMessages")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncModuleBuildThreads, -1, "-1: default (disabled), 0: disabled, >0: max number of compiler worker threads. If enabled, SPIR-V user modules are built on a per-driver worker pool; zeModuleCreate returns before the build completes and the first call needing the build result waits for it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCopyOffloadMode, -1, "-1: default, 0: disabled, >=1: if enabled, override to any value from CopyOffloadModes enum")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideFillCopyOffloadThresholdKb, -1, "-1: default, >0: if copy offload is enabled, offload fill operations if size is below this threshold (in kb)")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxMemAllocSizeMb, -1, "-1: default, >=0 override reported max mem alloc size in MB")
@@ -419,6 +430,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogGdiCalls, false, "Log GDI calls")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintGmmCompressionParams, false, "Print Gmm compression resource params")
 DECLARE_DEBUG_VARIABLE(bool, PrintCpuFlags, false, "Print CPU Flags and properties upon detection")
+DECLARE_DEBUG_VARIABLE(bool, PrintCpuCopyBandwidth, false, "Print size, threads, store type and achieved bandwidth of CPU copies")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintL0MetricLogs, 0, "L0 Metrics logs mask. 0 - Disabled, 1 - ERROR, 3 - INFO, 7 - DEBUG")
 DECLARE_DEBUG_VARIABLE(bool, PrintL0SetKernelArg, false, "Print L0 Set Kernel Arg data")
 DECLARE_DEBUG_VARIABLE(bool, LogIndirectDetectionKernelDetails, false, "Log information for indirect detection for each kernel")
@@ -461,6 +473,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, MakeIndirectAllocationsResidentAsPack, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver handles all indirect allocations as one pack instead of making them resident individually.")
 DECLARE_DEBUG_VARIABLE(int32_t, DetectIndirectAccessInKernel, -1, "-1: default, 0:disabled, 1: enabled. If enabled and indirect accesses are not detected in kernel, indirect allocations will not be allowed even if set by API.")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeEachAllocationResident, -1, "-1: default, 0: disabled, 1: bind every allocation at creation time, 2: bind all created allocations in flush")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableResidencyDeltaTracking, -1, "-1: default, 0: disabled, 1: enabled. If enabled, vm_bind residency handler processes in flush only allocations not made resident since last eviction or free")
 DECLARE_DEBUG_VARIABLE(int32_t, AssignBCSAtEnqueue, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQGpgpuInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
@@ -483,6 +496,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocationsPerCmdQueue, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers for each initialized opencl command queue.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfInternalHeapsToPreallocate, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of internal heaps when initializing csr.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
+DECLARE_DEBUG_VARIABLE(int32_t, UseSizeClassHeapAllocator, -1, "-1: default (none), >0: bitmask of HeapIndex values whose GPU VA heap allocator uses size-class segregated free lists instead of linear free chunk lists")
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as secondary, 1: dispatch command buffers as primary and chain")
 DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use regular flush task, 1: use immediate flush task")
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
@@ -498,6 +512,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableLinearStreamPoolAllocator, -1, "-1: defaul
 DECLARE_DEBUG_VARIABLE(int32_t, EnableInternalHeapPoolAllocator, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandBufferPoolAllocator, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmPoolLazyInit, -1, "-1: default, 0: disabled, 1: enabled, initialize usm pools on first alloc")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLockFreeSvmAllocLookup, -1, "-1: default (disabled), 0: disabled, 1: enabled, resolve pointers to svm allocations from published snapshot without taking container lock")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedAllocationMigrationChunkSize, -1, "-1: default (migrate whole allocation), >0: size in KB of chunks in which shared allocations are migrated between CPU and GPU, only touched chunks are migrated and re-protected")
 DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use localPreferred for cacheable buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyWithStagingBuffers, -1, "Enable copy with non-usm memory through staging buffers. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferSize, -1, "Size of single staging buffer. -1: default (2MB), >0: size in KB")
@@ -517,6 +533,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideSemaphoreInterrupt, -1, "Override MMI_SE
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideFastModePoll, -1, "Override MI_SEMAPHORE_WAIT_64 fast mode poll bit. -1: default (disable), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, OverridePreferredWorkgroupCountPerSubslice, -1, "Override preferred workgroup count per subslice. -1: default, >=0: override value")
 DECLARE_DEBUG_VARIABLE(int32_t, CacheThreadDataForIOH, -1, "When enabled, cache thread data for IOH programming. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchTemplateCache, -1, "When enabled, kernel-static part of the walker is encoded once per kernel and copied on subsequent dispatches. -1: default, 0: disabled, 1: enabled")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -555,6 +572,7 @@ DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address
 DECLARE_DEBUG_VARIABLE(int32_t, WaitForPagingFenceInController, -1, "Instead of waiting for paging fence on user thread, program additional semaphore which will be signaled by direct submission controller when paging fence reaches required value -1: default, 0 - disable, 1 - enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerIdleDetection, -1, "Terminate direct submission only if CSR is idle. -1: default, 0 - disable, 1 - enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerContextGroupIdleDetection, -1, "Terminate direct submission only if all CSRs in group are idle. -1: default, 0 - disable, 1 - enable.")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptiveTermination, -1, "Learn per-CSR idle gaps between submissions and stop each ring buffer when its next submission is not expected soon. -1: default (disabled), 0 - disable, 1 - enable.")
 DECLARE_DEBUG_VARIABLE(int64_t, DirectSubmissionInitialSemaphoreValue, -1, "-1: default, [1 ...  (uint32_t::max - 1)]: initial semaphore counter value.")
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, RegisterPageFaultHandlerOnMigration, false, "Register handler on migration to GPU when current is not from pagefault manager")
@@ -576,16 +594,20 @@ DECLARE_DEBUG_VARIABLE(bool, EnableAIL, true, "Enables AIL")
 DECLARE_DEBUG_VARIABLE(bool, EnableReservingInSvmRange, true, "Enables reserving virtual memory in the SVM range")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeferBacking, -1, "Enables defer backing on xe kmd, -1:default(enabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(bool, DisableProgrammableMetricsSupport, false, "Disable Programmable Metrics support")
+DECLARE_DEBUG_VARIABLE(int32_t, IpSamplingStreamingRingSizeKB, -1, "-1: default (disabled), 0: disabled, >0: EU stall data is drained from the KMD stream by a background thread into a lock-free ring of given size in KB, which metric streamer reads are served from")
+DECLARE_DEBUG_VARIABLE(int32_t, IpSamplingCalculationThreads, -1, "-1: default (1), >1: maximal number of threads decoding large IP sampling raw data buffers during metric calculation, chunk results are merged in raw data order")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitNumGrfsSupported, 512, "Limit the supported number of GRFs per thread")
 DECLARE_DEBUG_VARIABLE(bool, WddmUseHw64bToken, true, "Set UseHw64bToken on context and native fence creation, requires 64BitSemaphore")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideWddmContextPowerHint, -1, "Override Wddm CREATECONTEXT_PVTDATA.PowerHint value. -1: default (controlled by driver), >=0: override to given value")
 DECLARE_DEBUG_VARIABLE(bool, DisableKmdSubmissionForTimestamps, false, "Do not use KMD when querying GPU timestamps, calculate it on CPU side instead.")
 DECLARE_DEBUG_VARIABLE(int64_t, VmBindWaitUserFenceTimeout, -1, "-1: default, >0: time in ns for wait function timeout")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableXeVmBindBatching, -1, "-1: default, 0: disabled, 1: enabled. If enabled, xe vm_bind map operations are queued and submitted as one multi-op vm_bind at next exec, fence wait or unbind")
 
 DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of run-alone HW context, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerMaxHelperThreads, -1, "Maximal number of additional threads closing gem objects when close worker backlog is large, -1:default (0), >=0: number of threads")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled for every enqueue, 2: disabled, except image from buffer access")
@@ -678,6 +700,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Expe
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableSharedAllocationCache, -1, "Experimentally enable shared usm allocation cache. Use X% of device memory.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseCleaner, -1, "Enable usm allocation reuse cleaner. -1: default, 0: disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseLimitThreshold, -1, "Threshold of used memory to limit usm reuse. -1: default, 0: disable, >0:X% of shared/device memory")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseSizeBuckets, -1, "Keep usm reuse cache in power of two size buckets with per bucket locks. -1: default (disabled), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
@@ -143,6 +143,7 @@ DecodeError decodeSingleZebin(ProgramInfo &dst, const SingleDeviceBinary &src, s
     dst.indirectAccessBufferMajorVersion = generatorFeatures.indirectAccessBuffer;
     dst.samplerStateSize = src.targetDevice.samplerStateSize;
     dst.samplerBorderColorStateSize = src.targetDevice.samplerBorderColorStateSize;
+    dst.maxKernelDecodeThreads = src.maxDecodeThreads;
 
     auto decodeError = NEO::Zebin::decodeZebin<numBits>(dst, elf, outErrReason, outWarning);
     if (DecodeError::success != decodeError) {
@@ -99,6 +99,7 @@ struct SingleDeviceBinary {
     GeneratorType generator = GeneratorType::igc;
     GeneratorFeatureVersions generatorFeatureVersions;
     Zebin::ZeInfo::Types::L1CachePolicy::L1CachePolicy l1CachePolicy = Zebin::ZeInfo::Types::L1CachePolicy::Defaults::l1CachePolicy;
+    uint32_t maxDecodeThreads = 1u;
 };
 
 inline specConstValuesMap getSpecConstantsFromBinary(const SingleDeviceBinary &binary) {
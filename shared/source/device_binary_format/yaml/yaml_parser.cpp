@@ -7,10 +7,98 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 namespace NEO {
 
 namespace Yaml {
 
+namespace Vectorized {
+
+#if defined(__SSE2__) || defined(_M_X64)
+constexpr size_t blockSize = sizeof(__m128i);
+constexpr uint32_t fullBlockMask = (1u << blockSize) - 1;
+
+inline __m128i isInRange(__m128i characters, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8(last + 1)));
+}
+
+inline __m128i isEqual(__m128i characters, char c) {
+    return _mm_cmpeq_epi8(characters, _mm_set1_epi8(c));
+}
+
+// bit per character of the block, set when the character is a name identifier character or separation whitespace
+inline uint32_t getNameIdentifierMask(const char *block) {
+    auto characters = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+    auto letters = isInRange(_mm_or_si128(characters, _mm_set1_epi8(0x20)), 'a', 'z'); // 0x20 maps upper case letters to lower case
+    auto numbers = isInRange(characters, '0', '9');
+    auto dashOrDot = isInRange(characters, '-', '.');
+    auto underscore = isEqual(characters, '_');
+    auto separation = _mm_or_si128(isEqual(characters, ' '), isEqual(characters, '\t'));
+    auto matched = _mm_or_si128(_mm_or_si128(letters, numbers), _mm_or_si128(_mm_or_si128(dashOrDot, underscore), separation));
+    return static_cast<uint32_t>(_mm_movemask_epi8(matched));
+}
+
+inline uint32_t getSpaceMask(const char *block) {
+    auto characters = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+    return static_cast<uint32_t>(_mm_movemask_epi8(isEqual(characters, ' ')));
+}
+#endif
+
+const char *consumeSpaces(const char *parsePos, const char *parseEnd) {
+#if defined(__SSE2__) || defined(_M_X64)
+    while (static_cast<size_t>(parseEnd - parsePos) >= blockSize) {
+        auto mismatched = ~getSpaceMask(parsePos) & fullBlockMask;
+        if (0u != mismatched) {
+            return parsePos + std::countr_zero(mismatched);
+        }
+        parsePos += blockSize;
+    }
+#endif
+    while ((parsePos < parseEnd) && (' ' == *parsePos)) {
+        ++parsePos;
+    }
+    return parsePos;
+}
+
+const char *consumeNameIdentifier(ConstStringRef wholeText, const char *parsePos) {
+    if (false == isNameIdentifierBeginningCharacter(*parsePos)) {
+        return parsePos;
+    }
+    auto parseEnd = wholeText.end();
+    auto it = parsePos + 1;
+#if defined(__SSE2__) || defined(_M_X64)
+    while (static_cast<size_t>(parseEnd - it) >= blockSize) {
+        auto mismatched = ~getNameIdentifierMask(it) & fullBlockMask;
+        if (0u != mismatched) {
+            return it + std::countr_zero(mismatched);
+        }
+        it += blockSize;
+    }
+#endif
+    while ((it < parseEnd) && (isNameIdentifierCharacter(*it) || isSeparationWhitespace(*it))) {
+        ++it;
+    }
+    return it;
+}
+
+const char *findLineEnd(const char *parsePos, const char *parseEnd) {
+    if (parsePos >= parseEnd) {
+        return parseEnd;
+    }
+    // memchr implementations are vectorized on all supported platforms
+    auto lineEnd = static_cast<const char *>(std::memchr(parsePos, '\n', parseEnd - parsePos));
+    return (nullptr != lineEnd) ? lineEnd : parseEnd;
+}
+
+} // namespace Vectorized
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason) {
     auto ret = "NEO::Yaml : Could not parse line : [" + std::to_string(lineNumber) + "] : [" + ConstStringRef(lineBeg, parsePos - lineBeg + 1).str() + "] <-- parser position on error";
     if (nullptr != reason) {
@@ -148,7 +236,7 @@ bool isValidInlineCollectionFormat(const char *context, const char *contextEnd)
     return endCollection;
 }
 
-bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerMode mode) {
     if (text.empty()) {
         outWarning.append("NEO::Yaml : input text is empty\n");
         return true;
@@ -157,10 +245,25 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
+    const bool vectorized = (TokenizerMode::vectorized == mode);
+    if (vectorized) {
+        auto linesCount = static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+        outLines.reserve(outLines.size() + linesCount);
+        outTokens.reserve(outTokens.size() + linesCount * estimatedTokensPerLine);
+    }
+
     while (context.pos < context.end) {
-        reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
+        if (false == vectorized) {
+            reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
+        }
         switch (context.pos[0]) {
         case ' ':
+            if (vectorized) {
+                auto spacesEnd = Vectorized::consumeSpaces(context.pos, context.end);
+                context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0;
+                context.pos = spacesEnd;
+                break;
+            }
             context.lineIndent += context.isParsingIdent ? 1 : 0;
             ++context.pos;
             break;
@@ -179,6 +282,9 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
             auto commentIt = context.pos + 1;
+            if (vectorized) {
+                commentIt = Vectorized::findLineEnd(commentIt, context.end);
+            }
             while (commentIt < context.end) {
                 if ('\n' == commentIt[0]) {
                     break;
@@ -192,7 +298,9 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         }
         case '\n': {
-            reserveBasedOnEstimates(outLines, text.begin(), text.end(), context.pos);
+            if (false == vectorized) {
+                reserveBasedOnEstimates(outLines, text.begin(), text.end(), context.pos);
+            }
             if (false == tokenizeEndLine(text, outLines, outTokens, outErrReason, outWarning, context)) {
                 return false;
             }
@@ -276,7 +384,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         default: {
             context.isParsingIdent = false;
-            auto tokEnd = consumeNameIdentifier(text, context.pos);
+            auto tokEnd = vectorized ? Vectorized::consumeNameIdentifier(text, context.pos) : consumeNameIdentifier(text, context.pos);
             if (tokEnd != context.pos) {
                 auto tokenData = ConstStringRef(context.pos, tokEnd - context.pos);
                 tokenData = tokenData.trimEnd(isWhitespace);
@@ -314,7 +314,21 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
 bool isValidInlineCollectionFormat(const char *context, const char *contextEnd);
 constexpr ConstStringRef inlineCollectionYamlErrorMsg = "NEO::Yaml : Inline collection is not in valid regex format - ^\\[(\\s*(\\d|\\w)+,?)*\\s*\\]\\s*\\n";
 
-bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
+enum class TokenizerMode : uint8_t {
+    scalar,
+    vectorized // produces the same tokens and lines, but scans character runs in blocks and reserves caches upfront
+};
+
+namespace Vectorized {
+// counterparts of the scalar helpers that classify 16 characters at a time where SSE2 is available
+const char *consumeSpaces(const char *parsePos, const char *parseEnd);
+const char *consumeNameIdentifier(ConstStringRef wholeText, const char *parsePos);
+const char *findLineEnd(const char *parsePos, const char *parseEnd);
+} // namespace Vectorized
+
+inline constexpr size_t estimatedTokensPerLine = 5u;
+
+bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerMode mode = TokenizerMode::scalar);
 
 using NodeId = uint32_t;
 constexpr NodeId invalidNodeID = std::numeric_limits<NodeId>::max();
@@ -485,8 +499,14 @@ struct YamlParser {
     YamlParser() {
     }
 
+    explicit YamlParser(TokenizerMode tokenizerMode) : tokenizerMode(tokenizerMode) {
+    }
+
     bool parse(const ConstStringRef text, std::string &outErrReason, std::string &outWarning) {
-        auto success = NEO::Yaml::tokenize(text, lines, tokens, outErrReason, outWarning);
+        auto success = NEO::Yaml::tokenize(text, lines, tokens, outErrReason, outWarning, tokenizerMode);
+        if (success && (TokenizerMode::vectorized == tokenizerMode)) {
+            nodes.reserve(lines.size() + 1);
+        }
         success = success && NEO::Yaml::buildTree(lines, tokens, nodes, outErrReason, outWarning);
         if (false == success) {
             nodes.clear();
@@ -595,6 +615,7 @@ struct YamlParser {
     TokensCache tokens;
     LinesCache lines;
     NodesCache nodes;
+    TokenizerMode tokenizerMode = TokenizerMode::scalar;
 };
 
 template <>
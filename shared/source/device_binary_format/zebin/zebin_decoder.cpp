@@ -18,6 +18,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/logger.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "neo_aot_platforms.h"
 
@@ -475,13 +476,16 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
 
     handleTextSection(dst, elf, zebinSections);
 
-    for (auto &kernelInfo : dst.kernelInfos) {
+    // kernels are independent of each other, the first one without text section (in kernel order) is reported
+    std::vector<uint8_t> kernelHeapFound(dst.kernelInfos.size(), 0u);
+    parallelFor(dst.kernelInfos.size(), dst.maxKernelDecodeThreads, ZeInfo::kernelDecodeChunkSize, [&](size_t kernelId) {
+        auto kernelInfo = dst.kernelInfos[kernelId];
         ConstStringRef kernelName(kernelInfo->kernelDescriptor.kernelMetadata.kernelName);
         auto kernelInstructions = getKernelHeap(kernelName, elf, zebinSections);
         if (kernelInstructions.empty()) {
-            outErrReason.append("DeviceBinaryFormat::zebin : Could not find text section for kernel " + kernelName.str() + "\n");
-            return DecodeError::invalidBinary;
+            return;
         }
+        kernelHeapFound[kernelId] = 1u;
 
         auto gtpinInfoForKernel = getKernelGtpinInfo(kernelName, elf, zebinSections);
         if (false == gtpinInfoForKernel.empty()) {
@@ -499,6 +503,13 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
         auto &kernelDSH = kernelInfo->kernelDescriptor.generatedDsh;
         kernelInfo->heapInfo.pDsh = kernelDSH.data();
         kernelInfo->heapInfo.dynamicStateHeapSize = static_cast<uint32_t>(kernelDSH.size());
+    });
+
+    for (size_t kernelId = 0u; kernelId < kernelHeapFound.size(); kernelId++) {
+        if (0u == kernelHeapFound[kernelId]) {
+            outErrReason.append("DeviceBinaryFormat::zebin : Could not find text section for kernel " + dst.kernelInfos[kernelId]->kernelDescriptor.kernelMetadata.kernelName + "\n");
+            return DecodeError::invalidBinary;
+        }
     }
 
     return DecodeError::success;
@@ -19,6 +19,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <sstream>
 
@@ -445,7 +446,8 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
 }
 
 DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning) {
-    Yaml::YamlParser yamlParser;
+    auto tokenizerMode = (1 == debugManager.flags.UseVectorizedZeInfoTokenizer.get()) ? Yaml::TokenizerMode::vectorized : Yaml::TokenizerMode::scalar;
+    Yaml::YamlParser yamlParser{tokenizerMode};
     bool parseSuccess = yamlParser.parse(zeInfo, outErrReason, outWarning);
     if (false == parseSuccess) {
         return DecodeError::invalidBinary;
@@ -544,7 +546,35 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
 }
 
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
-    if (zeInfoSections.kernels.size() > 0) {
+    if (zeInfoSections.kernels.size() > 0 && dst.maxKernelDecodeThreads > 1u) {
+        std::vector<const Yaml::Node *> kernelNodes;
+        for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+            kernelNodes.push_back(&kernelNd);
+        }
+
+        struct KernelDecodeResult {
+            std::unique_ptr<KernelInfo> kernelInfo;
+            DecodeError error = DecodeError::success;
+            std::string errReason;
+            std::string warning;
+        };
+        std::vector<KernelDecodeResult> results(kernelNodes.size());
+        parallelFor(kernelNodes.size(), dst.maxKernelDecodeThreads, kernelDecodeChunkSize, [&](size_t kernelId) {
+            auto &result = results[kernelId];
+            result.kernelInfo = std::make_unique<KernelInfo>();
+            result.error = decodeZeInfoKernelEntry(result.kernelInfo->kernelDescriptor, parser, *kernelNodes[kernelId], dst.grfSize, dst.minScratchSpaceSize, dst.samplerStateSize, dst.samplerBorderColorStateSize, result.errReason, result.warning, srcZeInfoVersion);
+        });
+
+        // merged in kernel order, so kernelInfos and messages are the same as after a sequential decode
+        for (auto &result : results) {
+            outErrReason.append(result.errReason);
+            outWarning.append(result.warning);
+            if (DecodeError::success != result.error) {
+                return result.error;
+            }
+            dst.kernelInfos.push_back(result.kernelInfo.release());
+        }
+    } else if (zeInfoSections.kernels.size() > 0) {
 
         for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
             auto kernelInfo = std::make_unique<KernelInfo>();
@@ -20,6 +20,7 @@ struct ProgramInfo;
 
 namespace Zebin::ZeInfo {
 inline constexpr NEO::Zebin::ZeInfo::Types::Version zeInfoDecoderVersion{1, 73};
+inline constexpr size_t kernelDecodeChunkSize = 16u;
 
 using KernelExecutionEnvBaseT = Types::Kernel::ExecutionEnv::ExecutionEnvBaseT;
 
@@ -16,7 +16,9 @@
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <thread>
 
 namespace NEO {
@@ -40,6 +42,10 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerContextGroupIdleDetection.get() != -1) {
         isCsrsContextGroupIdleDetectionEnabled = debugManager.flags.DirectSubmissionControllerContextGroupIdleDetection.get();
     }
+    if (debugManager.flags.DirectSubmissionControllerAdaptiveTermination.get() != -1) {
+        isAdaptiveTerminationEnabled = debugManager.flags.DirectSubmissionControllerAdaptiveTermination.get();
+    }
+    adaptiveSleepValue = std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor);
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -71,6 +77,17 @@ void DirectSubmissionController::stopThread() {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
     }
+
+    if (isAdaptiveTerminationEnabled && debugManager.flags.PrintDebugMessages.get()) {
+        auto controllerStats = getStats();
+        PRINT_STRING(true, stdout, "Direct submission controller - ring stops: %" PRIu64 ", ring restarts: %" PRIu64 ", ring restarts avoided: %" PRIu64 ", busy time: %" PRId64 " us\n",
+                     controllerStats.ringStopsCount, controllerStats.ringRestartsCount, controllerStats.ringRestartsAvoidedCount, static_cast<int64_t>(controllerStats.busyTime.count()));
+    }
+}
+
+DirectSubmissionControllerStats DirectSubmissionController::getStats() {
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    return stats;
 }
 
 void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
@@ -95,17 +112,23 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 void DirectSubmissionController::notifyNewSubmission(const CommandStreamReceiver *csr) {
     std::lock_guard<std::mutex> lock(condVarMutex);
     ++activeSubmissionsCount;
-    directSubmissions[const_cast<CommandStreamReceiver *>(csr)].isActive = true;
+    auto &state = directSubmissions[const_cast<CommandStreamReceiver *>(csr)];
+    if (isAdaptiveTerminationEnabled) {
+        state.restartTimestamp = getCpuTimestamp();
+    }
+    state.isActive = true;
     condVar.notify_one();
 }
 
 void DirectSubmissionController::checkNewSubmissions() {
-    auto timeoutMode = timeoutElapsed();
+    auto timeoutMode = isAdaptiveTerminationEnabled ? TimeoutElapsedMode::fullyElapsed : timeoutElapsed();
     if (timeoutMode == TimeoutElapsedMode::notElapsed) {
         return;
     }
 
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    const auto checkStart = getCpuTimestamp();
+    auto nextSleepValue = std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor);
     bool shouldRecalculateTimeout = false;
     std::optional<TaskCountType> bcsTaskCount{};
     for (auto &[csr, state] : directSubmissions) {
@@ -125,6 +148,15 @@ void DirectSubmissionController::checkNewSubmissions() {
             if (state.isStopped) {
                 continue;
             }
+            if (isAdaptiveTerminationEnabled) {
+                state.idleObserved = true;
+                const auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(checkStart - state.lastActivityTimestamp);
+                const auto keepAliveTime = getKeepAliveTime(state, isBcs);
+                if (idleTime < keepAliveTime) {
+                    nextSleepValue = std::min(nextSleepValue, keepAliveTime - idleTime);
+                    continue;
+                }
+            }
             bool isCopyEngineIdle = true;
             if (!isBcs && csr->getProductHelper().checkBcsForDirectSubmissionStop()) {
                 isCopyEngineIdle = isCopyEngineOnDeviceIdle(csr->getRootDeviceIndex(), bcsTaskCount);
@@ -136,11 +168,33 @@ void DirectSubmissionController::checkNewSubmissions() {
                 state.isStopped = true;
                 shouldRecalculateTimeout = true;
                 --activeSubmissionsCount;
+                stats.ringStopsCount++;
             }
             state.taskCount = csr->peekTaskCount();
         } else {
+            const bool hadActivity = state.lastActivityTimestamp != SteadyClock::time_point{};
+            if (state.isStopped && hadActivity) {
+                stats.ringRestartsCount++;
+                if (isAdaptiveTerminationEnabled) {
+                    const auto restartTimestamp = state.restartTimestamp.load();
+                    if (restartTimestamp > state.lastActivityTimestamp) {
+                        recordIdleGap(state, std::chrono::duration_cast<std::chrono::microseconds>(restartTimestamp - state.lastActivityTimestamp));
+                    }
+                }
+            } else if (isAdaptiveTerminationEnabled && state.idleObserved) {
+                const auto idleGap = std::chrono::duration_cast<std::chrono::microseconds>(checkStart - state.lastActivityTimestamp);
+                recordIdleGap(state, idleGap);
+                if (idleGap >= (isBcs ? this->timeout / this->bcsTimeoutDivisor : this->timeout)) {
+                    stats.ringRestartsAvoidedCount++;
+                }
+            }
             state.isStopped = false;
             state.taskCount = taskCount;
+            state.lastActivityTimestamp = checkStart;
+            state.idleObserved = false;
+            if (isAdaptiveTerminationEnabled) {
+                nextSleepValue = std::min(nextSleepValue, getKeepAliveTime(state, isBcs));
+            }
         }
     }
     if (shouldRecalculateTimeout) {
@@ -150,6 +204,36 @@ void DirectSubmissionController::checkNewSubmissions() {
     if (timeoutMode != TimeoutElapsedMode::bcsOnly) {
         this->timeSinceLastCheck = getCpuTimestamp();
     }
+    if (isAdaptiveTerminationEnabled) {
+        adaptiveSleepValue = std::max(nextSleepValue, adaptiveMinimalSleep);
+    }
+    stats.busyTime += std::chrono::duration_cast<std::chrono::microseconds>(getCpuTimestamp() - checkStart);
+}
+
+void DirectSubmissionController::recordIdleGap(DirectSubmissionState &state, std::chrono::microseconds idleGap) {
+    // exponentially weighted average and mean deviation of idle gaps, same weights as TCP round trip estimation
+    if (state.idleGapSamples == 0u) {
+        state.averageIdleGap = idleGap;
+        state.idleGapDeviation = idleGap / 2;
+    } else {
+        const auto error = idleGap - state.averageIdleGap;
+        state.averageIdleGap += error / 8;
+        state.idleGapDeviation += (std::chrono::abs(error) - state.idleGapDeviation) / 4;
+    }
+    state.idleGapSamples++;
+}
+
+std::chrono::microseconds DirectSubmissionController::getKeepAliveTime(const DirectSubmissionState &state, bool isBcs) const {
+    if (state.idleGapSamples == 0u) {
+        return isBcs ? this->timeout / this->bcsTimeoutDivisor : this->timeout;
+    }
+    const auto predictedIdleGap = state.averageIdleGap + 2 * state.idleGapDeviation;
+    if (predictedIdleGap <= this->maxTimeout) {
+        // submissions usually resume within max timeout, keep ring running through the pause
+        return std::max(predictedIdleGap, adaptiveMinimalKeepAlive);
+    }
+    // pauses are usually longer than ring may stay idle, stop it without waiting for full timeout
+    return adaptiveMinimalKeepAlive;
 }
 
 bool DirectSubmissionController::isDirectSubmissionIdle(CommandStreamReceiver *csr, std::unique_lock<std::recursive_mutex> &csrLock) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,10 +50,19 @@ struct ContextGroupKey {
     }
 };
 
+struct DirectSubmissionControllerStats {
+    uint64_t ringStopsCount = 0u;
+    uint64_t ringRestartsCount = 0u;
+    uint64_t ringRestartsAvoidedCount = 0u;
+    std::chrono::microseconds busyTime{0};
+};
+
 class DirectSubmissionController {
   public:
     static constexpr size_t defaultTimeout = 5'000;
     static constexpr size_t timeToPollTagUpdateNS = 20'000;
+    static constexpr std::chrono::microseconds adaptiveMinimalKeepAlive{500};
+    static constexpr std::chrono::microseconds adaptiveMinimalSleep{100};
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -69,12 +78,20 @@ class DirectSubmissionController {
     void drainPagingFenceQueue();
     void notifyNewSubmission(const CommandStreamReceiver *csr);
 
+    DirectSubmissionControllerStats getStats();
+
   protected:
     struct DirectSubmissionState {
         DirectSubmissionState(DirectSubmissionState &&other) noexcept {
             isActive = other.isActive.load();
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            restartTimestamp = other.restartTimestamp.load();
+            lastActivityTimestamp = other.lastActivityTimestamp;
+            averageIdleGap = other.averageIdleGap;
+            idleGapDeviation = other.idleGapDeviation;
+            idleGapSamples = other.idleGapSamples;
+            idleObserved = other.idleObserved;
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -83,6 +100,12 @@ class DirectSubmissionController {
             this->isActive = other.isActive.load();
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            this->restartTimestamp = other.restartTimestamp.load();
+            this->lastActivityTimestamp = other.lastActivityTimestamp;
+            this->averageIdleGap = other.averageIdleGap;
+            this->idleGapDeviation = other.idleGapDeviation;
+            this->idleGapSamples = other.idleGapSamples;
+            this->idleObserved = other.idleObserved;
             return *this;
         }
 
@@ -95,6 +118,14 @@ class DirectSubmissionController {
         std::atomic_bool isActive{false};
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+
+        // idle gap tracking used by adaptive termination, restart time is reported by the submitting thread
+        std::atomic<SteadyClock::time_point> restartTimestamp{};
+        SteadyClock::time_point lastActivityTimestamp{};
+        std::chrono::microseconds averageIdleGap{0};
+        std::chrono::microseconds idleGapDeviation{0};
+        uint32_t idleGapSamples = 0u;
+        bool idleObserved = false;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -116,7 +147,15 @@ class DirectSubmissionController {
 
     MOCKABLE_VIRTUAL void handlePagingFenceRequests(std::unique_lock<std::mutex> &lock);
     MOCKABLE_VIRTUAL TimeoutElapsedMode timeoutElapsed();
-    std::chrono::microseconds getSleepValue() const { return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor); }
+    std::chrono::microseconds getSleepValue() const {
+        if (isAdaptiveTerminationEnabled) {
+            return adaptiveSleepValue;
+        }
+        return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor);
+    }
+
+    void recordIdleGap(DirectSubmissionState &state, std::chrono::microseconds idleGap);
+    std::chrono::microseconds getKeepAliveTime(const DirectSubmissionState &state, bool isBcs) const;
 
     uint32_t maxCcsCount = 1u;
     std::array<uint32_t, DeviceBitfield().size()> ccsCount = {};
@@ -137,6 +176,9 @@ class DirectSubmissionController {
     QueueThrottle lowestThrottleSubmitted = QueueThrottle::HIGH;
     bool isCsrIdleDetectionEnabled = false;
     bool isCsrsContextGroupIdleDetectionEnabled = false;
+    bool isAdaptiveTerminationEnabled = false;
+    std::chrono::microseconds adaptiveSleepValue{defaultTimeout};
+    DirectSubmissionControllerStats stats;
 
     std::condition_variable condVar;
     std::mutex condVarMutex;
@@ -14,4 +14,8 @@ void streamCopy(void *dst, const void *src, size_t bytes) noexcept {
     memcpy_s(dst, bytes, src, bytes);
 }
 
+void streamCopyNonTemporal(void *dst, const void *src, size_t bytes) noexcept {
+    memcpy_s(dst, bytes, src, bytes);
+}
+
 } // namespace NEO
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/cpu_copy_helper.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+constexpr size_t defaultCpuCopyParallelThreshold = 64 * MemoryConstants::megaByte;
+constexpr size_t minCpuCopySliceSize = MemoryConstants::megaByte;
+} // namespace
+
+CpuCopyProperties getCpuCopyProperties(const OSInterface *osIface) {
+    CpuCopyProperties properties{};
+
+    if (debugManager.flags.CpuCopyNonTemporalThreshold.get() != -1) {
+        properties.nonTemporalThreshold = static_cast<size_t>(debugManager.flags.CpuCopyNonTemporalThreshold.get()) * MemoryConstants::kiloByte;
+    }
+
+    if (debugManager.flags.CpuCopyThreads.get() > 1) {
+        properties.maxThreads = static_cast<uint32_t>(debugManager.flags.CpuCopyThreads.get());
+        properties.parallelThreshold = defaultCpuCopyParallelThreshold;
+        if (debugManager.flags.CpuCopyParallelThreshold.get() != -1) {
+            properties.parallelThreshold = static_cast<size_t>(debugManager.flags.CpuCopyParallelThreshold.get()) * MemoryConstants::kiloByte;
+        }
+        properties.numaNode = getDeviceNumaNode(osIface);
+    }
+
+    return properties;
+}
+
+void cpuCopy(void *dst, const void *src, size_t bytes, const CpuCopyProperties &properties) {
+    const bool printBandwidth = debugManager.flags.PrintCpuCopyBandwidth.get();
+    const auto start = printBandwidth ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+    const bool nonTemporal = bytes >= properties.nonTemporalThreshold;
+    const auto copyFunc = nonTemporal ? streamCopyNonTemporal : streamCopy;
+
+    size_t threadsCount = 1u;
+    if (bytes >= properties.parallelThreshold) {
+        threadsCount = std::clamp(bytes / minCpuCopySliceSize, static_cast<size_t>(1u), static_cast<size_t>(properties.maxThreads));
+    }
+
+    if (threadsCount == 1u) {
+        copyFunc(dst, src, bytes);
+    } else {
+        // slices start at page multiples, so helpers keep the alignment of the whole copy
+        const size_t sliceSize = alignUp((bytes + threadsCount - 1) / threadsCount, MemoryConstants::pageSize);
+        threadsCount = (bytes + sliceSize - 1) / sliceSize;
+
+        // calling thread keeps its affinity, pool threads run on the device node only for the time of their slice
+        const auto callingThreadId = std::this_thread::get_id();
+        parallelFor(threadsCount, properties.maxThreads, 1u, [&](size_t slice) {
+            const size_t offset = slice * sliceSize;
+            const size_t size = std::min(sliceSize, bytes - offset);
+            const bool pinned = std::this_thread::get_id() != callingThreadId && pinCurrentThreadToNumaNode(properties.numaNode);
+            copyFunc(ptrOffset(dst, offset), ptrOffset(src, offset), size);
+            if (pinned) {
+                unpinCurrentThreadFromNumaNode();
+            }
+        });
+    }
+
+    if (printBandwidth) {
+        const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        const double bandwidth = elapsedNs > 0 ? static_cast<double>(bytes) / static_cast<double>(elapsedNs) : 0.0;
+        PRINT_STRING(true, stdout, "CPU copy: %zu bytes, %zu threads, %s stores, %lld ns, %.2f GB/s\n",
+                     bytes, threadsCount, nonTemporal ? "non-temporal" : "regular", static_cast<long long>(elapsedNs), bandwidth);
+    }
+}
+
+} // namespace NEO
@@ -8,7 +8,25 @@
 #pragma once
 #include "shared/source/os_interface/os_interface.h"
 
+#include <cstdint>
+#include <limits>
+
 namespace NEO {
+struct CpuCopyProperties {
+    size_t nonTemporalThreshold = std::numeric_limits<size_t>::max();
+    size_t parallelThreshold = std::numeric_limits<size_t>::max();
+    uint32_t maxThreads = 1u;
+    int numaNode = -1;
+};
+
 bool isSmallBarConfigPresent(const OSInterface *osIface);
+int getDeviceNumaNode(const OSInterface *osIface);
+bool pinCurrentThreadToNumaNode(int numaNode);
+bool unpinCurrentThreadFromNumaNode();
+
 void streamCopy(void *dst, const void *src, size_t bytes) noexcept;
+void streamCopyNonTemporal(void *dst, const void *src, size_t bytes) noexcept;
+
+CpuCopyProperties getCpuCopyProperties(const OSInterface *osIface);
+void cpuCopy(void *dst, const void *src, size_t bytes, const CpuCopyProperties &properties);
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,14 @@
 #include "shared/source/helpers/cpu_copy_helper.h"
 
 #include "shared/source/os_interface/linux/memory_info.h"
+#include "shared/source/os_interface/linux/numa_library.h"
 
 #include "drm_neo.h"
 
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+
 namespace NEO {
 
 bool isSmallBarConfigPresent(const OSInterface *osIface) {
@@ -38,4 +43,44 @@ bool isSmallBarConfigPresent(const OSInterface *osIface) {
     return false;
 }
 
+int getDeviceNumaNode(const OSInterface *osIface) {
+    if (osIface == nullptr) {
+        return -1;
+    }
+
+    auto driverModel = osIface->getDriverModel();
+    if (driverModel == nullptr || driverModel->getDriverModelType() != DriverModelType::drm) {
+        return -1;
+    }
+
+    std::string readString(16, '\0');
+    if (!static_cast<Drm *>(driverModel)->readSysFsAsString("/device/numa_node", readString)) {
+        return -1;
+    }
+
+    char *endPtr = nullptr;
+    errno = 0;
+    long numaNode = std::strtol(readString.c_str(), &endPtr, 10);
+    if ((endPtr == readString.c_str()) || (errno != 0) || (numaNode < 0) || (numaNode > std::numeric_limits<int>::max())) {
+        return -1;
+    }
+
+    if (!Linux::NumaLibrary::initOnce()) {
+        return -1;
+    }
+    return static_cast<int>(numaNode);
+}
+
+bool pinCurrentThreadToNumaNode(int numaNode) {
+    if (numaNode < 0) {
+        return false;
+    }
+    return Linux::NumaLibrary::runOnNode(numaNode);
+}
+
+bool unpinCurrentThreadFromNumaNode() {
+    // numa_run_on_node(-1) lets the thread run on all nodes again
+    return Linux::NumaLibrary::runOnNode(-1);
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,4 +13,16 @@ bool isSmallBarConfigPresent(const OSInterface *osIface) {
     return false;
 }
 
+int getDeviceNumaNode(const OSInterface *osIface) {
+    return -1;
+}
+
+bool pinCurrentThreadToNumaNode(int numaNode) {
+    return false;
+}
+
+bool unpinCurrentThreadFromNumaNode() {
+    return false;
+}
+
 } // namespace NEO
@@ -31,4 +31,19 @@ void streamCopy(void *dst, const void *src, size_t bytes) noexcept {
     memcpy_s(dst, bytes, src, bytes);
 }
 
+void streamCopyNonTemporal(void *dst, const void *src, size_t bytes) noexcept {
+    const auto &cpuInfo = CpuInfo::getInstance();
+
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureAvX512)) {
+        streamCopyNonTemporalImpl<true>(dst, src, bytes);
+        return;
+    }
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureAvX2)) {
+        streamCopyNonTemporalImpl<false>(dst, src, bytes);
+        return;
+    }
+
+    memcpy_s(dst, bytes, src, bytes);
+}
+
 } // namespace NEO
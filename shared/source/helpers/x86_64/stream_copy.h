@@ -15,4 +15,7 @@ inline constexpr size_t streamCopySseWidth = 16;
 
 template <bool withAvx512, bool destinationCanBeWriteCombined = true>
 void streamCopyImpl(void *dst, const void *src, size_t bytes) noexcept;
+
+template <bool withAvx512>
+void streamCopyNonTemporalImpl(void *dst, const void *src, size_t bytes) noexcept;
 } // namespace NEO
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/x86_64/stream_copy.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -78,4 +79,63 @@ void streamCopyImpl(void *dst, const void *src, size_t bytes) noexcept {
     }
 }
 
+template <bool withAvx512>
+void streamCopyNonTemporalImpl(void *dst, const void *src, size_t bytes) noexcept {
+    constexpr size_t storeWidth = withAvx512 ? streamCopyAvx512Width : streamCopyAvx2Width;
+
+    auto *dstBytes = static_cast<uint8_t *>(dst);
+    auto *srcBytes = static_cast<const uint8_t *>(src);
+    size_t remainingBytes = bytes;
+
+    // non-temporal stores need an aligned destination, unaligned head goes through regular stores
+    const size_t headBytes = std::min(remainingBytes, static_cast<size_t>(alignUp(dstBytes, storeWidth) - dstBytes));
+    std::memcpy(dstBytes, srcBytes, headBytes);
+    dstBytes += headBytes;
+    srcBytes += headBytes;
+    remainingBytes -= headBytes;
+
+#if defined(__AVX512F__)
+    if constexpr (withAvx512) {
+        if (isAligned<streamCopyAvx512Width>(srcBytes)) {
+            while (remainingBytes >= streamCopyAvx512Width) {
+                _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes),
+                                    _mm512_stream_load_si512(reinterpret_cast<__m512i *>(const_cast<uint8_t *>(srcBytes))));
+                dstBytes += streamCopyAvx512Width;
+                srcBytes += streamCopyAvx512Width;
+                remainingBytes -= streamCopyAvx512Width;
+            }
+        } else {
+            while (remainingBytes >= streamCopyAvx512Width) {
+                _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes), _mm512_loadu_si512(srcBytes));
+                dstBytes += streamCopyAvx512Width;
+                srcBytes += streamCopyAvx512Width;
+                remainingBytes -= streamCopyAvx512Width;
+            }
+        }
+    }
+#endif
+
+    if (isAligned<streamCopyAvx2Width>(srcBytes)) {
+        while (remainingBytes >= streamCopyAvx2Width) {
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes),
+                                _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+            dstBytes += streamCopyAvx2Width;
+            srcBytes += streamCopyAvx2Width;
+            remainingBytes -= streamCopyAvx2Width;
+        }
+    } else {
+        while (remainingBytes >= streamCopyAvx2Width) {
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+            dstBytes += streamCopyAvx2Width;
+            srcBytes += streamCopyAvx2Width;
+            remainingBytes -= streamCopyAvx2Width;
+        }
+    }
+
+    std::memcpy(dstBytes, srcBytes, remainingBytes);
+
+    _mm_sfence();
+}
+
 } // namespace NEO
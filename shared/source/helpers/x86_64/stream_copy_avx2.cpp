@@ -11,5 +11,6 @@
 namespace NEO {
 template void streamCopyImpl<false, true>(void *dst, const void *src, size_t bytes) noexcept;
 template void streamCopyImpl<false, false>(void *dst, const void *src, size_t bytes) noexcept;
+template void streamCopyNonTemporalImpl<false>(void *dst, const void *src, size_t bytes) noexcept;
 } // namespace NEO
 #endif
@@ -11,5 +11,6 @@
 namespace NEO {
 template void streamCopyImpl<true, true>(void *dst, const void *src, size_t bytes) noexcept;
 template void streamCopyImpl<true, false>(void *dst, const void *src, size_t bytes) noexcept;
+template void streamCopyNonTemporalImpl<true>(void *dst, const void *src, size_t bytes) noexcept;
 } // namespace NEO
 #endif
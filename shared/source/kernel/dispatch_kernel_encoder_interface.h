@@ -9,6 +9,7 @@
 #include <cstdint>
 
 namespace NEO {
+class DispatchTemplateCache;
 class GraphicsAllocation;
 struct ImplicitArgs;
 struct KernelDescriptor;
@@ -49,5 +50,7 @@ struct DispatchKernelEncoderI {
     virtual ImplicitArgs *getImplicitArgs() const = 0;
     virtual void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const = 0;
     virtual void patchSamplerBindlessOffsetsInCrossThreadData(uint64_t samplerStateOffset) const = 0;
+
+    virtual DispatchTemplateCache *getDispatchTemplateCache() const { return nullptr; }
 };
 } // namespace NEO
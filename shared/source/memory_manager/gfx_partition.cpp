@@ -7,13 +7,16 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/size_class_heap_allocator.h"
 
 namespace NEO {
 
@@ -95,7 +98,14 @@ static void reserve57BitRangeWithMemoryMapsParse(OSMemory *osMemory, OSMemory::R
     reserveRangeWithMemoryMapsParse(osMemory, reservedCpuAddressRange, areaBase, areaTop, reservationSize);
 }
 
-GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForNonSvmHeaps) : reservedCpuAddressRangeForNonSvmHeaps(reservedCpuAddressRangeForNonSvmHeaps), osMemory(OSMemory::create()) {}
+GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForNonSvmHeaps) : reservedCpuAddressRangeForNonSvmHeaps(reservedCpuAddressRangeForNonSvmHeaps), osMemory(OSMemory::create()) {
+    if (debugManager.flags.UseSizeClassHeapAllocator.get() > 0) {
+        const auto sizeClassHeapsMask = static_cast<uint32_t>(debugManager.flags.UseSizeClassHeapAllocator.get());
+        for (uint32_t heapIndex = 0u; heapIndex < heaps.size(); heapIndex++) {
+            heaps[heapIndex].setUseSizeClassAllocator(isBitSet(sizeClassHeapsMask, heapIndex));
+        }
+    }
+}
 
 GfxPartition::~GfxPartition() {
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForNonSvmHeaps);
@@ -112,6 +122,13 @@ void GfxPartition::setFrontWindowPoolSizes(const ProductHelper *productHelper) {
                                              : defaultInternalFrontWindowPoolSize;
 }
 
+std::unique_ptr<HeapAllocator> GfxPartition::Heap::createAllocator(uint64_t base, uint64_t size, size_t allocationAlignment, size_t threshold) const {
+    if (useSizeClassAllocator) {
+        return std::make_unique<SizeClassHeapAllocator>(base, size, allocationAlignment, threshold);
+    }
+    return std::make_unique<HeapAllocator>(base, size, allocationAlignment, threshold);
+}
+
 void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment) {
     this->base = base;
     this->size = size;
@@ -126,7 +143,7 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAli
         size -= 2 * heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment);
+    alloc = createAllocator(base + heapGranularity, size, allocationAlignment, HeapAllocator::defaultSizeThreshold);
     initialized = true;
 }
 
@@ -137,7 +154,7 @@ void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t siz
     // Exclude very last 64K from GPU address range allocation (main heap with front window)
     size -= GfxPartition::heapGranularity;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = createAllocator(base, size, MemoryConstants::pageSize, 0u);
     initialized = true;
 }
 
@@ -149,7 +166,7 @@ void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint6
     size -= GfxPartition::heapGranularity;
     size -= frontWindowSize;
 
-    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize);
+    alloc = createAllocator(base + frontWindowSize, size, MemoryConstants::pageSize, HeapAllocator::defaultSizeThreshold);
     initialized = true;
 }
 
@@ -157,7 +174,7 @@ void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = createAllocator(base, size, MemoryConstants::pageSize, 0u);
     initialized = true;
 }
 
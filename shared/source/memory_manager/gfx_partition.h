@@ -170,11 +170,16 @@ class GfxPartition {
         uint64_t allocateWithCustomAlignmentWithStartAddressHint(const uint64_t requiredStartAddress, size_t &sizeToAllocate, size_t alignment);
         void free(uint64_t ptr, size_t size);
         bool isInitialized() const { return initialized; }
+        void setUseSizeClassAllocator(bool useSizeClass) { useSizeClassAllocator = useSizeClass; }
+        bool isSizeClassAllocatorUsed() const { return useSizeClassAllocator; }
 
       protected:
+        std::unique_ptr<HeapAllocator> createAllocator(uint64_t base, uint64_t size, size_t allocationAlignment, size_t threshold) const;
+
         uint64_t base = 0, size = 0;
         std::unique_ptr<HeapAllocator> alloc;
         bool initialized = false;
+        bool useSizeClassAllocator = false;
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
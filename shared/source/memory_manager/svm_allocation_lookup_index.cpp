@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/svm_allocation_lookup_index.h"
+
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> lookupIndexIdCounter{0u};
+
+struct KnownReaderSlot {
+    uint64_t indexId;
+    std::shared_ptr<SvmAllocationLookupIndex::ReaderSlotPool> pool;
+    SvmAllocationLookupIndex::ReaderSlot *slot;
+};
+
+struct ThreadLookupCache {
+    ~ThreadLookupCache() {
+        for (auto &knownSlot : knownReaderSlots) {
+            knownSlot.slot->claimed.store(false, std::memory_order_release);
+        }
+    }
+
+    uint64_t slotIndexId = 0u;
+    SvmAllocationLookupIndex::ReaderSlot *readerSlot = nullptr;
+    std::vector<KnownReaderSlot> knownReaderSlots;
+
+    uint64_t lastHitIndexId = 0u;
+    uint64_t lastHitRemovalGeneration = 0u;
+    SvmAllocationLookupIndex::Range lastHit = {};
+};
+
+thread_local ThreadLookupCache threadLookupCache;
+} // namespace
+
+SvmAllocationLookupIndex::SvmAllocationLookupIndex() : indexId(++lookupIndexIdCounter), readerSlotPool(std::make_shared<ReaderSlotPool>()) {}
+
+SvmAllocationLookupIndex::~SvmAllocationLookupIndex() {
+    readerSlotPool->indexAlive.store(false, std::memory_order_release);
+    delete currentSnapshot.load();
+}
+
+SvmAllocationLookupIndex::ReaderSlot *SvmAllocationLookupIndex::ReaderSlotPool::claimSlot() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &slot : slots) {
+        bool claimed = false;
+        if (slot->claimed.compare_exchange_strong(claimed, true, std::memory_order_acq_rel)) {
+            return slot.get();
+        }
+    }
+    slots.push_back(std::make_unique<ReaderSlot>());
+    slots.back()->claimed.store(true, std::memory_order_relaxed);
+    return slots.back().get();
+}
+
+bool SvmAllocationLookupIndex::contains(const Range &range, uintptr_t address) {
+    return address == range.begin || (address > range.begin && address - range.begin < range.data->size);
+}
+
+const SvmAllocationLookupIndex::Range *SvmAllocationLookupIndex::findInSnapshot(const Snapshot &snapshot, uintptr_t address) {
+    auto it = std::upper_bound(snapshot.ranges.begin(), snapshot.ranges.end(), address, [](uintptr_t address, const Range &range) {
+        return address < range.begin;
+    });
+    if (it == snapshot.ranges.begin()) {
+        return nullptr;
+    }
+    --it;
+    return contains(*it, address) ? &(*it) : nullptr;
+}
+
+SvmAllocationLookupIndex::ReaderSlot *SvmAllocationLookupIndex::getReaderSlot() {
+    auto &cache = threadLookupCache;
+    if (cache.slotIndexId == indexId) {
+        return cache.readerSlot;
+    }
+
+    ReaderSlot *slot = nullptr;
+    for (const auto &knownSlot : cache.knownReaderSlots) {
+        if (knownSlot.indexId == indexId) {
+            slot = knownSlot.slot;
+            break;
+        }
+    }
+
+    if (slot == nullptr) {
+        // slots of destroyed indices are dropped, so long living threads do not accumulate them
+        std::erase_if(cache.knownReaderSlots, [](const KnownReaderSlot &knownSlot) {
+            return !knownSlot.pool->indexAlive.load(std::memory_order_acquire);
+        });
+        slot = readerSlotPool->claimSlot();
+        cache.knownReaderSlots.push_back({indexId, readerSlotPool, slot});
+    }
+
+    cache.slotIndexId = indexId;
+    cache.readerSlot = slot;
+    return slot;
+}
+
+void SvmAllocationLookupIndex::enterReadSection(ReaderSlot &slot) {
+    auto epoch = globalEpoch.load(std::memory_order_seq_cst);
+    while (true) {
+        slot.activeEpoch.store(epoch, std::memory_order_seq_cst);
+        const auto currentEpoch = globalEpoch.load(std::memory_order_seq_cst);
+        if (currentEpoch == epoch) {
+            return;
+        }
+        epoch = currentEpoch;
+    }
+}
+
+SvmAllocationData *SvmAllocationLookupIndex::find(const void *ptr) {
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto slot = getReaderSlot();
+    enterReadSection(*slot);
+
+    SvmAllocationData *foundData = nullptr;
+    const auto generation = removalGeneration.load(std::memory_order_seq_cst);
+    auto &cache = threadLookupCache;
+    if (cache.lastHitIndexId == indexId && cache.lastHitRemovalGeneration == generation && contains(cache.lastHit, address)) {
+        foundData = cache.lastHit.data;
+    } else {
+        auto snapshot = currentSnapshot.load(std::memory_order_seq_cst);
+        auto range = snapshot ? findInSnapshot(*snapshot, address) : nullptr;
+        if (range) {
+            cache.lastHitIndexId = indexId;
+            cache.lastHitRemovalGeneration = generation;
+            cache.lastHit = *range;
+            foundData = range->data;
+        }
+    }
+
+    slot->activeEpoch.store(0u, std::memory_order_seq_cst);
+
+    if (hasRetiredSnapshots.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(retiredSnapshotsMtx, std::try_to_lock);
+        if (lock.owns_lock()) {
+            reclaimRetiredSnapshots();
+        }
+    }
+    return foundData;
+}
+
+void SvmAllocationLookupIndex::publish(const BaseSortedPointerWithValueVector<SvmAllocationData> &allocations, std::unique_ptr<SvmAllocationData> removedAllocation) {
+    auto snapshot = std::make_unique<Snapshot>();
+    snapshot->ranges.reserve(allocations.allocations.size());
+    for (const auto &allocation : allocations.allocations) {
+        snapshot->ranges.push_back({reinterpret_cast<uintptr_t>(allocation.first), allocation.second.get()});
+    }
+
+    auto previousSnapshot = currentSnapshot.exchange(snapshot.release(), std::memory_order_seq_cst);
+    if (removedAllocation) {
+        removalGeneration.fetch_add(1u, std::memory_order_seq_cst);
+    }
+
+    std::lock_guard<std::mutex> lock(retiredSnapshotsMtx);
+    if (previousSnapshot || removedAllocation) {
+        const auto retireEpoch = globalEpoch.fetch_add(1u, std::memory_order_seq_cst);
+        retiredSnapshots.push_back({retireEpoch, std::unique_ptr<const Snapshot>(previousSnapshot), std::move(removedAllocation)});
+    }
+
+    reclaimRetiredSnapshots();
+}
+
+void SvmAllocationLookupIndex::reclaimRetiredSnapshots() {
+    auto oldestActiveEpoch = std::numeric_limits<uint64_t>::max();
+    {
+        std::lock_guard<std::mutex> lock(readerSlotPool->mtx);
+        for (const auto &slot : readerSlotPool->slots) {
+            const auto epoch = slot->activeEpoch.load(std::memory_order_seq_cst);
+            if (epoch != 0u) {
+                oldestActiveEpoch = std::min(oldestActiveEpoch, epoch);
+            }
+        }
+    }
+
+    std::erase_if(retiredSnapshots, [oldestActiveEpoch](const RetiredSnapshot &retiredSnapshot) {
+        return retiredSnapshot.retireEpoch < oldestActiveEpoch;
+    });
+    hasRetiredSnapshots.store(!retiredSnapshots.empty(), std::memory_order_release);
+}
+
+} // namespace NEO
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/sorted_vector.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+struct SvmAllocationData;
+
+/*
+ * Read-mostly view of SVMAllocsManager::svmAllocs which can be queried without taking the container lock.
+ * Writers (already serialized by the container lock) publish an immutable snapshot of allocation ranges,
+ * readers search the current snapshot and announce it only in their own reader slot, so concurrent lookups
+ * do not write to any shared cache line. Retired snapshots, together with the allocation data removed
+ * from the container, are released once no reader slot references an epoch in which they were still visible,
+ * either by the next publish or by the first reader leaving its read section after that point.
+ * Reader slots are released when their thread exits and reused by new threads, so their count is bounded by
+ * the number of threads alive at once. Each thread additionally remembers its last resolved range, which stays
+ * valid until any allocation is removed.
+ */
+class SvmAllocationLookupIndex : NEO::NonCopyableAndNonMovableClass {
+  public:
+    struct Range {
+        uintptr_t begin;
+        SvmAllocationData *data;
+    };
+
+    struct Snapshot {
+        std::vector<Range> ranges;
+    };
+
+    struct alignas(MemoryConstants::cacheLineSize) ReaderSlot {
+        std::atomic<uint64_t> activeEpoch{0u};
+        std::atomic<bool> claimed{false};
+    };
+
+    // Shared with threads holding a slot, so slots can be released on thread exit after the index is gone.
+    struct ReaderSlotPool {
+        ReaderSlot *claimSlot();
+
+        std::mutex mtx;
+        std::vector<std::unique_ptr<ReaderSlot>> slots;
+        std::atomic<bool> indexAlive{true};
+    };
+
+    struct RetiredSnapshot {
+        uint64_t retireEpoch;
+        std::unique_ptr<const Snapshot> snapshot;
+        std::unique_ptr<SvmAllocationData> removedAllocation;
+    };
+
+    SvmAllocationLookupIndex();
+    ~SvmAllocationLookupIndex();
+
+    void publish(const BaseSortedPointerWithValueVector<SvmAllocationData> &allocations, std::unique_ptr<SvmAllocationData> removedAllocation);
+    SvmAllocationData *find(const void *ptr);
+
+    size_t getRetiredSnapshotsCount() const {
+        std::lock_guard<std::mutex> lock(retiredSnapshotsMtx);
+        return retiredSnapshots.size();
+    }
+    uint64_t getRemovalGeneration() const { return removalGeneration.load(std::memory_order_acquire); }
+
+  protected:
+    static bool contains(const Range &range, uintptr_t address);
+    static const Range *findInSnapshot(const Snapshot &snapshot, uintptr_t address);
+    ReaderSlot *getReaderSlot();
+    void enterReadSection(ReaderSlot &slot);
+    void reclaimRetiredSnapshots();
+
+    const uint64_t indexId;
+    std::atomic<const Snapshot *> currentSnapshot{nullptr};
+    std::atomic<uint64_t> globalEpoch{1u};
+    std::atomic<uint64_t> removalGeneration{1u};
+
+    mutable std::mutex retiredSnapshotsMtx;
+    std::vector<RetiredSnapshot> retiredSnapshots;
+    std::atomic<bool> hasRetiredSnapshots{false};
+
+    std::shared_ptr<ReaderSlotPool> readerSlotPool;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<SvmAllocationLookupIndex>);
+
+} // namespace NEO
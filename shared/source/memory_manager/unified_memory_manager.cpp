@@ -65,6 +65,9 @@ void SVMAllocsManager::MapBasedAllocationTracker::freeAllocations(NEO::MemoryMan
 
 SVMAllocsManager::SvmAllocationCache::SvmAllocationCache() {
     this->enablePerformanceLogging = NEO::debugManager.flags.LogUsmReuse.get();
+    if (NEO::debugManager.flags.ExperimentalUSMAllocationReuseSizeBuckets.get() == 1) {
+        this->sizeBuckets = std::make_unique<std::array<SizeBucket, sizeBucketsCount>>();
+    }
 }
 
 UsmReuseInfo &SVMAllocsManager::SvmAllocationCache::getUsmReuseInfo(SvmAllocationData &svmData) {
@@ -86,7 +89,8 @@ bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, SvmAll
         return false;
     }
 
-    std::unique_lock<std::mutex> lock(this->mtx);
+    const auto sizeBucketIndex = getSizeBucketIndex(size);
+    std::unique_lock<std::mutex> lock(sizeBuckets ? (*sizeBuckets)[sizeBucketIndex].mtx : this->mtx);
     if (svmData->device ? svmData->device->shouldLimitAllocationsReuse() : memoryManager->shouldLimitAllocationsReuse()) {
         return false;
     }
@@ -111,7 +115,12 @@ bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, SvmAll
             svmAllocsManager->removeFromAllocsForIndirectAccess(*svmData);
         }
         svmData->isSavedForReuse = true;
-        allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr, svmData, completionPolicy == CompletionCheckPolicy::deferred);
+        if (sizeBuckets) {
+            (*sizeBuckets)[sizeBucketIndex].allocations.pushFrontOne(*new CachedAllocationNode(size, ptr, svmData, completionPolicy == CompletionCheckPolicy::deferred));
+            ++sizeBucketsAllocationsCount;
+        } else {
+            allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr, svmData, completionPolicy == CompletionCheckPolicy::deferred);
+        }
         empty = false;
         if (auto usmReuseCleaner = this->memoryManager->peekExecutionEnvironment().unifiedMemoryReuseCleaner.get()) {
             lock.unlock();
@@ -157,6 +166,70 @@ bool SVMAllocsManager::SvmAllocationCache::isInUse(SvmCacheAllocationInfo &cache
     return false;
 }
 
+bool SVMAllocsManager::SvmAllocationCache::isReuseCandidate(SvmCacheAllocationInfo &cacheAllocInfo, const UnifiedMemoryProperties &unifiedMemoryProperties) {
+    DEBUG_BREAK_IF(nullptr == cacheAllocInfo.svmData);
+    auto hasAllRootDeviceMappings = [&]() {
+        for (const auto &rootDeviceIndex : unifiedMemoryProperties.rootDeviceIndices) {
+            if (cacheAllocInfo.svmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    };
+    return cacheAllocInfo.svmData->device == unifiedMemoryProperties.device &&
+           cacheAllocInfo.svmData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
+           cacheAllocInfo.svmData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
+           alignmentAllows(cacheAllocInfo.allocation, unifiedMemoryProperties.alignment) &&
+           hasAllRootDeviceMappings() &&
+           false == isInUse(cacheAllocInfo);
+}
+
+void *SVMAllocsManager::SvmAllocationCache::reuseCachedAllocation(SvmCacheAllocationInfo &cacheAllocInfo, size_t size) {
+    {
+        auto &usmReuseInfo = getUsmReuseInfo(*cacheAllocInfo.svmData);
+        auto lock = usmReuseInfo.obtainAllocationsReuseLock();
+        usmReuseInfo.recordAllocationGetFromReuse(cacheAllocInfo.allocationSize);
+    }
+    if (enablePerformanceLogging) {
+        logCacheOperation({.allocationSize = cacheAllocInfo.allocationSize,
+                           .timePoint = std::chrono::high_resolution_clock::now(),
+                           .allocationType = cacheAllocInfo.svmData->memoryType,
+                           .operationType = CacheOperationType::get,
+                           .isSuccess = true});
+    }
+    cacheAllocInfo.svmData->size = size;
+    cacheAllocInfo.svmData->isSavedForReuse = false;
+    cacheAllocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    cacheAllocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+    if (requireUpdatingAllocsForIndirectAccess) {
+        cacheAllocInfo.svmData->setAllocId(++svmAllocsManager->allocationsCounter);
+        svmAllocsManager->reinsertToAllocsForIndirectAccess(*cacheAllocInfo.svmData);
+    }
+    return cacheAllocInfo.allocation;
+}
+
+void *SVMAllocsManager::SvmAllocationCache::getFromSizeBuckets(size_t size, size_t sizeForReuse, const UnifiedMemoryProperties &unifiedMemoryProperties) {
+    for (auto bucketIndex = getSizeBucketIndex(sizeForReuse); bucketIndex < sizeBucketsCount; bucketIndex++) {
+        if (false == allocUtilizationAllows(sizeForReuse, getSizeBucketMinimalSize(bucketIndex))) {
+            break;
+        }
+        auto &bucket = (*sizeBuckets)[bucketIndex];
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        for (auto node = bucket.allocations.peekHead(); node != nullptr; node = node->next) {
+            if (node->info.allocationSize < sizeForReuse ||
+                false == allocUtilizationAllows(sizeForReuse, node->info.allocationSize) ||
+                false == isReuseCandidate(node->info, unifiedMemoryProperties)) {
+                continue;
+            }
+            auto allocationPtr = reuseCachedAllocation(node->info, size);
+            bucket.allocations.removeOne(*node);
+            empty = (0u == --sizeBucketsAllocationsCount);
+            return allocationPtr;
+        }
+    }
+    return nullptr;
+}
+
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties) {
     if (false == sizeAllowed(size)) {
         return nullptr;
@@ -164,53 +237,25 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     if (unifiedMemoryProperties.allocationFlags.hostptr != 0u) {
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(this->mtx);
     const size_t sizeForReuse = alignUp(size, this->allocationSizeAlignment);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), sizeForReuse);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        if (false == allocUtilizationAllows(sizeForReuse, allocationIter->allocationSize)) {
-            break;
+    if (sizeBuckets) {
+        if (auto allocationPtr = getFromSizeBuckets(size, sizeForReuse, unifiedMemoryProperties)) {
+            return allocationPtr;
         }
-        void *allocationPtr = allocationIter->allocation;
-        DEBUG_BREAK_IF(nullptr == allocationIter->svmData);
-        auto hasAllRootDeviceMappings = [&]() {
-            for (const auto &rootDeviceIndex : unifiedMemoryProperties.rootDeviceIndices) {
-                if (allocationIter->svmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == nullptr) {
-                    return false;
-                }
-            }
-            return true;
-        };
-        if (allocationIter->svmData->device == unifiedMemoryProperties.device &&
-            allocationIter->svmData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            allocationIter->svmData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
-            alignmentAllows(allocationIter->allocation, unifiedMemoryProperties.alignment) &&
-            hasAllRootDeviceMappings() &&
-            false == isInUse(*allocationIter)) {
-            {
-                auto &usmReuseInfo = getUsmReuseInfo(*allocationIter->svmData);
-                auto lock = usmReuseInfo.obtainAllocationsReuseLock();
-                usmReuseInfo.recordAllocationGetFromReuse(allocationIter->allocationSize);
-            }
-            if (enablePerformanceLogging) {
-                logCacheOperation({.allocationSize = allocationIter->allocationSize,
-                                   .timePoint = std::chrono::high_resolution_clock::now(),
-                                   .allocationType = allocationIter->svmData->memoryType,
-                                   .operationType = CacheOperationType::get,
-                                   .isSuccess = true});
+    } else {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), sizeForReuse);
+             allocationIter != allocations.end();
+             ++allocationIter) {
+            if (false == allocUtilizationAllows(sizeForReuse, allocationIter->allocationSize)) {
+                break;
             }
-            allocationIter->svmData->size = size;
-            allocationIter->svmData->isSavedForReuse = false;
-            allocationIter->svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            allocationIter->svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
-            if (requireUpdatingAllocsForIndirectAccess) {
-                allocationIter->svmData->setAllocId(++svmAllocsManager->allocationsCounter);
-                svmAllocsManager->reinsertToAllocsForIndirectAccess(*allocationIter->svmData);
+            if (isReuseCandidate(*allocationIter, unifiedMemoryProperties)) {
+                auto allocationPtr = reuseCachedAllocation(*allocationIter, size);
+                allocations.erase(allocationIter);
+                empty = allocations.empty();
+                return allocationPtr;
             }
-            allocations.erase(allocationIter);
-            empty = allocations.empty();
-            return allocationPtr;
         }
     }
     if (enablePerformanceLogging) {
@@ -223,23 +268,38 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     return nullptr;
 }
 
+void SVMAllocsManager::SvmAllocationCache::freeCachedAllocation(SvmCacheAllocationInfo &cacheAllocInfo, CacheOperationType operationType, FreePolicyType freePolicy) {
+    DEBUG_BREAK_IF(nullptr == cacheAllocInfo.svmData);
+    {
+        auto &usmReuseInfo = getUsmReuseInfo(*cacheAllocInfo.svmData);
+        auto lock = usmReuseInfo.obtainAllocationsReuseLock();
+        usmReuseInfo.recordAllocationGetFromReuse(cacheAllocInfo.allocationSize);
+    }
+    if (enablePerformanceLogging) {
+        logCacheOperation({.allocationSize = cacheAllocInfo.allocationSize,
+                           .timePoint = std::chrono::high_resolution_clock::now(),
+                           .allocationType = cacheAllocInfo.svmData->memoryType,
+                           .operationType = operationType,
+                           .isSuccess = true});
+    }
+    svmAllocsManager->freeSVMAllocImpl(cacheAllocInfo.allocation, freePolicy, cacheAllocInfo.svmData);
+}
+
 void SVMAllocsManager::SvmAllocationCache::trim() {
+    if (sizeBuckets) {
+        for (auto &bucket : *sizeBuckets) {
+            std::lock_guard<std::mutex> lock(bucket.mtx);
+            while (auto node = bucket.allocations.removeFrontOne()) {
+                freeCachedAllocation(node->info, CacheOperationType::trim, FreePolicyType::blocking);
+                --sizeBucketsAllocationsCount;
+            }
+        }
+        empty = (0u == sizeBucketsAllocationsCount);
+        return;
+    }
     std::lock_guard<std::mutex> lock(this->mtx);
     for (auto &cachedAllocationInfo : this->allocations) {
-        DEBUG_BREAK_IF(nullptr == cachedAllocationInfo.svmData);
-        {
-            auto &usmReuseInfo = getUsmReuseInfo(*cachedAllocationInfo.svmData);
-            auto lock = usmReuseInfo.obtainAllocationsReuseLock();
-            usmReuseInfo.recordAllocationGetFromReuse(cachedAllocationInfo.allocationSize);
-        }
-        if (enablePerformanceLogging) {
-            logCacheOperation({.allocationSize = cachedAllocationInfo.allocationSize,
-                               .timePoint = std::chrono::high_resolution_clock::now(),
-                               .allocationType = cachedAllocationInfo.svmData->memoryType,
-                               .operationType = CacheOperationType::trim,
-                               .isSuccess = true});
-        }
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::blocking, cachedAllocationInfo.svmData);
+        freeCachedAllocation(cachedAllocationInfo, CacheOperationType::trim, FreePolicyType::blocking);
     }
     this->allocations.clear();
     empty = true;
@@ -296,7 +356,33 @@ void SVMAllocsManager::SvmAllocationCache::logCacheOperation(const SvmAllocation
                                                                           isSuccessString);
 }
 
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocsFromSizeBuckets(std::chrono::high_resolution_clock::time_point trimTimePoint, bool trimAll) {
+    for (auto bucketIndex = sizeBucketsCount; bucketIndex-- > 0u;) {
+        auto &bucket = (*sizeBuckets)[bucketIndex];
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        auto node = bucket.allocations.peekTail();
+        while (node != nullptr) {
+            auto previousNode = node->prev;
+            if (node->info.saveTime <= trimTimePoint) {
+                freeCachedAllocation(node->info, CacheOperationType::trimOld, FreePolicyType::defer);
+                bucket.allocations.removeOne(*node);
+                --sizeBucketsAllocationsCount;
+                if (false == trimAll) {
+                    empty = (0u == sizeBucketsAllocationsCount);
+                    return;
+                }
+            }
+            node = trimAll ? previousNode : nullptr;
+        }
+    }
+    empty = (0u == sizeBucketsAllocationsCount);
+}
+
 void SVMAllocsManager::SvmAllocationCache::trimOldAllocs(std::chrono::high_resolution_clock::time_point trimTimePoint, bool trimAll) {
+    if (sizeBuckets) {
+        trimOldAllocsFromSizeBuckets(trimTimePoint, trimAll);
+        return;
+    }
     std::lock_guard<std::mutex> lock(this->mtx);
     auto allocCleanCandidateIndex = allocations.size();
     while (0u != allocCleanCandidateIndex) {
@@ -304,20 +390,7 @@ void SVMAllocsManager::SvmAllocationCache::trimOldAllocs(std::chrono::high_resol
         if (allocCleanCandidate.saveTime > trimTimePoint) {
             continue;
         }
-        DEBUG_BREAK_IF(nullptr == allocCleanCandidate.svmData);
-        {
-            auto &usmReuseInfo = getUsmReuseInfo(*allocCleanCandidate.svmData);
-            auto lock = usmReuseInfo.obtainAllocationsReuseLock();
-            usmReuseInfo.recordAllocationGetFromReuse(allocCleanCandidate.allocationSize);
-        }
-        if (enablePerformanceLogging) {
-            logCacheOperation({.allocationSize = allocCleanCandidate.allocationSize,
-                               .timePoint = std::chrono::high_resolution_clock::now(),
-                               .allocationType = allocCleanCandidate.svmData->memoryType,
-                               .operationType = CacheOperationType::trimOld,
-                               .isSuccess = true});
-        }
-        svmAllocsManager->freeSVMAllocImpl(allocCleanCandidate.allocation, FreePolicyType::defer, allocCleanCandidate.svmData);
+        freeCachedAllocation(allocCleanCandidate, CacheOperationType::trimOld, FreePolicyType::defer);
         if (trimAll) {
             allocCleanCandidate.markForDelete();
         } else {
@@ -422,6 +495,9 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager)
     : memoryManager(memoryManager) {
+    if (debugManager.flags.EnableLockFreeSvmAllocLookup.get() == 1) {
+        lookupIndex = std::make_unique<SvmAllocationLookupIndex>();
+    }
 }
 
 SVMAllocsManager::~SVMAllocsManager() = default;
@@ -768,6 +844,14 @@ void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
 
 void SVMAllocsManager::removeFromSvmAllocs(const SvmAllocationData &svmAllocData) {
     auto graphicsAllocation = svmAllocData.gpuAllocations.getDefaultGraphicsAllocation();
+    if (lookupIndex) {
+        auto removedAllocation = svmAllocs.extract(reinterpret_cast<void *>(graphicsAllocation->getGpuAddressWithoutOffset()));
+        if (0u != graphicsAllocation->getAllocationOffset() && !removedAllocation) {
+            removedAllocation = svmAllocs.extract(reinterpret_cast<void *>(graphicsAllocation->getGpuAddress()));
+        }
+        lookupIndex->publish(svmAllocs, std::move(removedAllocation));
+        return;
+    }
     const auto removed = svmAllocs.remove(reinterpret_cast<void *>(graphicsAllocation->getGpuAddressWithoutOffset()));
     if (0u != graphicsAllocation->getAllocationOffset() && !removed) {
         svmAllocs.remove(reinterpret_cast<void *>(graphicsAllocation->getGpuAddress()));
@@ -1439,6 +1523,9 @@ SVMAllocsManager::ContainerReadLockTypeRAIIHelper SVMAllocsManager::obtainReadCo
 void SVMAllocsManager::insertSVMAlloc(void *svmPtr, const SvmAllocationData &allocData) {
     ContainerReadWriteLockType lock(mtx);
     this->svmAllocs.insert(svmPtr, allocData);
+    if (lookupIndex) {
+        lookupIndex->publish(svmAllocs, nullptr);
+    }
     UNRECOVERABLE_IF(internalAllocationsMap.count(allocData.getAllocId()) > 0);
     for (auto alloc : allocData.gpuAllocations.getGraphicsAllocations()) {
         if (alloc != nullptr) {
@@ -17,11 +17,15 @@
 #include "shared/source/memory_manager/memadvise_flags.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
+#include "shared/source/memory_manager/svm_allocation_lookup_index.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/sorted_vector.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cstdint>
 #include <map>
@@ -205,9 +209,21 @@ class SVMAllocsManager {
             bool isSuccess;
         };
 
+        struct CachedAllocationNode : public IDNode<CachedAllocationNode> {
+            CachedAllocationNode(size_t allocationSize, void *allocation, SvmAllocationData *svmData, bool isInUseCheckRequired) : info(allocationSize, allocation, svmData, isInUseCheckRequired) {}
+            SvmCacheAllocationInfo info;
+        };
+
+        // bucket k holds allocations of size in (2^(k-1), 2^k], most recently inserted at head
+        struct SizeBucket {
+            std::mutex mtx;
+            IDList<CachedAllocationNode, false, true> allocations;
+        };
+
         static constexpr size_t maxServicedSize = 256 * MemoryConstants::megaByte;
         static constexpr size_t minimalSizeToCheckUtilization = 4 * MemoryConstants::pageSize64k;
         static constexpr double minimalAllocUtilization = 0.5;
+        static constexpr uint32_t sizeBucketsCount = std::bit_width(maxServicedSize - 1) + 1;
 
         SvmAllocationCache();
 
@@ -224,7 +240,17 @@ class SVMAllocsManager {
         void cleanup();
         void logCacheOperation(const SvmAllocationCachePerfInfo &cachePerfEvent) const;
 
+        static uint32_t getSizeBucketIndex(size_t size) { return size <= 1u ? 0u : static_cast<uint32_t>(std::bit_width(size - 1)); }
+        static size_t getSizeBucketMinimalSize(uint32_t bucketIndex) { return bucketIndex == 0u ? 0u : (size_t{1} << (bucketIndex - 1)) + 1; }
+        bool isReuseCandidate(SvmCacheAllocationInfo &cacheAllocInfo, const UnifiedMemoryProperties &unifiedMemoryProperties);
+        void *reuseCachedAllocation(SvmCacheAllocationInfo &cacheAllocInfo, size_t size);
+        void freeCachedAllocation(SvmCacheAllocationInfo &cacheAllocInfo, CacheOperationType operationType, FreePolicyType freePolicy);
+        void *getFromSizeBuckets(size_t size, size_t sizeForReuse, const UnifiedMemoryProperties &unifiedMemoryProperties);
+        void trimOldAllocsFromSizeBuckets(std::chrono::high_resolution_clock::time_point trimTimePoint, bool trimAll);
+
         std::vector<SvmCacheAllocationInfo> allocations;
+        std::unique_ptr<std::array<SizeBucket, sizeBucketsCount>> sizeBuckets;
+        std::atomic<size_t> sizeBucketsAllocationsCount{0u};
 
         std::mutex mtx;
         SVMAllocsManager *svmAllocsManager = nullptr;
@@ -260,6 +286,10 @@ class SVMAllocsManager {
     template <typename T,
               std::enable_if_t<std::is_same_v<T, void> || std::is_same_v<T, const void>, int> = 0>
     SvmAllocationData *getSVMAlloc(T *ptr) {
+        if (lookupIndex) {
+            return lookupIndex->find(ptr);
+        }
+
         ContainerReadLockType lock{};
 
         if (this->containerLockedById != std::this_thread::get_id()) {
@@ -348,6 +378,7 @@ class SVMAllocsManager {
     std::unique_ptr<SvmAllocationCache> usmDeviceAllocationsCache;
     std::unique_ptr<SvmAllocationCache> usmHostAllocationsCache;
     std::unique_ptr<SvmAllocationCache> usmSharedAllocationsCache;
+    std::unique_ptr<SvmAllocationLookupIndex> lookupIndex;
     std::multimap<uint32_t, GraphicsAllocation *> internalAllocationsMap;
 
     std::thread::id containerLockedById{};
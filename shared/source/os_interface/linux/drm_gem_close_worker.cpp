@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,19 +7,24 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
+#include <cinttypes>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    if (debugManager.flags.GemCloseWorkerMaxHelperThreads.get() != -1) {
+        maxHelperThreads = static_cast<uint32_t>(debugManager.flags.GemCloseWorkerMaxHelperThreads.get());
+    }
     thread = Thread::createFunc(worker, reinterpret_cast<void *>(this));
 }
 
@@ -32,19 +37,50 @@ void DrmGemCloseWorker::closeThread() {
         thread->join();
         thread.reset();
     }
+    closeHelperThreads();
+}
+
+void DrmGemCloseWorker::closeHelperThreads() {
+    if (helperThreads.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(helperMutex);
+        helpersActive = false;
+    }
+    helperCondition.notify_all();
+    for (auto &helperThread : helperThreads) {
+        helperThread->join();
+    }
+    helperThreads.clear();
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+
+    if (debugManager.flags.PrintDebugMessages.get()) {
+        auto workerStats = getStats();
+        PRINT_STRING(true, stdout, "Gem close worker - batches: %" PRIu64 ", buffer objects: %" PRIu64 ", coalesced waits: %" PRIu64 ", peak queue depth: %u\n",
+                     workerStats.processedBatchesCount, workerStats.processedBuffersCount, workerStats.coalescedWaitsCount, workerStats.peakQueueDepth);
+    }
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    const auto queueDepth = ++workCount;
+    auto peak = peakQueueDepth.load();
+    while (queueDepth > peak && !peakQueueDepth.compare_exchange_weak(peak, queueDepth)) {
+    }
+
+    auto node = new QueueNode{bo, queueHead.load()};
+    while (!queueHead.compare_exchange_weak(node->next, node)) {
+    }
+
+    if (node->next == nullptr) {
+        // queue was empty, worker may be waiting
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -59,47 +95,134 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
+DrmGemCloseWorkerStats DrmGemCloseWorker::getStats() const {
+    return {processedBatchesCount.load(), processedBuffersCount.load(), coalescedWaitsCount.load(), peakQueueDepth.load()};
+}
+
+uint32_t DrmGemCloseWorker::getHelperThreadsCount(size_t batchSize) const {
+    return static_cast<uint32_t>(std::min<size_t>(maxHelperThreads, batchSize / minimalBatchSizePerHelperThread));
+}
+
+inline void DrmGemCloseWorker::close(BatchEntry &workItem) {
+    auto &[bo, referencesCount] = workItem;
     bo->wait(-1);
-    memoryManager.unreference(bo, false);
-    workCount--;
+    for (uint32_t i = 0; i < referencesCount; i++) {
+        memoryManager.unreference(bo, false);
+        workCount--;
+    }
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+DrmGemCloseWorker::QueueNode *DrmGemCloseWorker::takeQueue() {
+    return queueHead.exchange(nullptr);
+}
+
+void DrmGemCloseWorker::processBatchEntries() {
+    const auto batchSize = batchEntries.size();
+    while (true) {
+        const auto first = nextBatchEntry.fetch_add(batchChunkSize);
+        if (first >= batchSize) {
+            return;
+        }
+        const auto last = std::min(first + batchChunkSize, batchSize);
+        for (auto i = first; i < last; i++) {
+            close(batchEntries[i]);
+        }
     }
 }
 
-void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+inline void DrmGemCloseWorker::processQueue(QueueNode *inputQueue) {
+    if (inputQueue == nullptr) {
+        return;
+    }
 
-    while (self->active) {
-        lock.lock();
+    batchEntries.clear();
+    while (inputQueue != nullptr) {
+        batchEntries.emplace_back(inputQueue->bo, 1u);
+        auto next = inputQueue->next;
+        delete inputQueue;
+        inputQueue = next;
+    }
+    const auto queuedBuffersCount = batchEntries.size();
+
+    // the same buffer object may be queued after every submission, a single wait covers all of them
+    std::sort(batchEntries.begin(), batchEntries.end());
+    size_t uniqueCount = 0u;
+    for (const auto &entry : batchEntries) {
+        if (uniqueCount > 0u && batchEntries[uniqueCount - 1].first == entry.first) {
+            batchEntries[uniqueCount - 1].second++;
+        } else {
+            batchEntries[uniqueCount++] = entry;
+        }
+    }
+    batchEntries.resize(uniqueCount);
 
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+    processedBatchesCount++;
+    processedBuffersCount += queuedBuffersCount;
+    coalescedWaitsCount += queuedBuffersCount - uniqueCount;
+
+    const auto helperThreadsCount = getHelperThreadsCount(uniqueCount);
+    while (helperThreads.size() < helperThreadsCount) {
+        helperThreads.push_back(Thread::createFunc(helperWorker, reinterpret_cast<void *>(this)));
+    }
+
+    nextBatchEntry.store(0u);
+    if (helperThreadsCount > 0u) {
+        {
+            std::lock_guard<std::mutex> lock(helperMutex);
+            busyHelpersCount = static_cast<uint32_t>(helperThreads.size());
+            batchGeneration++;
         }
+        helperCondition.notify_all();
+    }
+
+    processBatchEntries();
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+    if (helperThreadsCount > 0u) {
+        std::unique_lock<std::mutex> lock(helperMutex);
+        helperCondition.wait(lock, [this]() { return busyHelpersCount == 0u; });
+    }
+}
+
+void *DrmGemCloseWorker::worker(void *arg) {
+    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+
+    while (self->active) {
+        {
+            std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+            while (self->queueHead.load() == nullptr && self->active) {
+                self->condition.wait(lock);
+            }
         }
 
-        lock.unlock();
-        self->processQueue(localQueue);
+        self->processQueue(self->takeQueue());
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
+    self->processQueue(self->takeQueue());
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
+
+void *DrmGemCloseWorker::helperWorker(void *arg) {
+    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+    uint64_t processedGeneration = 0u;
+
+    std::unique_lock<std::mutex> lock(self->helperMutex);
+    while (true) {
+        self->helperCondition.wait(lock, [&]() { return !self->helpersActive || self->batchGeneration != processedGeneration; });
+        if (!self->helpersActive) {
+            break;
+        }
+        processedGeneration = self->batchGeneration;
+
+        lock.unlock();
+        self->processBatchEntries();
+        lock.lock();
+
+        if (--self->busyHelpersCount == 0u) {
+            self->helperCondition.notify_all();
+        }
+    }
+    return nullptr;
+}
 } // namespace NEO
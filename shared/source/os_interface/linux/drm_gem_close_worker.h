@@ -11,8 +11,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,8 +26,18 @@ enum class GemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct DrmGemCloseWorkerStats {
+    uint64_t processedBatchesCount = 0u;
+    uint64_t processedBuffersCount = 0u;
+    uint64_t coalescedWaitsCount = 0u;
+    uint32_t peakQueueDepth = 0u;
+};
+
 class DrmGemCloseWorker : NEO::NonCopyableAndNonMovableClass {
   public:
+    static constexpr size_t batchChunkSize = 64u;
+    static constexpr size_t minimalBatchSizePerHelperThread = 4 * batchChunkSize;
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
@@ -33,17 +45,33 @@ class DrmGemCloseWorker : NEO::NonCopyableAndNonMovableClass {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    DrmGemCloseWorkerStats getStats() const;
 
   protected:
-    void close(BufferObject *workItem);
+    struct QueueNode {
+        BufferObject *bo;
+        QueueNode *next;
+    };
+    // buffer object with number of its references queued in a batch
+    using BatchEntry = std::pair<BufferObject *, uint32_t>;
+
+    void close(BatchEntry &workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void closeHelperThreads();
+    QueueNode *takeQueue();
+    void processQueue(QueueNode *inputQueue);
+    void processBatchEntries();
+    uint32_t getHelperThreadsCount(size_t batchSize) const;
     static void *worker(void *arg);
+    static void *helperWorker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
+    std::vector<std::unique_ptr<Thread>> helperThreads;
 
-    std::queue<BufferObject *> queue;
+    // producers push with CAS, worker takes whole list at once
+    std::atomic<QueueNode *> queueHead{nullptr};
     std::atomic<uint32_t> workCount{0};
 
     DrmMemoryManager &memoryManager;
@@ -51,6 +79,20 @@ class DrmGemCloseWorker : NEO::NonCopyableAndNonMovableClass {
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
     std::atomic<bool> workerDone{false};
+
+    std::mutex helperMutex;
+    std::condition_variable helperCondition;
+    std::vector<BatchEntry> batchEntries;
+    std::atomic<size_t> nextBatchEntry{0u};
+    uint64_t batchGeneration = 0u;
+    uint32_t busyHelpersCount = 0u;
+    bool helpersActive = true;
+    uint32_t maxHelperThreads = 0u;
+
+    std::atomic<uint32_t> peakQueueDepth{0u};
+    std::atomic<uint64_t> processedBatchesCount{0u};
+    std::atomic<uint64_t> processedBuffersCount{0u};
+    std::atomic<uint64_t> coalescedWaitsCount{0u};
 };
 
 static_assert(NEO::NonCopyableAndNonMovable<DrmGemCloseWorker>);
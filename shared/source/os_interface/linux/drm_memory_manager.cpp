@@ -825,6 +825,10 @@ bool DrmMemoryManager::unMapPhysicalDeviceMemoryFromVirtualMemory(GraphicsAlloca
             bufferObject->setPhysicalMemoryOffset(0u);
         }
     }
+    auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandler *>(executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->memoryOperationsInterface.get());
+    if (memoryOperationsInterface) {
+        memoryOperationsInterface->invalidateResidencyTracking();
+    }
     physicalAllocation->setCpuPtrAndGpuAddress(nullptr, 0u);
     physicalAllocation->setReservedAddressRange(nullptr, 0u);
     return result;
@@ -36,6 +36,7 @@ class DrmMemoryOperationsHandler : public MemoryOperationsHandler {
     }
 
     virtual bool obtainAndResetNewResourcesSinceLastRingSubmit() { return false; }
+    virtual void invalidateResidencyTracking() {}
 
   protected:
     virtual int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield) = 0;
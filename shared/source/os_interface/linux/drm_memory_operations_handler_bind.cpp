@@ -20,6 +20,9 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace NEO {
 
 DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
@@ -100,9 +103,13 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::lock(Device *device, Arra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence, const bool acquireLock) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable, forcePagingFence);
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -160,6 +167,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsCo
 
 int DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield) {
     auto drmAllocation = static_cast<DrmAllocation *>(&gfxAllocation);
+    removeFromResidencySnapshots(gfxAllocation);
     for (auto drmIterator = 0u; drmIterator < deviceBitfield.size(); drmIterator++) {
         if (deviceBitfield.test(drmIterator)) {
             int retVal = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, false, false);
@@ -192,6 +200,25 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device
     return MemoryOperationsStatus::memoryNotFound;
 }
 
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::free(Device *device, GraphicsAllocation &gfxAllocation) {
+    // freed allocation pointer may be reused by a new allocation
+    std::lock_guard<std::mutex> lock(mutex);
+    removeFromResidencySnapshots(gfxAllocation);
+    return MemoryOperationsStatus::success;
+}
+
+void DrmMemoryOperationsHandlerBind::removeFromResidencySnapshots(GraphicsAllocation &gfxAllocation) {
+    for (auto &[contextId, snapshot] : residencySnapshots) {
+        if (snapshot.residentAllocations.erase(&gfxAllocation) > 0) {
+            snapshot.lastMergedContainer.clear();
+        }
+    }
+}
+
+void DrmMemoryOperationsHandlerBind::invalidateResidencyTracking() {
+    residencyGeneration++;
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) {
     if (debugManager.flags.MakeEachAllocationResident.get() == 2) {
         auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
@@ -201,6 +228,10 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
         this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(memoryManager->getLocalMemAllocs(this->rootDeviceIndex)), true, false, true);
     }
 
+    if (debugManager.flags.EnableResidencyDeltaTracking.get() == 1) {
+        return mergeResidencyDelta(osContext, residencyContainer);
+    }
+
     auto retVal = this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(residencyContainer), true, false, true);
     if (retVal != MemoryOperationsStatus::success) {
         return retVal;
@@ -209,6 +240,39 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
     return MemoryOperationsStatus::success;
 }
 
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeResidencyDelta(OsContext *osContext, ResidencyContainer &residencyContainer) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto contextId = osContext->getContextId();
+    auto &snapshot = residencySnapshots[contextId];
+    const auto currentGeneration = residencyGeneration.load();
+    if (snapshot.generation != currentGeneration) {
+        snapshot.residentAllocations.clear();
+        snapshot.lastMergedContainer.clear();
+        snapshot.generation = currentGeneration;
+    }
+
+    // entries matching the previously merged container are resident already, only the changed tail is looked up
+    auto unchangedEnd = std::mismatch(residencyContainer.begin(), residencyContainer.end(),
+                                      snapshot.lastMergedContainer.begin(), snapshot.lastMergedContainer.end())
+                            .first;
+    ResidencyContainer newAllocations;
+    for (auto gfxAllocation = unchangedEnd; gfxAllocation != residencyContainer.end(); gfxAllocation++) {
+        if (snapshot.residentAllocations.insert(*gfxAllocation).second) {
+            newAllocations.push_back(*gfxAllocation);
+        }
+    }
+    residencySnapshotLookups += std::distance(unchangedEnd, residencyContainer.end());
+    skippedResidencyChecks += residencyContainer.size() - newAllocations.size();
+    snapshot.lastMergedContainer.assign(residencyContainer.begin(), residencyContainer.end());
+
+    auto retVal = makeResidentWithinOsContextImpl(osContext, ArrayRef<GraphicsAllocation *>(newAllocations), true, false);
+    if (retVal != MemoryOperationsStatus::success) {
+        residencySnapshots.erase(contextId);
+    }
+    return retVal;
+}
+
 std::unique_lock<std::mutex> DrmMemoryOperationsHandlerBind::lockHandlerIfUsed() {
     return std::unique_lock<std::mutex>(mutex);
 }
@@ -9,6 +9,10 @@
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace NEO {
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
@@ -23,6 +27,7 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus evict(Device *device, GraphicsAllocation &gfxAllocation) override;
     MemoryOperationsStatus evictWithinOsContext(OsContext *osContext, GraphicsAllocation &gfxAllocation) override;
     MemoryOperationsStatus isResident(Device *device, GraphicsAllocation &gfxAllocation) override;
+    MemoryOperationsStatus free(Device *device, GraphicsAllocation &gfxAllocation) override;
 
     MemoryOperationsStatus mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) override;
     [[nodiscard]] std::unique_lock<std::mutex> lockHandlerIfUsed() override;
@@ -32,7 +37,26 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus makeResidentAsync(OsContext *osContext, GraphicsAllocation *gfxAllocation) override;
     MemoryOperationsStatus waitForAsyncResidency(OsContext *osContext, GraphicsAllocation *gfxAllocation) override;
 
+    void invalidateResidencyTracking() override;
+    // Skipped checks only save BO lookups and bind info walks: the regular path does not issue
+    // a vm_bind ioctl for BOs bound already, so delta tracking avoids no ioctls.
+    uint64_t getSkippedResidencyChecksCount() const { return skippedResidencyChecks.load(); }
+
   protected:
+    struct ResidencySnapshot {
+        std::unordered_set<GraphicsAllocation *> residentAllocations;
+        ResidencyContainer lastMergedContainer;
+        uint64_t generation = 0;
+    };
+
     int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield) override;
+    MemoryOperationsStatus makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence);
+    MemoryOperationsStatus mergeResidencyDelta(OsContext *osContext, ResidencyContainer &residencyContainer);
+    void removeFromResidencySnapshots(GraphicsAllocation &gfxAllocation);
+
+    std::unordered_map<uint32_t, ResidencySnapshot> residencySnapshots;
+    std::atomic<uint64_t> residencyGeneration{0};
+    std::atomic<uint64_t> skippedResidencyChecks{0};
+    std::atomic<uint64_t> residencySnapshotLookups{0};
 };
 } // namespace NEO
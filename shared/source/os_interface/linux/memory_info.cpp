@@ -43,7 +43,7 @@ MemoryInfo::MemoryInfo(const RegionContainer &regionInfo, const Drm &inputDrm)
 
     memPolicySupported = false;
     if (debugManager.flags.EnableHostAllocationMemPolicy.get()) {
-        memPolicySupported = Linux::NumaLibrary::init();
+        memPolicySupported = Linux::NumaLibrary::initOnce();
     }
     memPolicyMode = debugManager.flags.OverrideHostAllocationMemPolicyMode.get();
 }
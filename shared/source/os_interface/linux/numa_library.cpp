@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,20 +19,40 @@ std::unique_ptr<NEO::OsLibrary> NumaLibrary::osLibrary(nullptr);
 NumaLibrary::GetMemPolicyPtr NumaLibrary::getMemPolicyFunction(nullptr);
 NumaLibrary::NumaAvailablePtr NumaLibrary::numaAvailableFunction(nullptr);
 NumaLibrary::NumaMaxNodePtr NumaLibrary::numaMaxNodeFunction(nullptr);
+NumaLibrary::NumaRunOnNodePtr NumaLibrary::numaRunOnNodeFunction(nullptr);
 int NumaLibrary::maxNode(-1);
 bool NumaLibrary::numaLoaded(false);
+bool NumaLibrary::numaInitAttempted(false);
+std::mutex NumaLibrary::initMutex;
 
 bool NumaLibrary::init() {
+    std::lock_guard<std::mutex> lock(initMutex);
+    numaInitAttempted = true;
+    return load();
+}
+
+bool NumaLibrary::initOnce() {
+    std::lock_guard<std::mutex> lock(initMutex);
+    if (!numaInitAttempted) {
+        numaInitAttempted = true;
+        load();
+    }
+    return numaLoaded;
+}
+
+bool NumaLibrary::load() {
     osLibrary.reset(NEO::OsLibrary::loadFunc(std::string(numaLibNameStr)));
     numaLoaded = false;
     numaAvailableFunction = nullptr;
     numaMaxNodeFunction = nullptr;
     getMemPolicyFunction = nullptr;
+    numaRunOnNodeFunction = nullptr;
     if (osLibrary) {
         DEBUG_BREAK_IF(!osLibrary->isLoaded());
         numaAvailableFunction = reinterpret_cast<NumaAvailablePtr>(osLibrary->getProcAddress(std::string(procNumaAvailableStr)));
         numaMaxNodeFunction = reinterpret_cast<NumaMaxNodePtr>(osLibrary->getProcAddress(std::string(procNumaMaxNodeStr)));
         getMemPolicyFunction = reinterpret_cast<GetMemPolicyPtr>(osLibrary->getProcAddress(std::string(procGetMemPolicyStr)));
+        numaRunOnNodeFunction = reinterpret_cast<NumaRunOnNodePtr>(osLibrary->getProcAddress(std::string(procNumaRunOnNodeStr)));
         if (numaAvailableFunction && numaMaxNodeFunction && getMemPolicyFunction) {
             if ((*numaAvailableFunction)() == 0) {
                 maxNode = (*numaMaxNodeFunction)();
@@ -52,5 +72,12 @@ bool NumaLibrary::getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask)
     return false;
 }
 
+bool NumaLibrary::runOnNode(int node) {
+    if (numaLoaded && numaRunOnNodeFunction && node <= maxNode) {
+        return (*numaRunOnNodeFunction)(node) == 0;
+    }
+    return false;
+}
+
 } // namespace Linux
 } // namespace NEO
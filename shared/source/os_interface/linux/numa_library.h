@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 namespace NEO {
 namespace Linux {
@@ -19,25 +20,35 @@ namespace Linux {
 class NumaLibrary {
   public:
     static bool init();
+    // Loads the library on the first call only, later calls return the cached result. Safe to call from multiple threads.
+    static bool initOnce();
     static bool isLoaded() { return numaLoaded; }
     static bool getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask);
+    static bool runOnNode(int node);
 
   protected:
+    static bool load();
+
     static constexpr const char *numaLibNameStr = "libnuma.so.1";
     static constexpr const char *procGetMemPolicyStr = "get_mempolicy";
     static constexpr const char *procNumaAvailableStr = "numa_available";
     static constexpr const char *procNumaMaxNodeStr = "numa_max_node";
+    static constexpr const char *procNumaRunOnNodeStr = "numa_run_on_node";
 
     using GetMemPolicyPtr = std::add_pointer<long(int *, unsigned long[], unsigned long, void *, unsigned long)>::type;
     using NumaAvailablePtr = std::add_pointer<int(void)>::type;
     using NumaMaxNodePtr = std::add_pointer<int(void)>::type;
+    using NumaRunOnNodePtr = std::add_pointer<int(int)>::type;
 
     static std::unique_ptr<NEO::OsLibrary> osLibrary;
     static GetMemPolicyPtr getMemPolicyFunction;
     static NumaAvailablePtr numaAvailableFunction;
     static NumaMaxNodePtr numaMaxNodeFunction;
+    static NumaRunOnNodePtr numaRunOnNodeFunction;
     static int maxNode;
     static bool numaLoaded;
+    static bool numaInitAttempted;
+    static std::mutex initMutex;
 };
 } // namespace Linux
 } // namespace NEO
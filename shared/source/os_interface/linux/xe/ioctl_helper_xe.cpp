@@ -855,6 +855,10 @@ int IoctlHelperXe::waitUserFence(uint32_t ctxId, uint64_t address,
     XELOG(" -> IoctlHelperXe::%s a=0x%llx v=0x%llx w=0x%x T=0x%llx F=0x%x ctx=0x%x\n", __FUNCTION__, address, value, dataWidth, timeout, flags, ctxId);
     UNRECOVERABLE_IF(dataWidth != static_cast<uint32_t>(Drm::ValueWidth::u64));
     if (address) {
+        auto ret = flushPendingVmBinds();
+        if (ret != 0) {
+            return ret;
+        }
         return xeWaitUserFence(ctxId, DRM_XE_UFENCE_WAIT_OP_GTE, address, value, timeout, userInterrupt, externalInterruptId, allocForInterruptWait);
     }
     return 0;
@@ -867,6 +871,10 @@ int IoctlHelperXe::waitUserFence(UserFenceWaitOperation operation, uint32_t ctxI
     if (!address) {
         return 0;
     }
+    auto ret = flushPendingVmBinds();
+    if (ret != 0) {
+        return ret;
+    }
 
     uint16_t xeOperation = DRM_XE_UFENCE_WAIT_OP_GTE;
     switch (operation) {
@@ -1103,6 +1111,9 @@ bool IoctlHelperXe::setVmBoAdviseForChunking(int32_t handle, uint64_t start, uin
 
 bool IoctlHelperXe::setVmPrefetch(uint64_t start, uint64_t length, uint32_t region, uint32_t vmId) {
     XELOG(" -> IoctlHelperXe::%s s=0x%llx l=0x%llx align_s=0x%llx align_l=0x%llx vmid=0x%x\n", __FUNCTION__, start, length, alignDown(start, MemoryConstants::pageSize), alignSizeWholePage(reinterpret_cast<void *>(start), length), vmId);
+    if (flushPendingVmBinds() != 0) {
+        return false;
+    }
     drm_xe_vm_bind bind = {};
     bind.vm_id = vmId;
     bind.num_binds = 1;
@@ -1140,6 +1151,9 @@ bool IoctlHelperXe::setVmPrefetch(uint64_t start, uint64_t length, uint32_t regi
 
 bool IoctlHelperXe::setVmSharedSystemMemPrefetch(uint64_t start, uint64_t length, uint32_t region, uint32_t vmId) {
     XELOG(" -> IoctlHelperXe::%s s=0x%llx l=0x%llx align_s=0x%llx align_l=0x%llx vmid=0x%x\n", __FUNCTION__, start, length, alignDown(start, MemoryConstants::pageSize), alignSizeWholePage(reinterpret_cast<void *>(start), length), vmId);
+    if (flushPendingVmBinds() != 0) {
+        return false;
+    }
     drm_xe_vm_bind bind = {};
     bind.vm_id = vmId;
     bind.num_binds = 1;
@@ -1224,6 +1238,11 @@ int IoctlHelperXe::execBuffer(ExecBuffer *execBuffer, uint64_t completionGpuAddr
     if (execBuffer) {
         auto execBufferXe = reinterpret_cast<ExecBufferXe *>(execBuffer->data);
         if (execBufferXe) {
+            ret = flushPendingVmBinds();
+            if (ret != 0) {
+                return ret;
+            }
+
             auto execObject = execBufferXe->execObject;
             uint32_t engine = execBufferXe->drmContextId;
 
@@ -1384,10 +1403,32 @@ std::optional<uint32_t> IoctlHelperXe::getVmAdviseAtomicAttribute() {
 }
 
 int IoctlHelperXe::vmBind(const VmBindParams &vmBindParams) {
+    if (isVmBindBatchable(vmBindParams)) {
+        return queueVmBind(vmBindParams);
+    }
+    auto ret = flushPendingVmBinds();
+    if (ret != 0) {
+        return ret;
+    }
     return xeVmBind(vmBindParams, true);
 }
 
 int IoctlHelperXe::vmUnbind(const VmBindParams &vmBindParams) {
+    // Drm clears the handle before unbinding, pending binds are matched on the vm range only
+    auto overlapsUnbindRange = [&vmBindParams](const VmBindParams &params) {
+        return params.vmId == vmBindParams.vmId &&
+               (params.start == vmBindParams.start ||
+                (params.start < vmBindParams.start + vmBindParams.length && vmBindParams.start < params.start + params.length));
+    };
+    if (hasPendingVmBinds(overlapsUnbindRange)) {
+        auto ret = flushPendingVmBinds();
+        if (ret != 0) {
+            // a failed bind of the range being unbound must not be replayed after the unbind,
+            // failed binds of other ranges stay queued and must not fail this unbind
+            XELOG("error: flushing pending binds before unbind of addr=0x%llx ret=%d\n", vmBindParams.start, ret);
+            discardPendingVmBinds(overlapsUnbindRange);
+        }
+    }
     return xeVmBind(vmBindParams, false);
 }
 
@@ -1566,6 +1607,8 @@ int IoctlHelperXe::ioctl(DrmIoctl request, void *arg) {
         XELOG(" -> IoctlHelperXe::ioctl GemContextSetparam r=%d\n", ret);
     } break;
     case DrmIoctl::gemClose: {
+        discardPendingVmBinds([handle = static_cast<struct GemClose *>(arg)->handle](const VmBindParams &params) { return params.handle == handle; });
+        flushPendingVmBinds();
         std::unique_lock<std::mutex> lock(gemCloseLock);
         struct GemClose *d = static_cast<struct GemClose *>(arg);
         xeShowBindTable();
@@ -1600,6 +1643,8 @@ int IoctlHelperXe::ioctl(DrmIoctl request, void *arg) {
     } break;
     case DrmIoctl::gemVmDestroy: {
         GemVmControl *d = static_cast<GemVmControl *>(arg);
+        discardPendingVmBinds([vmId = d->vmId](const VmBindParams &params) { return params.vmId == vmId; });
+        flushPendingVmBinds();
         struct drm_xe_vm_destroy args = {};
         args.vm_id = d->vmId;
         ret = IoctlHelper::ioctl(request, &args);
@@ -1758,26 +1803,15 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
     const char *operation = isBind ? "bind" : "unbind";
 
     uint64_t userptr = 0u;
-    {
+    if (isBind) {
+        userptr = resolveBindUserptr(vmBindParams);
+    } else {
         std::unique_lock<std::mutex> lock(xeLock);
-        if (isBind) {
-            if (vmBindParams.userptr) {
-                for (auto i = 0u; i < bindInfo.size(); i++) {
-                    if (vmBindParams.userptr == bindInfo[i].userptr) {
-                        userptr = bindInfo[i].userptr;
-                        bindInfo[i].addr = gmmHelper->decanonize(vmBindParams.start);
-                        break;
-                    }
-                }
-            }
-        } else // unbind
-        {
-            auto address = gmmHelper->decanonize(vmBindParams.start);
-            for (auto i = 0u; i < bindInfo.size(); i++) {
-                if (address == bindInfo[i].addr) {
-                    userptr = bindInfo[i].userptr;
-                    break;
-                }
+        auto address = gmmHelper->decanonize(vmBindParams.start);
+        for (auto i = 0u; i < bindInfo.size(); i++) {
+            if (address == bindInfo[i].addr) {
+                userptr = bindInfo[i].userptr;
+                break;
             }
         }
     }
@@ -1890,17 +1924,194 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
         return ret;
     }
 
+    return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
+                           sync[0].addr,
+                           sync[0].timeline_value, getVmBindWaitTimeout(),
+                           false, NEO::InterruptId::notUsed, nullptr);
+}
+
+uint64_t IoctlHelperXe::resolveBindUserptr(const VmBindParams &vmBindParams) {
+    if (!vmBindParams.userptr) {
+        return 0u;
+    }
+    auto gmmHelper = drm.getRootDeviceEnvironment().getGmmHelper();
+    std::unique_lock<std::mutex> lock(xeLock);
+    for (auto i = 0u; i < bindInfo.size(); i++) {
+        if (vmBindParams.userptr == bindInfo[i].userptr) {
+            bindInfo[i].addr = gmmHelper->decanonize(vmBindParams.start);
+            return bindInfo[i].userptr;
+        }
+    }
+    return 0u;
+}
+
+int64_t IoctlHelperXe::getVmBindWaitTimeout() const {
     constexpr auto oneSecTimeout = 1000000000ll;
     constexpr auto infiniteTimeout = -1;
     bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
-    uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
+    int64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
     if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
         timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
     }
-    return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
-                           sync[0].addr,
-                           sync[0].timeline_value, timeout,
-                           false, NEO::InterruptId::notUsed, nullptr);
+    return timeout;
+}
+
+bool IoctlHelperXe::isVmBindBatchable(const VmBindParams &vmBindParams) const {
+    if (debugManager.flags.EnableXeVmBindBatching.get() != 1) {
+        return false;
+    }
+    if (drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled()) {
+        return false;
+    }
+    // extensions may point to caller's stack, decompression needs the bind to complete before returning
+    return vmBindParams.userFence != 0u &&
+           vmBindParams.extensions == 0u &&
+           !vmBindParams.sharedSystemUsmBind &&
+           !(vmBindParams.flags & getVmBindDecompressFlag());
+}
+
+int IoctlHelperXe::queueVmBind(const VmBindParams &vmBindParams) {
+    auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams.userFence);
+    UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
+
+    auto userptr = resolveBindUserptr(vmBindParams);
+
+    bool flushRequired = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingVmBindsLock);
+        pendingVmBinds.push_back({vmBindParams, userptr, xeBindExtUserFence->addr, xeBindExtUserFence->value});
+        pendingVmBinds.back().params.userFence = 0u;
+        flushRequired = pendingVmBinds.size() >= maxPendingVmBinds;
+    }
+    XELOG(" -> IoctlHelperXe::%s vm=%d h=0x%x addr=0x%llx queued\n", __FUNCTION__, vmBindParams.vmId, vmBindParams.handle, vmBindParams.start);
+
+    if (flushRequired) {
+        return flushPendingVmBinds();
+    }
+    return 0;
+}
+
+int IoctlHelperXe::flushPendingVmBinds() {
+    if (debugManager.flags.EnableXeVmBindBatching.get() != 1) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(pendingVmBindsLock);
+    if (pendingVmBinds.empty()) {
+        return 0;
+    }
+
+    std::vector<PendingVmBind> binds;
+    binds.swap(pendingVmBinds);
+    std::stable_sort(binds.begin(), binds.end(), [](const auto &a, const auto &b) { return a.params.vmId < b.params.vmId; });
+
+    int ret = 0;
+    std::vector<PendingVmBind> failedBinds;
+    size_t groupStart = 0;
+    while (groupStart < binds.size()) {
+        size_t groupEnd = groupStart + 1;
+        while (groupEnd < binds.size() && binds[groupEnd].params.vmId == binds[groupStart].params.vmId) {
+            groupEnd++;
+        }
+        auto groupRet = submitPendingVmBinds(&binds[groupStart], groupEnd - groupStart, failedBinds);
+        if (ret == 0) {
+            ret = groupRet;
+        }
+        groupStart = groupEnd;
+    }
+
+    // callers already treat the buffer objects as bound, failed binds stay queued so the next flush
+    // (e.g. exec retried after eviction) submits them again
+    pendingVmBinds = std::move(failedBinds);
+    return ret;
+}
+
+bool IoctlHelperXe::hasPendingVmBinds(const std::function<bool(const VmBindParams &)> &matches) {
+    std::lock_guard<std::mutex> lock(pendingVmBindsLock);
+    return std::any_of(pendingVmBinds.begin(), pendingVmBinds.end(), [&matches](const PendingVmBind &pending) { return matches(pending.params); });
+}
+
+bool IoctlHelperXe::discardPendingVmBinds(const std::function<bool(const VmBindParams &)> &shouldDiscard) {
+    std::lock_guard<std::mutex> lock(pendingVmBindsLock);
+    std::erase_if(pendingVmBinds, [&shouldDiscard](const PendingVmBind &pending) { return shouldDiscard(pending.params); });
+    return pendingVmBinds.empty();
+}
+
+int IoctlHelperXe::submitPendingVmBinds(const PendingVmBind *pendingBinds, size_t count, std::vector<PendingVmBind> &failedBinds) {
+    auto gmmHelper = drm.getRootDeviceEnvironment().getGmmHelper();
+
+    std::vector<drm_xe_vm_bind_op> bindOps(count);
+    std::vector<drm_xe_sync> syncs;
+    for (size_t i = 0; i < count; i++) {
+        auto &pending = pendingBinds[i];
+        auto &bindOp = bindOps[i];
+        bindOp.range = pending.params.length;
+        bindOp.obj_offset = pending.params.offset;
+        bindOp.pat_index = static_cast<uint16_t>(pending.params.patIndex);
+        bindOp.flags = static_cast<uint32_t>(pending.params.flags);
+        bindOp.addr = gmmHelper->decanonize(pending.params.start);
+        bindOp.op = DRM_XE_VM_BIND_OP_MAP;
+        bindOp.obj = pending.params.handle;
+        if (pending.userptr) {
+            bindOp.op = DRM_XE_VM_BIND_OP_MAP_USERPTR;
+            bindOp.obj = 0;
+            bindOp.obj_offset = pending.userptr;
+        }
+
+        // fence values on the same address are monotonic, signaling the highest one covers all queued binds
+        auto sync = std::find_if(syncs.begin(), syncs.end(), [&](const auto &s) { return s.addr == pending.fenceAddress; });
+        if (sync != syncs.end()) {
+            sync->timeline_value = std::max(static_cast<uint64_t>(sync->timeline_value), pending.fenceValue);
+            continue;
+        }
+        drm_xe_sync newSync = {};
+        newSync.type = DRM_XE_SYNC_TYPE_USER_FENCE;
+        newSync.flags = DRM_XE_SYNC_FLAG_SIGNAL;
+        newSync.addr = pending.fenceAddress;
+        newSync.timeline_value = pending.fenceValue;
+        syncs.push_back(newSync);
+    }
+
+    drm_xe_vm_bind bind = {};
+    bind.vm_id = pendingBinds[0].params.vmId;
+    bind.num_binds = static_cast<uint32_t>(count);
+    if (count == 1) {
+        bind.bind = bindOps[0];
+    } else {
+        bind.vector_of_binds = reinterpret_cast<uintptr_t>(bindOps.data());
+    }
+    bind.num_syncs = static_cast<uint32_t>(syncs.size());
+    bind.syncs = reinterpret_cast<uintptr_t>(syncs.data());
+
+    int ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
+    XELOG(" vm=%d batched bind num_bind=%d nsy=%d ret=%d\n", bind.vm_id, bind.num_binds, bind.num_syncs, ret);
+
+    if (ret != 0) {
+        XELOG("error: batched bind, replaying %zu operations\n", count);
+        for (size_t i = 0; i < count; i++) {
+            UserFenceExtension userFence = {UserFenceExtension::tagValue, pendingBinds[i].fenceAddress, pendingBinds[i].fenceValue};
+            auto params = pendingBinds[i].params;
+            params.userFence = castToUint64(&userFence);
+            auto bindRet = xeVmBind(params, true);
+            if (bindRet != 0) {
+                failedBinds.push_back(pendingBinds[i]);
+            }
+            if (ret == 0 || bindRet != 0) {
+                ret = bindRet;
+            }
+        }
+        return ret;
+    }
+
+    for (const auto &sync : syncs) {
+        ret = xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_GTE,
+                              sync.addr,
+                              sync.timeline_value, getVmBindWaitTimeout(),
+                              false, NEO::InterruptId::notUsed, nullptr);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
 }
 
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
@@ -13,6 +13,7 @@
 #include "shared/source/os_interface/linux/xe/eudebug/eudebug_interface.h"
 
 #include <bitset>
+#include <functional>
 #include <mutex>
 #include <optional>
 
@@ -168,6 +169,7 @@ class IoctlHelperXe : public IoctlHelper {
 
   protected:
     static constexpr uint32_t maxContextSetProperties = 4;
+    static constexpr size_t maxPendingVmBinds = 512;
 
     bool isDeferBackingEnabled() const;
     virtual const char *xeGetClassName(int className) const;
@@ -180,6 +182,11 @@ class IoctlHelperXe : public IoctlHelper {
     virtual int xeWaitUserFence(uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait);
     void setupXeWaitUserFenceStruct(void *arg, uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    uint64_t resolveBindUserptr(const VmBindParams &vmBindParams);
+    int64_t getVmBindWaitTimeout() const;
+    bool isVmBindBatchable(const VmBindParams &vmBindParams) const;
+    int queueVmBind(const VmBindParams &vmBindParams);
+    int flushPendingVmBinds();
     void xeShowBindTable();
     void updateBindInfo(uint64_t userPtr);
     int debuggerOpenIoctl(DrmIoctl request, void *arg);
@@ -226,6 +233,18 @@ class IoctlHelperXe : public IoctlHelper {
     mutable std::once_flag checkVmBindDecompressOnce;
     mutable bool vmBindDecompressAvailable = false;
     std::vector<BindInfo> bindInfo;
+
+    struct PendingVmBind {
+        VmBindParams params;
+        uint64_t userptr;
+        uint64_t fenceAddress;
+        uint64_t fenceValue;
+    };
+    int submitPendingVmBinds(const PendingVmBind *pendingBinds, size_t count, std::vector<PendingVmBind> &failedBinds);
+    bool hasPendingVmBinds(const std::function<bool(const VmBindParams &)> &matches);
+    bool discardPendingVmBinds(const std::function<bool(const VmBindParams &)> &shouldDiscard);
+    std::mutex pendingVmBindsLock;
+    std::vector<PendingVmBind> pendingVmBinds;
     std::vector<uint32_t> hwconfig;
     std::vector<XeDrm::drm_xe_engine_class_instance> contextParamEngine;
 
@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -27,7 +29,13 @@ void CpuPageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsMana
     faultData.unifiedMemoryManager = unifiedMemoryManager;
     faultData.cmdQ = cmdQ;
     faultData.domain = domain;
-    this->memoryData.emplace(ptr, faultData);
+    faultData.chunkSize = getMigrationChunkSize(size);
+    if (faultData.chunkSize > 0u) {
+        faultData.chunkDomains.assign(Math::divideAndRoundUp(size, faultData.chunkSize), domain);
+    }
+    if (this->memoryData.emplace(ptr, std::move(faultData)).second) {
+        this->memoryDataRanges.insert(ptr, size);
+    }
     unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
@@ -42,12 +50,16 @@ void CpuPageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (pageFaultData.domain == AllocationDomain::cpu && pageFaultData.chunkSize > 0u) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
             }
         }
         this->memoryData.erase(ptr);
+        this->memoryDataRanges.remove(ptr);
     }
 }
 
@@ -90,35 +102,148 @@ inline void CpuPageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultD
             }
         }
 
-        start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
-        end = std::chrono::steady_clock::now();
-        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        if (pageFaultData.chunkSize > 0u) {
+            this->migrateChunksToGpuDomain(ptr, pageFaultData);
+        } else {
+            start = std::chrono::steady_clock::now();
+            this->transferToGpu(ptr, pageFaultData.cmdQ);
+            end = std::chrono::steady_clock::now();
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
-        PRINT_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            PRINT_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+            this->countMigratedBytes(AllocationDomain::gpu, pageFaultData.size);
+        }
     }
+    // chunks never touched by CPU may be written by GPU from now on, next CPU access has to transfer them back
+    std::replace(pageFaultData.chunkDomains.begin(), pageFaultData.chunkDomains.end(), AllocationDomain::none, AllocationDomain::gpu);
     pageFaultData.domain = AllocationDomain::gpu;
 }
 
+inline void CpuPageFaultManager::migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    auto &chunkDomains = pageFaultData.chunkDomains;
+    size_t chunkIndex = 0u;
+    while (chunkIndex < chunkDomains.size()) {
+        if (chunkDomains[chunkIndex] != AllocationDomain::cpu) {
+            chunkIndex++;
+            continue;
+        }
+
+        // neighbouring CPU chunks are transferred and protected together
+        auto endChunkIndex = chunkIndex;
+        while (endChunkIndex < chunkDomains.size() && chunkDomains[endChunkIndex] == AllocationDomain::cpu) {
+            chunkDomains[endChunkIndex++] = AllocationDomain::gpu;
+        }
+        const auto offset = chunkIndex * pageFaultData.chunkSize;
+        const auto size = std::min(endChunkIndex * pageFaultData.chunkSize, pageFaultData.size) - offset;
+
+        auto start = std::chrono::steady_clock::now();
+        this->transferChunkToGpu(ptr, offset, size, pageFaultData.cmdQ);
+        auto end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        PRINT_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx chunk at offset %zu (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), offset, size, elapsedTime / 1e3);
+
+        this->protectCPUMemoryAccess(ptrOffset(ptr, offset), size);
+        this->countMigratedBytes(AllocationDomain::gpu, size);
+        chunkIndex = endChunkIndex;
+    }
+}
+
 void CpuPageFaultManager::handlePageFault(void *ptr, PageFaultData &faultData) {
     gpuDomainHandler(this, ptr, faultData);
     this->setAubWritable(true, ptr, faultData.unifiedMemoryManager);
 }
 
+void CpuPageFaultManager::handleChunkPageFault(void *ptr, void *faultPtr, PageFaultData &faultData) {
+    const auto chunkIndex = ptrDiff(faultPtr, ptr) / faultData.chunkSize;
+    const auto offset = chunkIndex * faultData.chunkSize;
+    const auto size = std::min(faultData.chunkSize, faultData.size - offset);
+
+    auto &chunkDomain = faultData.chunkDomains[chunkIndex];
+    if (chunkDomain == AllocationDomain::gpu) {
+        auto start = std::chrono::steady_clock::now();
+        this->transferChunkToCpu(ptr, offset, size, faultData.cmdQ);
+        auto end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        PRINT_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx chunk at offset %zu (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), offset, size, elapsedTime / 1e3);
+        this->countMigratedBytes(AllocationDomain::cpu, size);
+    }
+    chunkDomain = AllocationDomain::cpu;
+    this->allowCPUMemoryAccess(ptrOffset(ptr, offset), size);
+
+    if (faultData.domain == AllocationDomain::gpu) {
+        this->trackAllocationInCpuDomain(ptr, faultData);
+        this->setCpuAllocEvictable(true, ptr, faultData.unifiedMemoryManager);
+        this->allowCPUMemoryEviction(true, ptr, faultData);
+    }
+    faultData.domain = AllocationDomain::cpu;
+    this->setAubWritable(true, ptr, faultData.unifiedMemoryManager);
+}
+
+void CpuPageFaultManager::disableChunkMigration(void *ptr, PageFaultData &faultData) {
+    if (faultData.domain == AllocationDomain::cpu) {
+        for (size_t chunkIndex = 0u; chunkIndex < faultData.chunkDomains.size(); chunkIndex++) {
+            if (faultData.chunkDomains[chunkIndex] == AllocationDomain::cpu) {
+                continue;
+            }
+            const auto offset = chunkIndex * faultData.chunkSize;
+            const auto size = std::min(faultData.chunkSize, faultData.size - offset);
+            if (faultData.chunkDomains[chunkIndex] == AllocationDomain::gpu) {
+                this->transferChunkToCpu(ptr, offset, size, faultData.cmdQ);
+                this->countMigratedBytes(AllocationDomain::cpu, size);
+            }
+            this->allowCPUMemoryAccess(ptrOffset(ptr, offset), size);
+        }
+    }
+    faultData.chunkSize = 0u;
+    faultData.chunkDomains.clear();
+}
+
+size_t CpuPageFaultManager::getMigrationChunkSize(size_t allocationSize) const {
+    if (debugManager.flags.SharedAllocationMigrationChunkSize.get() <= 0 || this->gpuDomainHandler != &transferAndUnprotectMemory) {
+        return 0u;
+    }
+    const auto chunkSize = alignUp(static_cast<size_t>(debugManager.flags.SharedAllocationMigrationChunkSize.get()) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+    return allocationSize > chunkSize ? chunkSize : 0u;
+}
+
 bool CpuPageFaultManager::verifyAndHandlePageFault(void *ptr, bool handleFault) {
     std::unique_lock<RecursiveSpinLock> lock{mtx};
-    auto allocPtr = getFaultData(memoryData, ptr, handleFault);
+    auto allocPtr = getFaultData(memoryDataRanges, ptr, handleFault);
     if (allocPtr == nullptr) {
         return false;
     }
     if (handleFault) {
-        handlePageFault(allocPtr, memoryData[allocPtr]);
+        auto &faultData = memoryData[allocPtr];
+        if (faultData.chunkSize > 0u && this->gpuDomainHandler != &transferAndUnprotectMemory) {
+            // handler replaced after insertion (e.g. memAdvise hints), it migrates whole allocations
+            disableChunkMigration(allocPtr, faultData);
+        }
+        if (faultData.chunkSize > 0u) {
+            handleChunkPageFault(allocPtr, ptr, faultData);
+        } else {
+            handlePageFault(allocPtr, faultData);
+        }
     }
     return true;
 }
 
+CpuPageFaultManager::MigrationStatistics CpuPageFaultManager::getMigrationStatistics() {
+    std::unique_lock<RecursiveSpinLock> lock{mtx};
+    return migrationStatistics;
+}
+
+void CpuPageFaultManager::countMigratedBytes(AllocationDomain targetDomain, size_t size) {
+    if (targetDomain == AllocationDomain::cpu) {
+        migrationStatistics.bytesMigratedToCpu += size;
+    } else {
+        migrationStatistics.bytesMigratedToGpu += size;
+    }
+}
+
 void CpuPageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
     this->gpuDomainHandler = gpuHandlerFuncPtr;
 }
@@ -159,17 +284,22 @@ inline void CpuPageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultD
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
         PRINT_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
-        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+        this->countMigratedBytes(AllocationDomain::cpu, pageFaultData.size);
+        this->trackAllocationInCpuDomain(ptr, pageFaultData);
+    }
+    pageFaultData.domain = AllocationDomain::cpu;
+}
 
-        if (hostFunctionActive) {
-            if (hostFunctionAllocationsToMigrate == nullptr) {
-                hostFunctionAllocationsToMigrate = new std::vector<void *>{ptr};
-            } else {
-                hostFunctionAllocationsToMigrate->push_back(ptr);
-            }
+inline void CpuPageFaultManager::trackAllocationInCpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+
+    if (hostFunctionActive) {
+        if (hostFunctionAllocationsToMigrate == nullptr) {
+            hostFunctionAllocationsToMigrate = new std::vector<void *>{ptr};
+        } else {
+            hostFunctionAllocationsToMigrate->push_back(ptr);
         }
     }
-    pageFaultData.domain = AllocationDomain::cpu;
 }
 
 void CpuPageFaultManager::migrateHostFunctionSharedAllocationsToGpuDomain() {
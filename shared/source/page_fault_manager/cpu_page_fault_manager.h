@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/page_fault_manager/fault_range_index.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include <memory>
@@ -53,6 +54,13 @@ class CpuPageFaultManager : public NonCopyableClass {
         size_t size = 0;
         SVMAllocsManager *unifiedMemoryManager = nullptr;
         void *cmdQ = nullptr;
+        size_t chunkSize = 0;
+        std::vector<AllocationDomain> chunkDomains;
+    };
+
+    struct MigrationStatistics {
+        uint64_t bytesMigratedToCpu = 0u;
+        uint64_t bytesMigratedToGpu = 0u;
     };
 
     typedef void (*gpuDomainHandlerFunc)(CpuPageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -62,6 +70,9 @@ class CpuPageFaultManager : public NonCopyableClass {
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
     virtual void uploadTbxAllocationsDuringHostFunction();
 
+    MigrationStatistics getMigrationStatistics();
+    void countMigratedBytes(AllocationDomain targetDomain, size_t size);
+
     void beginHostFunctionContext();
     void endHostFunctionContext();
     void migrateHostFunctionSharedAllocationsToGpuDomain();
@@ -74,21 +85,18 @@ class CpuPageFaultManager : public NonCopyableClass {
 
     virtual bool verifyAndHandlePageFault(void *ptr, bool handlePageFault);
 
-    template <class FaultDataType>
-    void *getFaultData(std::unordered_map<void *, FaultDataType> &memData, void *ptr, bool handleFault) {
-        for (auto &alloc : memData) {
-            auto allocPtr = alloc.first;
-            auto &pageFaultData = alloc.second;
-            if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-                return allocPtr;
-            }
-        }
-        return nullptr;
+    void *getFaultData(const FaultRangeIndex &faultRanges, void *ptr, bool handleFault) {
+        return faultRanges.find(ptr);
     }
 
     void handlePageFault(void *ptr, PageFaultData &faultData);
+    void handleChunkPageFault(void *ptr, void *faultPtr, PageFaultData &faultData);
+    void disableChunkMigration(void *ptr, PageFaultData &faultData);
+    size_t getMigrationChunkSize(size_t allocationSize) const;
 
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToCpu(void *ptr, size_t offset, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToGpu(void *ptr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(bool evict, void *ptr, PageFaultData &pageFaultData);
@@ -98,11 +106,15 @@ class CpuPageFaultManager : public NonCopyableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void trackAllocationInCpuDomain(void *ptr, PageFaultData &pageFaultData);
 
     using gpuDomainHandlerType = decltype(&transferAndUnprotectMemory);
     gpuDomainHandlerType gpuDomainHandler = &transferAndUnprotectMemory;
 
     std::unordered_map<void *, PageFaultData> memoryData;
+    FaultRangeIndex memoryDataRanges;
+    MigrationStatistics migrationStatistics;
     inline static thread_local std::vector<void *> *hostFunctionAllocationsToMigrate = nullptr;
     inline static thread_local bool hostFunctionActive = false;
 
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/page_fault_manager/fault_range_index.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool FaultRangeIndex::startsBefore(uintptr_t address, const Range &range) {
+    return address < range.start;
+}
+
+void FaultRangeIndex::insert(const void *ptr, size_t size) {
+    const auto start = reinterpret_cast<uintptr_t>(ptr);
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), start, startsBefore);
+    DEBUG_BREAK_IF(it != ranges.begin() && std::prev(it)->start == start);
+    ranges.insert(it, Range{start, start + size});
+}
+
+void FaultRangeIndex::remove(const void *ptr) {
+    const auto start = reinterpret_cast<uintptr_t>(ptr);
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), start, startsBefore);
+    if (it != ranges.begin() && std::prev(it)->start == start) {
+        ranges.erase(std::prev(it));
+    }
+}
+
+void *FaultRangeIndex::find(const void *ptr) const {
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), address, startsBefore);
+    if (it == ranges.begin()) {
+        return nullptr;
+    }
+    --it;
+    return address < it->end ? reinterpret_cast<void *>(it->start) : nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+
+/*
+ * Address ranges of allocations tracked by the page fault manager, kept sorted by start address.
+ * Ranges must not overlap. Lookup is a binary search which neither allocates nor takes locks,
+ * so it can be used from the SIGSEGV handler as long as the caller serializes it with updates.
+ */
+class FaultRangeIndex {
+  public:
+    void insert(const void *ptr, size_t size);
+    void remove(const void *ptr);
+    void *find(const void *ptr) const;
+
+    size_t size() const { return ranges.size(); }
+
+  protected:
+    struct Range {
+        uintptr_t start;
+        uintptr_t end;
+    };
+
+    static bool startsBefore(uintptr_t address, const Range &range);
+
+    std::vector<Range> ranges;
+};
+
+} // namespace NEO
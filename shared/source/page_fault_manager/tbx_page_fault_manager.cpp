@@ -16,11 +16,11 @@ namespace NEO {
 
 bool TbxPageFaultManager::verifyAndHandlePageFault(void *ptr, bool handleFault) {
     std::unique_lock<RecursiveSpinLock> lock{mtxTbx};
-    auto allocPtr = getFaultData(memoryDataTbx, ptr, handleFault);
+    auto allocPtr = getFaultData(memoryDataTbxRanges, ptr, handleFault);
     if (allocPtr == nullptr) {
         if (handleFault) {
             std::unique_lock<RecursiveSpinLock> lock{mtx};
-            auto allocPtr = getFaultData(memoryData, ptr, handleFault);
+            auto allocPtr = getFaultData(memoryDataRanges, ptr, handleFault);
             if (allocPtr != nullptr) {
                 auto &faultData = memoryData[allocPtr];
                 if (faultData.domain == CpuPageFaultManager::AllocationDomain::gpu) {
@@ -61,6 +61,7 @@ void TbxPageFaultManager::removeAllocation(GraphicsAllocation *alloc) {
         if (faultData.gfxAllocation == alloc) {
             auto size = faultData.size;
             memoryDataTbx.erase(allocPtr);
+            memoryDataTbxRanges.remove(allocPtr);
             this->allowCPUMemoryAccess(allocPtr, size);
             return;
         }
@@ -77,6 +78,7 @@ void TbxPageFaultManager::insertAllocation(CommandStreamReceiver *csr, GraphicsA
         pageFaultData.bank = bank;
         pageFaultData.csr = csr;
         memoryDataTbx[ptr] = pageFaultData;
+        memoryDataTbxRanges.insert(ptr, size);
     }
     auto &faultData = this->memoryDataTbx[ptr];
     faultData.hasBeenDownloaded = false;
@@ -39,6 +39,7 @@ class TbxPageFaultManager : public virtual CpuPageFaultManager {
     void handlePageFault(void *ptr, PageFaultDataTbx &faultData);
 
     std::unordered_map<void *, PageFaultDataTbx> memoryDataTbx;
+    FaultRangeIndex memoryDataTbxRanges;
     RecursiveSpinLock mtxTbx;
 };
 
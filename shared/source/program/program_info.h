@@ -54,6 +54,7 @@ struct ProgramInfo : NEO::NonCopyableClass {
     size_t kernelMiscInfoPos = std::string::npos;
     uint32_t samplerStateSize = 0u;
     uint32_t samplerBorderColorStateSize = 0u;
+    uint32_t maxKernelDecodeThreads = 1u;
 };
 
 static_assert(NEO::NonCopyable<ProgramInfo>);
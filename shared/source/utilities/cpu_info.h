@@ -23,6 +23,7 @@ struct CpuInfo {
     static const uint64_t featureAvX2 = 0x000800000ULL;
     static const uint64_t featureNeon = 0x001000000ULL;
     static const uint64_t featureAvX512 = 0x002000000ULL;
+    static const uint64_t featureAvX512BW = 0x004000000ULL;
     static const uint64_t featureClflush = 0x2000000000ULL;
 
     void cpuid(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,10 +25,12 @@ bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
 class HeapAllocator {
   public:
+    static constexpr size_t defaultSizeThreshold = 4 * MemoryConstants::megaByte;
+
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, 4 * MemoryConstants::megaByte) {
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, defaultSizeThreshold) {
     }
 
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : baseAddress(address), size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
@@ -38,7 +40,7 @@ class HeapAllocator {
         freedChunksSmall.reserve(50);
     }
 
-    MOCKABLE_VIRTUAL ~HeapAllocator() = default;
+    virtual ~HeapAllocator() = default;
 
     uint64_t allocate(size_t &sizeToAllocate) {
         return allocateWithCustomAlignment(sizeToAllocate, 0u);
@@ -48,10 +50,10 @@ class HeapAllocator {
         return allocateWithCustomAlignmentWithStartAddressHint(requiredStartAddress, sizeToAllocate, 0u);
     }
 
-    uint64_t allocateWithCustomAlignmentWithStartAddressHint(const uint64_t requiredStartAddress, size_t &sizeToAllocate, size_t alignment);
-    uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
+    virtual uint64_t allocateWithCustomAlignmentWithStartAddressHint(const uint64_t requiredStartAddress, size_t &sizeToAllocate, size_t alignment);
+    virtual uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
 
-    MOCKABLE_VIRTUAL void free(uint64_t ptr, size_t size);
+    virtual void free(uint64_t ptr, size_t size);
 
     uint64_t getLeftSize() const {
         return availableSize;
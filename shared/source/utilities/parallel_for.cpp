@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include <thread>
+
+namespace NEO {
+
+WorkerPool &getParallelForWorkerPool() {
+    static WorkerPool workerPool(std::thread::hardware_concurrency());
+    return workerPool;
+}
+
+} // namespace NEO
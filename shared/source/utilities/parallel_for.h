@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+
+// Process wide pool of parallelFor helpers, bounded by the number of hardware threads.
+WorkerPool &getParallelForWorkerPool();
+
+/*
+ * Calls func(index) once for every index in [0, count), using up to maxThreads threads (the calling thread included).
+ * Helpers run on getParallelForWorkerPool(). Indices are claimed in chunks of chunkSize, so the split does not depend on timing;
+ * func must only touch state owned by its index. Returns once all indices are processed. With maxThreads <= 1 or a single chunk
+ * everything runs inline. The calling thread claims chunks as well and only waits for helpers which already started, so busy
+ * or unavailable pool threads never block progress, including parallelFor called from a pool thread.
+ */
+template <typename FuncT>
+void parallelFor(size_t count, uint32_t maxThreads, size_t chunkSize, FuncT &&func) {
+    chunkSize = std::max(chunkSize, static_cast<size_t>(1u));
+    const size_t chunksCount = (count + chunkSize - 1) / chunkSize;
+    const size_t threadsCount = std::min(static_cast<size_t>(maxThreads), chunksCount);
+
+    if (threadsCount <= 1u) {
+        for (size_t index = 0u; index < count; index++) {
+            func(index);
+        }
+        return;
+    }
+
+    struct State {
+        std::atomic<size_t> nextChunk{0u};
+        std::mutex mtx;
+        std::condition_variable condVar;
+        uint32_t runningHelpers = 0u;
+        bool finished = false;
+    };
+    auto state = std::make_shared<State>();
+
+    auto processChunks = [&]() {
+        for (auto chunk = state->nextChunk.fetch_add(1u); chunk < chunksCount; chunk = state->nextChunk.fetch_add(1u)) {
+            const auto end = std::min(count, (chunk + 1) * chunkSize);
+            for (auto index = chunk * chunkSize; index < end; index++) {
+                func(index);
+            }
+        }
+    };
+
+    for (size_t i = 0u; i < threadsCount - 1; i++) {
+        // helper starting after the caller finished must not touch the caller's stack
+        auto submitted = getParallelForWorkerPool().submit([state, &processChunks]() {
+            {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                if (state->finished) {
+                    return;
+                }
+                state->runningHelpers++;
+            }
+            processChunks();
+            {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->runningHelpers--;
+            }
+            state->condVar.notify_all();
+        });
+        if (!submitted) {
+            break;
+        }
+    }
+    processChunks();
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->finished = true;
+    state->condVar.wait(lock, [&state]() { return state->runningHelpers == 0u; });
+}
+
+} // namespace NEO
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/size_class_heap_allocator.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/utilities/logger.h"
+
+#include <bit>
+
+namespace NEO {
+
+SizeClassHeapAllocator::SizeClassHeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold)
+    : HeapAllocator(address, size, allocationAlignment, threshold) {
+    // free ranges live in size classes, chunk lists of the default backend are never used
+    std::vector<HeapChunk>().swap(freedChunksBig);
+    std::vector<HeapChunk>().swap(freedChunksSmall);
+    for (auto &heads : sizeClassHeads) {
+        heads.fill(invalidRangeId);
+    }
+    if (size > 0u) {
+        insertFreeRange(address, size);
+    }
+}
+
+SizeClassHeapAllocator::SizeClass SizeClassHeapAllocator::getSizeClass(uint64_t size) {
+    DEBUG_BREAK_IF(size == 0u);
+    const auto firstLevel = static_cast<uint32_t>(std::bit_width(size) - 1);
+    uint64_t scaled = 0u;
+    if (firstLevel < secondLevelIndexBits) {
+        scaled = size << (secondLevelIndexBits - firstLevel);
+    } else {
+        scaled = size >> (firstLevel - secondLevelIndexBits);
+    }
+    return {firstLevel, static_cast<uint32_t>(scaled - secondLevelCount)};
+}
+
+bool SizeClassHeapAllocator::getSearchSizeClass(uint64_t size, SizeClass &sizeClass) {
+    const auto firstLevel = static_cast<uint32_t>(std::bit_width(size) - 1);
+    if (firstLevel >= secondLevelIndexBits) {
+        // round up to the next class boundary, so every range in the resulting class is large enough
+        const auto roundedSize = size + (1ull << (firstLevel - secondLevelIndexBits)) - 1;
+        if (roundedSize < size) {
+            return false;
+        }
+        size = roundedSize;
+    }
+    sizeClass = getSizeClass(size);
+    return true;
+}
+
+void SizeClassHeapAllocator::insertFreeRange(uint64_t start, uint64_t size) {
+    uint32_t rangeId = invalidRangeId;
+    if (unusedRangeIds.empty()) {
+        rangeId = static_cast<uint32_t>(ranges.size());
+        ranges.emplace_back();
+    } else {
+        rangeId = unusedRangeIds.back();
+        unusedRangeIds.pop_back();
+    }
+
+    const auto sizeClass = getSizeClass(size);
+    auto &head = sizeClassHeads[sizeClass.firstLevel][sizeClass.secondLevel];
+    ranges[rangeId] = {start, size, invalidRangeId, head};
+    if (head != invalidRangeId) {
+        ranges[head].previous = rangeId;
+    }
+    head = rangeId;
+    secondLevelBitmaps[sizeClass.firstLevel] |= (1u << sizeClass.secondLevel);
+    firstLevelBitmap |= (1ull << sizeClass.firstLevel);
+
+    rangeByStart[start] = rangeId;
+    rangeByEnd[start + size] = rangeId;
+}
+
+void SizeClassHeapAllocator::removeFreeRange(uint32_t rangeId) {
+    auto &range = ranges[rangeId];
+    const auto sizeClass = getSizeClass(range.size);
+    auto &head = sizeClassHeads[sizeClass.firstLevel][sizeClass.secondLevel];
+
+    if (range.previous != invalidRangeId) {
+        ranges[range.previous].next = range.next;
+    } else {
+        head = range.next;
+    }
+    if (range.next != invalidRangeId) {
+        ranges[range.next].previous = range.previous;
+    }
+    if (head == invalidRangeId) {
+        secondLevelBitmaps[sizeClass.firstLevel] &= ~(1u << sizeClass.secondLevel);
+        if (secondLevelBitmaps[sizeClass.firstLevel] == 0u) {
+            firstLevelBitmap &= ~(1ull << sizeClass.firstLevel);
+        }
+    }
+
+    rangeByStart.erase(range.start);
+    rangeByEnd.erase(range.start + range.size);
+    range = {};
+    unusedRangeIds.push_back(rangeId);
+}
+
+uint32_t SizeClassHeapAllocator::findFreeRange(uint64_t size) const {
+    SizeClass sizeClass = {};
+    if (!getSearchSizeClass(size, sizeClass)) {
+        return invalidRangeId;
+    }
+
+    auto firstLevel = sizeClass.firstLevel;
+    auto secondLevelMap = secondLevelBitmaps[firstLevel] & (~0u << sizeClass.secondLevel);
+    if (secondLevelMap == 0u) {
+        if (firstLevel + 1 >= firstLevelCount) {
+            return invalidRangeId;
+        }
+        const auto firstLevelMap = firstLevelBitmap & (~0ull << (firstLevel + 1));
+        if (firstLevelMap == 0u) {
+            return invalidRangeId;
+        }
+        firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+        secondLevelMap = secondLevelBitmaps[firstLevel];
+    }
+    return sizeClassHeads[firstLevel][std::countr_zero(secondLevelMap)];
+}
+
+bool SizeClassHeapAllocator::getPlacement(const FreeRange &range, uint64_t size, size_t alignment, uint64_t &start) const {
+    if (range.size < size) {
+        return false;
+    }
+    const auto end = range.start + range.size;
+    if (size > sizeThreshold) {
+        start = alignUp(range.start, alignment);
+        return start >= range.start && start + size <= end;
+    }
+    start = alignDown(end - size, alignment);
+    return start >= range.start;
+}
+
+uint32_t SizeClassHeapAllocator::findAlignedFreeRange(uint64_t size, size_t alignment, uint64_t &start) const {
+    auto rangeId = findFreeRange(size);
+    if (rangeId != invalidRangeId && getPlacement(ranges[rangeId], size, alignment, start)) {
+        return rangeId;
+    }
+
+    // any range of at least size + alignment - 1 can hold an aligned allocation
+    rangeId = findFreeRange(size + alignment - 1);
+    if (rangeId != invalidRangeId && getPlacement(ranges[rangeId], size, alignment, start)) {
+        return rangeId;
+    }
+
+    // ranges from the class of the requested size itself, or ones that happen to be suitably aligned, may still fit
+    const auto sizeClass = getSizeClass(size);
+    auto firstLevelMap = firstLevelBitmap & (~0ull << sizeClass.firstLevel);
+    while (firstLevelMap != 0u) {
+        const auto firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+        firstLevelMap &= firstLevelMap - 1;
+        auto secondLevelMap = secondLevelBitmaps[firstLevel];
+        if (firstLevel == sizeClass.firstLevel) {
+            secondLevelMap &= (~0u << sizeClass.secondLevel);
+        }
+        while (secondLevelMap != 0u) {
+            const auto secondLevel = static_cast<uint32_t>(std::countr_zero(secondLevelMap));
+            secondLevelMap &= secondLevelMap - 1;
+            for (auto id = sizeClassHeads[firstLevel][secondLevel]; id != invalidRangeId; id = ranges[id].next) {
+                if (getPlacement(ranges[id], size, alignment, start)) {
+                    return id;
+                }
+            }
+        }
+    }
+    return invalidRangeId;
+}
+
+uint32_t SizeClassHeapAllocator::findFreeRangeContaining(uint64_t start, uint64_t size) const {
+    // the only candidate is the last free range starting at or below start
+    auto it = rangeByStart.upper_bound(start);
+    if (it == rangeByStart.begin()) {
+        return invalidRangeId;
+    }
+    --it;
+    const auto rangeEnd = ranges[it->second].start + ranges[it->second].size;
+    if (start < rangeEnd && size <= rangeEnd - start) {
+        return it->second;
+    }
+    return invalidRangeId;
+}
+
+uint64_t SizeClassHeapAllocator::carve(uint32_t rangeId, uint64_t start, uint64_t size) {
+    const auto rangeStart = ranges[rangeId].start;
+    const auto rangeEnd = rangeStart + ranges[rangeId].size;
+    removeFreeRange(rangeId);
+
+    if (start > rangeStart) {
+        insertFreeRange(rangeStart, start - rangeStart);
+    }
+    if (rangeEnd > start + size) {
+        insertFreeRange(start + size, rangeEnd - (start + size));
+    }
+    return start;
+}
+
+uint64_t SizeClassHeapAllocator::allocateLocked(size_t size, size_t alignment) {
+    uint64_t start = 0llu;
+    auto rangeId = findAlignedFreeRange(size, alignment, start);
+    if (rangeId == invalidRangeId) {
+        return 0llu;
+    }
+    return carve(rangeId, start, size);
+}
+
+uint64_t SizeClassHeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
+    if (alignment < this->allocationAlignment) {
+        alignment = this->allocationAlignment;
+    }
+
+    UNRECOVERABLE_IF(alignment % allocationAlignment != 0); // custom alignment have to be a multiple of allocator alignment
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
+    if (sizeToAllocate == 0u || availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    auto ptr = allocateLocked(sizeToAllocate, alignment);
+    while (ptr == 0llu && alignment > 2 * MemoryConstants::megaByte) {
+        alignment >>= 1;
+        ptr = allocateLocked(sizeToAllocate, alignment);
+    }
+
+    if (ptr != 0llu) {
+        availableSize -= sizeToAllocate;
+    }
+    return ptr;
+}
+
+uint64_t SizeClassHeapAllocator::allocateWithCustomAlignmentWithStartAddressHint(const uint64_t requiredStartAddress, size_t &sizeToAllocate, size_t alignment) {
+    if (alignment < this->allocationAlignment) {
+        alignment = this->allocationAlignment;
+    }
+
+    UNRECOVERABLE_IF(alignment % allocationAlignment != 0); // custom alignment have to be a multiple of allocator alignment
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
+        if (sizeToAllocate == 0u || availableSize < sizeToAllocate) {
+            return 0llu;
+        }
+
+        if (requiredStartAddress != 0llu && isAligned(requiredStartAddress, alignment)) {
+            auto rangeId = findFreeRangeContaining(requiredStartAddress, sizeToAllocate);
+            if (rangeId != invalidRangeId) {
+                availableSize -= sizeToAllocate;
+                return carve(rangeId, requiredStartAddress, sizeToAllocate);
+            }
+        }
+    }
+
+    return allocateWithCustomAlignment(sizeToAllocate, alignment);
+}
+
+void SizeClassHeapAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
+
+    auto start = ptr;
+    auto end = ptr + size;
+
+    auto leftNeighbour = rangeByEnd.find(start);
+    if (leftNeighbour != rangeByEnd.end()) {
+        const auto rangeId = leftNeighbour->second;
+        start = ranges[rangeId].start;
+        removeFreeRange(rangeId);
+    }
+
+    auto rightNeighbour = rangeByStart.find(end);
+    if (rightNeighbour != rangeByStart.end()) {
+        const auto rangeId = rightNeighbour->second;
+        end = ranges[rangeId].start + ranges[rangeId].size;
+        removeFreeRange(rangeId);
+    }
+
+    insertFreeRange(start, end - start);
+    availableSize += size;
+}
+
+} // namespace NEO
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+/*
+ * HeapAllocator backend keeping free ranges in two-level segregated size classes (TLSF style).
+ * First level is the power of two of the range size, second level splits it into linear sub-ranges;
+ * per-level bitmaps make finding a fitting class O(1). Neighbouring free ranges are found through
+ * start/end address maps, so coalescing on free needs no defragmentation pass; the start map is ordered
+ * so the range containing a hinted address is found in O(log n).
+ * Allocations above sizeThreshold are carved from the low end of a free range and the remaining ones
+ * from the high end, matching the placement of the default backend.
+ */
+class SizeClassHeapAllocator : public HeapAllocator {
+  public:
+    SizeClassHeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold);
+    SizeClassHeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : SizeClassHeapAllocator(address, size, allocationAlignment, defaultSizeThreshold) {}
+
+    uint64_t allocateWithCustomAlignmentWithStartAddressHint(const uint64_t requiredStartAddress, size_t &sizeToAllocate, size_t alignment) override;
+    uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) override;
+    void free(uint64_t ptr, size_t size) override;
+
+    size_t getFreeRangesCount() const { return rangeByStart.size(); }
+
+    static constexpr uint32_t secondLevelIndexBits = 4u;
+    static constexpr uint32_t secondLevelCount = 1u << secondLevelIndexBits;
+    static constexpr uint32_t firstLevelCount = 64u;
+
+  protected:
+    static constexpr uint32_t invalidRangeId = std::numeric_limits<uint32_t>::max();
+
+    struct FreeRange {
+        uint64_t start = 0u;
+        uint64_t size = 0u;
+        uint32_t previous = invalidRangeId;
+        uint32_t next = invalidRangeId;
+    };
+
+    struct SizeClass {
+        uint32_t firstLevel;
+        uint32_t secondLevel;
+    };
+
+    static SizeClass getSizeClass(uint64_t size);
+    static bool getSearchSizeClass(uint64_t size, SizeClass &sizeClass);
+
+    uint64_t allocateLocked(size_t size, size_t alignment);
+    uint64_t carve(uint32_t rangeId, uint64_t start, uint64_t size);
+    bool getPlacement(const FreeRange &range, uint64_t size, size_t alignment, uint64_t &start) const;
+    uint32_t findFreeRange(uint64_t size) const;
+    uint32_t findAlignedFreeRange(uint64_t size, size_t alignment, uint64_t &start) const;
+    uint32_t findFreeRangeContaining(uint64_t start, uint64_t size) const;
+
+    void insertFreeRange(uint64_t start, uint64_t size);
+    void removeFreeRange(uint32_t rangeId);
+
+    std::vector<FreeRange> ranges;
+    std::vector<uint32_t> unusedRangeIds;
+    std::map<uint64_t, uint32_t> rangeByStart;
+    std::unordered_map<uint64_t, uint32_t> rangeByEnd;
+
+    uint64_t firstLevelBitmap = 0u;
+    std::array<uint32_t, firstLevelCount> secondLevelBitmaps = {};
+    std::array<std::array<uint32_t, secondLevelCount>, firstLevelCount> sizeClassHeads;
+};
+
+} // namespace NEO
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+/*
+ * Lock-free byte ring for exactly one producer thread and one consumer thread.
+ * Both sides work on contiguous spans of the ring memory, so data can be written by the producer (e.g. by read() from a fd)
+ * and consumed without any intermediate staging copy. Capacity is rounded up to a power of two.
+ */
+class SpscRingBuffer : NEO::NonCopyableAndNonMovableClass {
+  public:
+    explicit SpscRingBuffer(size_t requestedCapacity)
+        : capacity(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(std::max<size_t>(requestedCapacity, 1u))))),
+          storage(std::make_unique<uint8_t[]>(capacity)) {}
+
+    size_t getCapacity() const { return capacity; }
+
+    size_t getUsedSize() const {
+        return writePosition.load(std::memory_order_acquire) - readPosition.load(std::memory_order_acquire);
+    }
+
+    // Producer side: largest contiguous free span, which is valid until commitWrite().
+    size_t getWritableSpan(uint8_t *&span) {
+        const size_t write = writePosition.load(std::memory_order_relaxed);
+        const size_t read = readPosition.load(std::memory_order_acquire);
+        const size_t offset = write & (capacity - 1);
+        span = storage.get() + offset;
+        return std::min(capacity - (write - read), capacity - offset);
+    }
+
+    void commitWrite(size_t size) {
+        DEBUG_BREAK_IF(size > capacity - getUsedSize());
+        writePosition.store(writePosition.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    // Consumer side: largest contiguous filled span, which is valid until commitRead().
+    size_t getReadableSpan(const uint8_t *&span) {
+        const size_t read = readPosition.load(std::memory_order_relaxed);
+        const size_t write = writePosition.load(std::memory_order_acquire);
+        const size_t offset = read & (capacity - 1);
+        span = storage.get() + offset;
+        return std::min(write - read, capacity - offset);
+    }
+
+    void commitRead(size_t size) {
+        DEBUG_BREAK_IF(size > getUsedSize());
+        readPosition.store(readPosition.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+  protected:
+    const size_t capacity;
+    std::unique_ptr<uint8_t[]> storage;
+    alignas(MemoryConstants::cacheLineSize) std::atomic<size_t> writePosition{0};
+    alignas(MemoryConstants::cacheLineSize) std::atomic<size_t> readPosition{0};
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<SpscRingBuffer>);
+
+} // namespace NEO
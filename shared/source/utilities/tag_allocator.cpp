@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2025 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,12 @@ void TagAllocatorBase::cleanUpResources() {
     gfxAllocations.clear();
 }
 
+uint32_t TagAllocatorBase::getCurrentThreadTagCacheSlot() {
+    static std::atomic<uint32_t> threadsCount{0};
+    thread_local const uint32_t slot = threadsCount.fetch_add(1, std::memory_order_relaxed) % threadTagCachesCount;
+    return slot;
+}
+
 MultiGraphicsAllocation *TagNodeBase::getBaseGraphicsAllocation() const {
     return gfxAllocation;
 }
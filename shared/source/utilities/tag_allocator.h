@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
@@ -100,6 +101,10 @@ class TagNodeBase : public NonCopyableAndNonMovableClass {
     bool doNotReleaseNodes = false;
     bool profilingCapable = true;
 
+    // position in lock-free free list, 0 is reserved for end of list
+    uint32_t freeListIndex = 0;
+    std::atomic<uint32_t> freeListNext{0};
+
     template <typename TagType>
     friend class TagAllocator;
 };
@@ -185,6 +190,12 @@ class TagAllocatorBase {
 
     void cleanUpResources();
 
+    static uint32_t getCurrentThreadTagCacheSlot();
+
+    static constexpr uint32_t threadTagCachesCount = 16;
+    static constexpr uint32_t threadTagCacheSize = 16;
+    static constexpr uint32_t maxLockFreeTagPools = 1024;
+
     std::vector<std::unique_ptr<MultiGraphicsAllocation>> gfxAllocations;
     const DeviceBitfield deviceBitfield;
     RootDeviceIndicesContainer rootDeviceIndices;
@@ -193,6 +204,7 @@ class TagAllocatorBase {
     const uint32_t tagCount;
     const uint32_t tagSize;
     bool doNotReleaseNodes = false;
+    bool lockFreeFreeList = false;
 
     TagNodeUpdateCallback tagNodeUpdateCallback;
     TagPoolCreatedCallback tagPoolCreatedCallback;
@@ -225,10 +237,31 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    NodeType *getFreeTagLockFree();
+    void returnFreeTagLockFree(NodeType *node);
+    void flushThreadTagCaches();
+
+    NodeType *getNodeByFreeListIndex(uint32_t freeListIndex) const;
+    void pushFreeNodes(NodeType &first, NodeType &last);
+    void pushFreeNodeList(NodeType &nodes);
+    uint32_t popFreeNodes(NodeType **nodes, uint32_t maxCount);
+
+    struct alignas(MemoryConstants::cacheLineSize) ThreadTagCache {
+        std::atomic_flag inUse;
+        uint32_t count = 0;
+        NodeType *nodes[threadTagCacheSize];
+    };
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
+    // used instead of freeTags and usedTags when lockFreeFreeList is set,
+    // head packs ABA counter in upper and freeListIndex in lower 32 bits
+    std::atomic<uint64_t> freeTagsHead{0};
+    std::unique_ptr<ThreadTagCache[]> threadTagCaches;
+    std::unique_ptr<NodeType *[]> lockFreeTagPools;
+
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
 
     const ValueT initialValue;
@@ -36,21 +36,32 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
                                     size_t tagSize, ValueT initialValue, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), initialValue(initialValue), initializeTags(initializeTags) {
 
+    if (debugManager.flags.EnableLockFreeTagAllocator.get() == 1) {
+        lockFreeFreeList = true;
+        threadTagCaches = std::make_unique<ThreadTagCache[]>(threadTagCachesCount);
+        lockFreeTagPools = std::make_unique<NodeType *[]>(maxLockFreeTagPools);
+    }
+
     populateFreeTags();
 }
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
-    if (freeTags.peekIsEmpty()) {
-        releaseDeferredTags();
-    }
-    auto node = freeTags.removeFrontOne().release();
-    if (!node) {
-        std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
+    NodeType *node = nullptr;
+    if (lockFreeFreeList) {
+        node = getFreeTagLockFree();
+    } else {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
         node = freeTags.removeFrontOne().release();
+        if (!node) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            populateFreeTags();
+            node = freeTags.removeFrontOne().release();
+        }
+        usedTags.pushFrontOne(*node);
     }
-    usedTags.pushFrontOne(*node);
     node->incRefCount();
 
     if (initializeTags) {
@@ -66,21 +77,29 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
 
     PRINT_STRING(debugManager.flags.PrintTimestampPacketUsage.get() == 1, stdout,
                  "\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
 
+    if (lockFreeFreeList) {
+        returnFreeTagLockFree(nodeT);
+        return;
+    }
+
+    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+    DEBUG_BREAK_IF(usedNode == nullptr);
+
     freeTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    if (!lockFreeFreeList) {
+        [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+        DEBUG_BREAK_IF(!usedNode);
+    }
+    deferredTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
@@ -102,7 +121,11 @@ void TagAllocator<TagType>::releaseDeferredTags() {
     }
 
     if (!pendingFreeTags.peekIsEmpty()) {
-        freeTags.splice(*pendingFreeTags.detachNodes());
+        if (lockFreeFreeList) {
+            pushFreeNodeList(*pendingFreeTags.detachNodes());
+        } else {
+            freeTags.splice(*pendingFreeTags.detachNodes());
+        }
     }
     if (!pendingDeferredTags.peekIsEmpty()) {
         deferredTags.splice(*pendingDeferredTags.detachNodes());
@@ -138,6 +161,11 @@ void TagAllocator<TagType>::populateFreeTags() {
     notifyTagPoolCreated(*multiGraphicsAllocation);
 
     auto nodesMemory = std::make_unique_for_overwrite<NodeType[]>(tagCount);
+    const auto poolIndex = static_cast<uint32_t>(tagPoolMemory.size());
+    if (lockFreeFreeList) {
+        UNRECOVERABLE_IF(poolIndex >= maxLockFreeTagPools);
+        lockFreeTagPools[poolIndex] = nodesMemory.get();
+    }
 
     for (size_t i = 0; i < tagCount; ++i) {
         auto tagOffset = i * tagSize;
@@ -148,12 +176,135 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].gpuAddress = baseGpuAddress + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
 
-        freeTags.pushTailOne(nodesMemory[i]);
+        if (lockFreeFreeList) {
+            nodesMemory[i].freeListIndex = poolIndex * tagCount + static_cast<uint32_t>(i) + 1;
+            nodesMemory[i].freeListNext.store(i + 1 < tagCount ? nodesMemory[i].freeListIndex + 1 : 0u, std::memory_order_release);
+        } else {
+            freeTags.pushTailOne(nodesMemory[i]);
+        }
+    }
+
+    if (lockFreeFreeList) {
+        pushFreeNodes(nodesMemory[0], nodesMemory[tagCount - 1]);
     }
 
     tagPoolMemory.push_back(std::move(nodesMemory));
 }
 
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getFreeTagLockFree() {
+    NodeType *node = nullptr;
+
+    auto &cache = threadTagCaches[getCurrentThreadTagCacheSlot()];
+    if (!cache.inUse.test_and_set(std::memory_order_acquire)) {
+        if (cache.count == 0) {
+            cache.count = popFreeNodes(cache.nodes, threadTagCacheSize / 2);
+        }
+        if (cache.count > 0) {
+            node = cache.nodes[--cache.count];
+        }
+        cache.inUse.clear(std::memory_order_release);
+    } else {
+        popFreeNodes(&node, 1);
+    }
+
+    if (!node) {
+        releaseDeferredTags();
+        popFreeNodes(&node, 1);
+    }
+
+    if (!node) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        flushThreadTagCaches();
+        while (popFreeNodes(&node, 1) == 0) {
+            populateFreeTags();
+        }
+    }
+    return node;
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::returnFreeTagLockFree(NodeType *node) {
+    auto &cache = threadTagCaches[getCurrentThreadTagCacheSlot()];
+    if (cache.inUse.test_and_set(std::memory_order_acquire)) {
+        pushFreeNodes(*node, *node);
+        return;
+    }
+
+    if (cache.count == threadTagCacheSize) {
+        constexpr uint32_t keptCount = threadTagCacheSize / 2;
+        for (uint32_t i = keptCount; i < threadTagCacheSize - 1; i++) {
+            cache.nodes[i]->freeListNext.store(cache.nodes[i + 1]->freeListIndex, std::memory_order_release);
+        }
+        pushFreeNodes(*cache.nodes[keptCount], *cache.nodes[threadTagCacheSize - 1]);
+        cache.count = keptCount;
+    }
+    cache.nodes[cache.count++] = node;
+    cache.inUse.clear(std::memory_order_release);
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::flushThreadTagCaches() {
+    for (uint32_t slot = 0; slot < threadTagCachesCount; slot++) {
+        auto &cache = threadTagCaches[slot];
+        if (cache.inUse.test_and_set(std::memory_order_acquire)) {
+            continue;
+        }
+        for (uint32_t i = 0; i < cache.count; i++) {
+            pushFreeNodes(*cache.nodes[i], *cache.nodes[i]);
+        }
+        cache.count = 0;
+        cache.inUse.clear(std::memory_order_release);
+    }
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getNodeByFreeListIndex(uint32_t freeListIndex) const {
+    return &lockFreeTagPools[(freeListIndex - 1) / tagCount][(freeListIndex - 1) % tagCount];
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::pushFreeNodes(NodeType &first, NodeType &last) {
+    auto head = freeTagsHead.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+    do {
+        last.freeListNext.store(static_cast<uint32_t>(head), std::memory_order_release);
+        newHead = ((head >> 32) + 1) << 32 | first.freeListIndex;
+    } while (!freeTagsHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::pushFreeNodeList(NodeType &nodes) {
+    auto last = &nodes;
+    while (last->next != nullptr) {
+        last->freeListNext.store(last->next->freeListIndex, std::memory_order_release);
+        last = last->next;
+    }
+    pushFreeNodes(nodes, *last);
+}
+
+template <typename TagType>
+uint32_t TagAllocator<TagType>::popFreeNodes(NodeType **nodes, uint32_t maxCount) {
+    auto head = freeTagsHead.load(std::memory_order_acquire);
+    while (true) {
+        // every push and pop bumps the counter, so an unchanged head means the walked links are still valid
+        auto freeListIndex = static_cast<uint32_t>(head);
+        uint32_t count = 0;
+        while (freeListIndex != 0 && count < maxCount) {
+            nodes[count] = getNodeByFreeListIndex(freeListIndex);
+            freeListIndex = nodes[count]->freeListNext.load(std::memory_order_acquire);
+            count++;
+        }
+        if (count == 0) {
+            return 0;
+        }
+        const uint64_t newHead = ((head >> 32) + 1) << 32 | freeListIndex;
+        if (freeTagsHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            return count;
+        }
+    }
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTag(TagNodeBase *node) {
     if (node->refCountFetchSub(1) == 1) {
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+#include <system_error>
+
+namespace NEO {
+
+WorkerPool::WorkerPool(uint32_t maxWorkers) : maxWorkers(std::max(maxWorkers, 1u)) {}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    condVar.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+bool WorkerPool::submit(Task &&task) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        tasks.push_back(std::move(task));
+        if (tasks.size() > idleWorkers && workers.size() < maxWorkers) {
+            try {
+                startWorker();
+            } catch (const std::system_error &) {
+                // running workers still pick the task up, without any it would never run
+                if (workers.empty()) {
+                    tasks.pop_back();
+                    return false;
+                }
+            }
+        }
+    }
+    condVar.notify_one();
+    return true;
+}
+
+void WorkerPool::startWorker() {
+    workers.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+size_t WorkerPool::getWorkersCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+}
+
+void WorkerPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        idleWorkers++;
+        condVar.wait(lock, [this] { return stopping || !tasks.empty(); });
+        idleWorkers--;
+        if (tasks.empty()) {
+            return;
+        }
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+} // namespace NEO
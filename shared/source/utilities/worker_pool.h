@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+/*
+ * Runs submitted tasks on up to maxWorkers threads. Threads are started on demand, when no idle worker can take a new task.
+ * submit returns false and drops the task when no worker exists and none can be started, the caller then runs it itself.
+ * Destruction waits until every submitted task has finished.
+ */
+class WorkerPool : NEO::NonCopyableAndNonMovableClass {
+  public:
+    using Task = std::function<void()>;
+
+    explicit WorkerPool(uint32_t maxWorkers);
+    MOCKABLE_VIRTUAL ~WorkerPool();
+
+    bool submit(Task &&task);
+    size_t getWorkersCount();
+
+  protected:
+    void workerLoop();
+    MOCKABLE_VIRTUAL void startWorker();
+
+    std::mutex mtx;
+    std::condition_variable condVar;
+    std::deque<Task> tasks;
+    std::vector<std::thread> workers;
+    const uint32_t maxWorkers;
+    uint32_t idleWorkers = 0;
+    bool stopping = false;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<WorkerPool>);
+
+} // namespace NEO
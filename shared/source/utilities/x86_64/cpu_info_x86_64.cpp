@@ -47,6 +47,7 @@ void CpuInfo::detect() const {
 
                 constexpr uint64_t avx2CpuMask = BIT(5) | BIT(3) | BIT(8);
                 constexpr uint64_t avx512CpuMask = BIT(16);
+                constexpr uint64_t avx512BwCpuMask = BIT(16) | BIT(30);
 
                 constexpr uint64_t avx2OsMask = BIT(1) | BIT(2);
                 constexpr uint64_t avx512OsMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
@@ -58,6 +59,10 @@ void CpuInfo::detect() const {
                 if (((cpuInfo[ebx] & avx512CpuMask) == avx512CpuMask) && ((xcr0 & avx512OsMask) == avx512OsMask)) {
                     features |= featureAvX512;
                 }
+
+                if (((cpuInfo[ebx] & avx512BwCpuMask) == avx512BwCpuMask) && ((xcr0 & avx512OsMask) == avx512OsMask)) {
+                    features |= featureAvX512BW;
+                }
             }
         }
     }
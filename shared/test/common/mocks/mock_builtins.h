@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 namespace NEO {
 class MockBuiltins : public BuiltIns {
   public:
+    using BuiltIns::builtinsLib;
     using BuiltIns::perContextSipKernels;
     using BuiltIns::sipKernels;
 
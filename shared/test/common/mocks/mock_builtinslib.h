@@ -8,6 +8,11 @@
 #pragma once
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/built_ins/built_ins_binary_cache.h"
+
+#include <map>
+#include <string>
+#include <vector>
 
 using namespace NEO;
 class MockBuiltInResourceLoader : BuiltIn::ResourceLoader {
@@ -16,3 +21,45 @@ class MockBuiltInResourceLoader : BuiltIn::ResourceLoader {
     using BuiltIn::ResourceLoader::getBuiltinCode;
     using BuiltIn::ResourceLoader::getBuiltinResource;
 };
+
+class MockBuiltInsBinaryCache : public BuiltIn::BinaryCache {
+  public:
+    BuiltIn::Resource load(const std::string &entryName) override {
+        loadCalled++;
+        auto entry = entries.find(entryName);
+        if (entry == entries.end()) {
+            return {};
+        }
+        return BuiltIn::createResource(entry->second.data(), entry->second.size(), true);
+    }
+
+    bool store(const std::string &entryName, ArrayRef<const char> data) override {
+        storeCalled++;
+        entries[entryName].assign(data.begin(), data.end());
+        return true;
+    }
+
+    std::map<std::string, std::vector<char>> entries;
+    uint32_t loadCalled = 0u;
+    uint32_t storeCalled = 0u;
+};
+
+class MockBuiltInResourceLoaderWithBinaryCache : public BuiltIn::ResourceLoader {
+  public:
+    MockBuiltInResourceLoaderWithBinaryCache() : binaryCacheToCreate(std::make_unique<MockBuiltInsBinaryCache>()) {
+        binaryCacheMock = binaryCacheToCreate.get();
+    }
+
+    std::unique_ptr<BuiltIn::BinaryCache> createBinaryCache(const Device &device) override {
+        createBinaryCacheCalled++;
+        if (callBaseCreateBinaryCache) {
+            return BuiltIn::ResourceLoader::createBinaryCache(device);
+        }
+        return std::move(binaryCacheToCreate);
+    }
+
+    std::unique_ptr<MockBuiltInsBinaryCache> binaryCacheToCreate;
+    MockBuiltInsBinaryCache *binaryCacheMock = nullptr;
+    uint32_t createBinaryCacheCalled = 0u;
+    bool callBaseCreateBinaryCache = false;
+};
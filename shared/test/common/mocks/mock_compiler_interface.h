@@ -185,6 +185,14 @@ class MockCompilerInterface : public CompilerInterface {
         return CompilerInterface::getSpirvExtensionsYAML(device);
     }
 
+    bool getCompilerIdentityHash(const NEO::Device &device, uint64_t &identityHash) override {
+        if (compilerIdentityHashOverride.has_value()) {
+            identityHash = *compilerIdentityHashOverride;
+            return true;
+        }
+        return CompilerInterface::getCompilerIdentityHash(device, identityHash);
+    }
+
     static std::vector<char> getDummyGenBinary();
     static void releaseDummyGenBinary();
 
@@ -213,6 +221,8 @@ class MockCompilerInterface : public CompilerInterface {
     // golden fixture for the success path, or "" to exercise legacy fallback).
     std::optional<std::string> spirvExtensionsYAMLOverride;
     uint32_t getSpirvExtensionsYAMLCalled = 0;
+
+    std::optional<uint64_t> compilerIdentityHashOverride;
 };
 
 template <>
@@ -20,6 +20,7 @@ class MockPageFaultManagerImpl : public BaseFaultManager {
     using BaseFaultManager::BaseFaultManager;
     using BaseFaultManager::gpuDomainHandler;
     using BaseFaultManager::memoryData;
+    using BaseFaultManager::memoryDataRanges;
     using PageFaultData = typename BaseFaultManager::PageFaultData;
     using BaseFaultManager::hostFunctionActive;
     using BaseFaultManager::hostFunctionAllocationsToMigrate;
@@ -57,6 +58,12 @@ class MockPageFaultManagerImpl : public BaseFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferChunkToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        chunksTransferredToCpu.emplace_back(offset, size);
+    }
+    void transferChunkToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        chunksTransferredToGpu.emplace_back(offset, size);
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -76,6 +83,9 @@ class MockPageFaultManagerImpl : public BaseFaultManager {
     void baseGpuTransfer(void *ptr, void *cmdQ) {
         BaseFaultManager::transferToGpu(ptr, cmdQ);
     }
+    void baseChunkGpuTransfer(void *ptr, size_t offset, size_t size, void *cmdQ) {
+        BaseFaultManager::transferChunkToGpu(ptr, offset, size, cmdQ);
+    }
     void baseCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
         BaseFaultManager::setCpuAllocEvictable(evictable, ptr, unifiedMemoryManager);
     }
@@ -119,6 +129,8 @@ class MockPageFaultManagerImpl : public BaseFaultManager {
     size_t transferToCpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
+    std::vector<std::pair<size_t, size_t>> chunksTransferredToCpu;
+    std::vector<std::pair<size_t, size_t>> chunksTransferredToGpu;
     bool isAubWritable = true;
     bool isCpuAllocEvictable = true;
     bool isFaultHandlerFromPageFaultManager = false;
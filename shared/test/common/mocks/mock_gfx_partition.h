@@ -27,6 +27,10 @@ class MockGfxPartition : public GfxPartition {
         return getHeapSize(heapIndex) > 0;
     }
 
+    bool isSizeClassAllocatorUsed(HeapIndex heapIndex) {
+        return getHeap(heapIndex).isSizeClassAllocatorUsed();
+    }
+
     void *getReservedCpuAddressRange() {
         return reservedCpuAddressRange.alignedPtr;
     }
@@ -21,6 +21,7 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::initUsmSharedAllocationsCache;
     using SVMAllocsManager::insertSVMAlloc;
     using SVMAllocsManager::internalAllocationsMap;
+    using SVMAllocsManager::lookupIndex;
     using SVMAllocsManager::memoryManager;
     using SVMAllocsManager::mtxForIndirectAccess;
     using SVMAllocsManager::svmAllocs;
@@ -127,6 +127,7 @@ struct dirent *(*sysCallsReaddir)(DIR *dir) = nullptr;
 int (*sysCallsClosedir)(DIR *dir) = nullptr;
 int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize) = nullptr;
 int (*sysCallsPidfdOpen)(pid_t pid, unsigned int flags) = nullptr;
+void *(*sysCallsMmap)(void *addr, size_t size, int prot, int flags, int fd, off_t off) = nullptr;
 int (*sysCallsPidfdGetfd)(int pidfd, int fd, unsigned int flags) = nullptr;
 int (*sysCallsPrctl)(int option, unsigned long arg) = nullptr;
 off_t (*sysCallsLseek)(int fd, off_t offset, int whence) = nullptr;
@@ -377,6 +378,9 @@ ssize_t pwrite(int fd, const void *buf, size_t count, off_t offset) {
 
 void *mmap(void *addr, size_t size, int prot, int flags, int fd, off_t off) noexcept {
     mmapFuncCalled++;
+    if (sysCallsMmap != nullptr) {
+        return sysCallsMmap(addr, size, prot, flags, fd, off);
+    }
     if (failMmap) {
         return reinterpret_cast<void *>(-1);
     }
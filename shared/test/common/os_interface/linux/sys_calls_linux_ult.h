@@ -58,6 +58,7 @@ extern int (*sysCallsClosedir)(DIR *dir);
 extern int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize);
 extern int (*sysCallsClose)(int fileDescriptor);
 extern int (*sysCallsPidfdOpen)(pid_t pid, unsigned int flags);
+extern void *(*sysCallsMmap)(void *addr, size_t size, int prot, int flags, int fd, off_t off);
 extern int (*sysCallsPidfdGetfd)(int pidfd, int fd, unsigned int flags);
 extern int (*sysCallsPrctl)(int option, unsigned long arg);
 extern off_t (*sysCallsLseek)(int fd, off_t offset, int whence);
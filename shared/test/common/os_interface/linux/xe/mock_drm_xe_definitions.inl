@@ -197,8 +197,8 @@ int DrmMockXe::ioctl(DrmIoctl request, void *arg) {
             }
         }
 
-        if (vmBindInput->num_syncs == 1) {
-            auto &syncInput = reinterpret_cast<drm_xe_sync *>(vmBindInput->syncs)[0];
+        for (uint32_t i = 0; i < vmBindInput->num_syncs; i++) {
+            auto &syncInput = reinterpret_cast<drm_xe_sync *>(vmBindInput->syncs)[i];
             syncInputs.push_back(syncInput);
         }
     } break;
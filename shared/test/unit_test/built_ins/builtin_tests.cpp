@@ -14,6 +14,7 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_builtinslib.h"
+#include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_compiler_product_helper.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
@@ -443,3 +444,116 @@ TEST_F(BuiltInSharedTest, GivenRequestedTypeSourceWhenGettingWideStatelessBuilti
     EXPECT_EQ(resourceNames[0], expectedResourceNameForRelease);
     EXPECT_EQ(resourceNames[1], expectedResourceNameGeneric);
 }
+
+TEST_F(BuiltInSharedTest, givenPersistentBuiltInsCacheNotEnabledWhenGettingBinaryCacheThenNullptrIsReturned) {
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    resourceLoader.callBaseCreateBinaryCache = true;
+
+    EXPECT_EQ(nullptr, resourceLoader.getBinaryCache(*pDevice));
+    EXPECT_EQ(nullptr, resourceLoader.getBinaryCache(*pDevice));
+    EXPECT_EQ(1u, resourceLoader.createBinaryCacheCalled);
+
+    auto code = resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, {}, {});
+    EXPECT_TRUE(code.resource.empty());
+    EXPECT_EQ(BuiltIn::CodeType::invalid, code.type);
+}
+
+TEST_F(BuiltInSharedTest, givenPersistentBuiltInsCacheEnabledAndDebuggingOrRebuildRequestedWhenCreatingBinaryCacheThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnablePersistentBuiltInsCache.set(1);
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    resourceLoader.callBaseCreateBinaryCache = true;
+
+    debugManager.flags.RebuildPrecompiledKernels.set(true);
+    EXPECT_EQ(nullptr, resourceLoader.createBinaryCache(*pDevice));
+
+    debugManager.flags.RebuildPrecompiledKernels.set(false);
+    pDevice->getExecutionEnvironment()->setDebuggingMode(DebuggingMode::online);
+    EXPECT_EQ(nullptr, resourceLoader.createBinaryCache(*pDevice));
+    pDevice->getExecutionEnvironment()->setDebuggingMode(DebuggingMode::disabled);
+}
+
+TEST_F(BuiltInSharedTest, givenBinaryCacheWhenBuiltinBinaryIsCachedThenItIsReturnedAsBinaryCodeForSameKernelAndMode) {
+    auto mockCompilerInterface = new MockCompilerInterface();
+    mockCompilerInterface->compilerIdentityHashOverride = 0x1234u;
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->compilerInterface.reset(mockCompilerInterface);
+
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    auto binaryCache = resourceLoader.binaryCacheMock;
+    const char apiOptions[] = "-api-option";
+    const char internalOptions[] = "-internal-option";
+
+    auto code = resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions);
+    EXPECT_TRUE(code.resource.empty());
+    EXPECT_EQ(1u, binaryCache->loadCalled);
+
+    const char binary[] = "fill buffer binary";
+    resourceLoader.cacheBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions, binary);
+    EXPECT_EQ(1u, binaryCache->storeCalled);
+    auto entryName = resourceLoader.getBinaryCacheEntryName(BuiltIn::bindfulImageStatelessBuffer.toString() + "fill_buffer.builtin_kernel", *pDevice, apiOptions, internalOptions);
+    EXPECT_FALSE(entryName.empty());
+    EXPECT_EQ(1u, binaryCache->entries.count(entryName));
+
+    code = resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions);
+    EXPECT_EQ(BuiltIn::CodeType::binary, code.type);
+    EXPECT_EQ(pDevice, code.targetDevice);
+    ASSERT_EQ(sizeof(binary), code.resource.size);
+    EXPECT_EQ(0, memcmp(binary, code.resource.data, sizeof(binary)));
+
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindlessImageBindlessBuffer, *pDevice, apiOptions, internalOptions).resource.empty());
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::copyBufferToBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions).resource.empty());
+    EXPECT_EQ(1u, resourceLoader.createBinaryCacheCalled);
+}
+
+TEST_F(BuiltInSharedTest, givenDevicesWithDifferentIpVersionsWhenGettingBinaryCacheThenSeparateCacheIsCreatedPerIpVersion) {
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    auto &hwInfo = *pDevice->getRootDeviceEnvironment().getMutableHardwareInfo();
+
+    EXPECT_EQ(resourceLoader.binaryCacheMock, resourceLoader.getBinaryCache(*pDevice));
+    EXPECT_EQ(1u, resourceLoader.createBinaryCacheCalled);
+
+    {
+        VariableBackup<uint32_t> ipVersionBackup(&hwInfo.ipVersion.value, hwInfo.ipVersion.value + 1);
+        EXPECT_EQ(nullptr, resourceLoader.getBinaryCache(*pDevice));
+        EXPECT_EQ(nullptr, resourceLoader.getBinaryCache(*pDevice));
+        EXPECT_EQ(2u, resourceLoader.createBinaryCacheCalled);
+    }
+
+    EXPECT_EQ(resourceLoader.binaryCacheMock, resourceLoader.getBinaryCache(*pDevice));
+    EXPECT_EQ(2u, resourceLoader.createBinaryCacheCalled);
+}
+
+TEST_F(BuiltInSharedTest, givenCachedBuiltinBinaryWhenCompilerIdentityOrBuildOptionsDifferThenCacheIsMissed) {
+    auto mockCompilerInterface = new MockCompilerInterface();
+    mockCompilerInterface->compilerIdentityHashOverride = 0x1234u;
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->compilerInterface.reset(mockCompilerInterface);
+
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    const char apiOptions[] = "-api-option";
+    const char internalOptions[] = "-internal-option";
+    const char otherOptions[] = "-other-option";
+    const char binary[] = "fill buffer binary";
+    resourceLoader.cacheBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions, binary);
+    EXPECT_EQ(1u, resourceLoader.binaryCacheMock->storeCalled);
+
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, otherOptions, internalOptions).resource.empty());
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, otherOptions).resource.empty());
+
+    mockCompilerInterface->compilerIdentityHashOverride = 0x5678u;
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions).resource.empty());
+
+    mockCompilerInterface->compilerIdentityHashOverride = 0x1234u;
+    EXPECT_FALSE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, apiOptions, internalOptions).resource.empty());
+}
+
+TEST_F(BuiltInSharedTest, givenNoCompilerInterfaceWhenUsingBuiltinBinaryCacheThenCacheIsNotAccessed) {
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->compilerInterface.reset(new MockCompilerInterface());
+
+    MockBuiltInResourceLoaderWithBinaryCache resourceLoader;
+    const char binary[] = "fill buffer binary";
+    resourceLoader.cacheBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, {}, {}, binary);
+    EXPECT_EQ(0u, resourceLoader.binaryCacheMock->storeCalled);
+
+    EXPECT_TRUE(resourceLoader.getCachedBuiltinBinary(BuiltIn::BaseKernel::fillBuffer, BuiltIn::bindfulImageStatelessBuffer, *pDevice, {}, {}).resource.empty());
+    EXPECT_EQ(0u, resourceLoader.binaryCacheMock->loadCalled);
+}
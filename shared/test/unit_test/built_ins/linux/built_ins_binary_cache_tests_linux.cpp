@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/linux/built_ins_binary_cache_linux.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace BinaryCacheFiles {
+std::map<std::string, std::vector<char>> files;
+std::map<int, std::string> openedFiles;
+int nextFd = 200;
+
+int openFile(const std::string &path) {
+    openedFiles[nextFd] = path;
+    return nextFd++;
+}
+
+int mockOpen(const char *path, int flags) {
+    if (files.find(path) == files.end()) {
+        return -1;
+    }
+    return openFile(path);
+}
+
+int mockMkstemp(char *path) {
+    files[path].clear();
+    return openFile(path);
+}
+
+int mockClose(int fd) {
+    openedFiles.erase(fd);
+    return 0;
+}
+
+ssize_t mockPwrite(int fd, const void *buf, size_t count, off_t offset) {
+    auto &file = files[openedFiles[fd]];
+    if (file.size() < static_cast<size_t>(offset) + count) {
+        file.resize(static_cast<size_t>(offset) + count);
+    }
+    memcpy(file.data() + offset, buf, count);
+    return count;
+}
+
+int mockFstat(int fd, struct stat *buf) {
+    buf->st_size = static_cast<off_t>(files[openedFiles[fd]].size());
+    return 0;
+}
+
+void *mockMmap(void *addr, size_t size, int prot, int flags, int fd, off_t off) {
+    auto &file = files[openedFiles[fd]];
+    auto ptr = alignedMalloc(size, MemoryConstants::pageSize);
+    memcpy(ptr, file.data(), std::min(size, file.size()));
+    SysCalls::mmapVector.push_back(ptr);
+    return ptr;
+}
+
+int mockRename(const char *currName, const char *dstName) {
+    files[dstName] = std::move(files[currName]);
+    files.erase(currName);
+    return 0;
+}
+
+int mockUnlink(const std::string &path) {
+    files.erase(path);
+    return 0;
+}
+} // namespace BinaryCacheFiles
+
+class BuiltInsBinaryCacheLinuxTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        BinaryCacheFiles::files.clear();
+        BinaryCacheFiles::openedFiles.clear();
+        ipVersion.architecture = 12;
+        ipVersion.release = 60;
+        ipVersion.revision = 7;
+    }
+
+    HardwareIpVersion ipVersion = {};
+    const std::string cacheDir = "/home/cl_cache";
+
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> openBackup{&SysCalls::sysCallsOpen, BinaryCacheFiles::mockOpen};
+    VariableBackup<decltype(SysCalls::sysCallsMkstemp)> mkstempBackup{&SysCalls::sysCallsMkstemp, BinaryCacheFiles::mockMkstemp};
+    VariableBackup<decltype(SysCalls::sysCallsClose)> closeBackup{&SysCalls::sysCallsClose, BinaryCacheFiles::mockClose};
+    VariableBackup<decltype(SysCalls::sysCallsPwrite)> pwriteBackup{&SysCalls::sysCallsPwrite, BinaryCacheFiles::mockPwrite};
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup{&SysCalls::sysCallsFstat, BinaryCacheFiles::mockFstat};
+    VariableBackup<decltype(SysCalls::sysCallsMmap)> mmapBackup{&SysCalls::sysCallsMmap, BinaryCacheFiles::mockMmap};
+    VariableBackup<decltype(SysCalls::sysCallsRename)> renameBackup{&SysCalls::sysCallsRename, BinaryCacheFiles::mockRename};
+    VariableBackup<decltype(SysCalls::sysCallsUnlink)> unlinkBackup{&SysCalls::sysCallsUnlink, BinaryCacheFiles::mockUnlink};
+};
+
+TEST_F(BuiltInsBinaryCacheLinuxTest, givenEmptyCacheDirWhenCreatingBinaryCacheThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, BuiltIn::BinaryCache::create("", ipVersion));
+    EXPECT_NE(nullptr, BuiltIn::BinaryCache::create(cacheDir, ipVersion));
+}
+
+TEST_F(BuiltInsBinaryCacheLinuxTest, givenStoredEntryWhenLoadingThenPayloadIsReturnedFromMappedFileWithoutCopy) {
+    const char binary[] = "device binary";
+    auto mmapCalledBefore = SysCalls::mmapFuncCalled;
+    auto munmapCalledBefore = SysCalls::munmapFuncCalled;
+    {
+        auto cache = BuiltIn::BinaryCache::create(cacheDir, ipVersion);
+        EXPECT_TRUE(cache->store("fill_buffer", ArrayRef<const char>(binary)));
+
+        ASSERT_EQ(1u, BinaryCacheFiles::files.size());
+        EXPECT_EQ(cacheDir + "/12_60_7_fill_buffer" + BuiltIn::BinaryCache::fileExtension, BinaryCacheFiles::files.begin()->first);
+
+        auto resource = cache->load("fill_buffer");
+        ASSERT_EQ(sizeof(binary), resource.size);
+        EXPECT_TRUE(resource.persistentMemory);
+        EXPECT_EQ(0, memcmp(binary, resource.data, sizeof(binary)));
+        EXPECT_EQ(mmapCalledBefore + 1, SysCalls::mmapFuncCalled);
+
+        EXPECT_TRUE(cache->load("copy_buffer_to_buffer").empty());
+        EXPECT_TRUE(BinaryCacheFiles::openedFiles.empty());
+    }
+    EXPECT_EQ(munmapCalledBefore + 1, SysCalls::munmapFuncCalled);
+}
+
+TEST_F(BuiltInsBinaryCacheLinuxTest, givenEntryFromDifferentDriverBuildOrIpVersionWhenLoadingThenEntryIsRejectedAndUnmapped) {
+    const char binary[] = "device binary";
+    auto cache = BuiltIn::BinaryCache::create(cacheDir, ipVersion);
+    EXPECT_TRUE(cache->store("fill_buffer", ArrayRef<const char>(binary)));
+    auto &file = BinaryCacheFiles::files.begin()->second;
+
+    auto header = reinterpret_cast<BuiltIn::BinaryCacheEntryHeader *>(file.data());
+    header->driverBuildKey++;
+    auto munmapCalledBefore = SysCalls::munmapFuncCalled;
+    EXPECT_TRUE(cache->load("fill_buffer").empty());
+    EXPECT_EQ(munmapCalledBefore + 1, SysCalls::munmapFuncCalled);
+
+    header->driverBuildKey--;
+    header->ipVersion++;
+    EXPECT_TRUE(cache->load("fill_buffer").empty());
+
+    header->ipVersion--;
+    file.resize(file.size() - 1);
+    EXPECT_TRUE(cache->load("fill_buffer").empty());
+}
+
+TEST_F(BuiltInsBinaryCacheLinuxTest, givenRenameFailureWhenStoringThenFalseIsReturnedAndTemporaryFileIsRemoved) {
+    VariableBackup<decltype(SysCalls::sysCallsRename)> failingRenameBackup(&SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int {
+        return -1;
+    });
+
+    const char binary[] = "device binary";
+    auto cache = BuiltIn::BinaryCache::create(cacheDir, ipVersion);
+    EXPECT_FALSE(cache->store("fill_buffer", ArrayRef<const char>(binary)));
+    EXPECT_FALSE(cache->store("fill_buffer", {}));
+    EXPECT_TRUE(BinaryCacheFiles::files.empty());
+}
+
+TEST_F(BuiltInsBinaryCacheLinuxTest, givenStoredEntryWhenLoadingItRepeatedlyThenFileIsMappedOnlyOnce) {
+    const char binary[] = "device binary";
+    auto mmapCalledBefore = SysCalls::mmapFuncCalled;
+    auto munmapCalledBefore = SysCalls::munmapFuncCalled;
+    {
+        auto cache = BuiltIn::BinaryCache::create(cacheDir, ipVersion);
+        EXPECT_TRUE(cache->store("fill_buffer", ArrayRef<const char>(binary)));
+
+        auto firstResource = cache->load("fill_buffer");
+        auto secondResource = cache->load("fill_buffer");
+        ASSERT_EQ(sizeof(binary), firstResource.size);
+        EXPECT_EQ(firstResource.data, secondResource.data);
+        EXPECT_EQ(firstResource.size, secondResource.size);
+        EXPECT_EQ(mmapCalledBefore + 1, SysCalls::mmapFuncCalled);
+    }
+    EXPECT_EQ(munmapCalledBefore + 1, SysCalls::munmapFuncCalled);
+}
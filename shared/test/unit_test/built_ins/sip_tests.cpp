@@ -19,6 +19,7 @@
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/global_environment.h"
 #include "shared/test/common/mocks/mock_builtins.h"
+#include "shared/test/common/mocks/mock_builtinslib.h"
 #include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_compiler_product_helper.h"
 #include "shared/test/common/mocks/mock_compilers.h"
@@ -642,6 +643,45 @@ TEST(Sip, givenSipKernelWhenAllocationFailsThenItHasNullptrGraphicsAllocation) {
     EXPECT_EQ(nullptr, sipKern.getSipAllocation());
 }
 
+TEST(Sip, givenBinaryCacheWhenGettingCsrSipKernelThenCompiledSipIsCachedAndReusedWithoutCompilerByNextBuiltIns) {
+    auto mockDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto rootDeviceEnvironment = mockDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+    auto mockCompilerInterface = new MockCompilerInterface();
+    rootDeviceEnvironment->compilerInterface.reset(mockCompilerInterface);
+    mockCompilerInterface->sipKernelBinaryOverride = mockCompilerInterface->getDummyGenBinary();
+    mockCompilerInterface->sipStateAreaHeaderOverride = MockSipData::createStateSaveAreaHeader(4);
+    mockCompilerInterface->compilerIdentityHashOverride = 0x1234u;
+
+    auto builtins = new MockBuiltins;
+    builtins->callBaseGetSipKernel = true;
+    auto resourceLoader = new MockBuiltInResourceLoaderWithBinaryCache;
+    builtins->builtinsLib.reset(resourceLoader);
+    MockRootDeviceEnvironment::resetBuiltins(rootDeviceEnvironment, builtins);
+
+    builtins->getSipKernel(SipKernelType::csr, *mockDevice);
+    EXPECT_EQ(SipKernelType::csr, mockCompilerInterface->requestedSipKernel);
+    EXPECT_EQ(1u, resourceLoader->binaryCacheMock->storeCalled);
+    auto cachedEntries = resourceLoader->binaryCacheMock->entries;
+
+    mockCompilerInterface->requestedSipKernel = SipKernelType::count;
+    auto nextBuiltins = new MockBuiltins;
+    nextBuiltins->callBaseGetSipKernel = true;
+    auto nextResourceLoader = new MockBuiltInResourceLoaderWithBinaryCache;
+    nextResourceLoader->binaryCacheMock->entries = cachedEntries;
+    nextBuiltins->builtinsLib.reset(nextResourceLoader);
+    MockRootDeviceEnvironment::resetBuiltins(rootDeviceEnvironment, nextBuiltins);
+
+    auto &sipKernel = nextBuiltins->getSipKernel(SipKernelType::csr, *mockDevice);
+    EXPECT_EQ(SipKernelType::count, mockCompilerInterface->requestedSipKernel);
+    EXPECT_EQ(0u, nextResourceLoader->binaryCacheMock->storeCalled);
+    EXPECT_EQ(mockCompilerInterface->sipKernelBinaryOverride, sipKernel.getBinary());
+    EXPECT_EQ(mockCompilerInterface->sipStateAreaHeaderOverride, sipKernel.getStateSaveAreaHeader());
+    ASSERT_NE(nullptr, sipKernel.getSipAllocation());
+    EXPECT_EQ(0, memcmp(mockCompilerInterface->sipKernelBinaryOverride.data(), sipKernel.getSipAllocation()->getUnderlyingBuffer(), mockCompilerInterface->sipKernelBinaryOverride.size()));
+
+    mockCompilerInterface->releaseDummyGenBinary();
+}
+
 TEST(DebugSip, givenBuiltInsWhenDbgCsrSipIsRequestedThenCorrectSipKernelIsReturned) {
     auto mockDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
     EXPECT_NE(nullptr, mockDevice);
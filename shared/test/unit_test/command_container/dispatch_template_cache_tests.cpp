@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/dispatch_template_cache.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+
+using namespace NEO;
+
+namespace {
+DispatchTemplateKey createKey(uint64_t kernelStartPointer) {
+    DispatchTemplateKey key{};
+    key.kernelStartPointer = kernelStartPointer;
+    key.groupSize[0] = 32u;
+    key.groupSize[1] = 1u;
+    key.groupSize[2] = 1u;
+    return key;
+}
+} // namespace
+
+TEST(DispatchTemplateCacheTest, givenEmptyCacheWhenLoadingWalkerThenMissIsReportedAndWalkerIsNotModified) {
+    DispatchTemplateCache cache;
+    std::array<uint8_t, 64> walker{};
+    walker.fill(0xab);
+
+    EXPECT_FALSE(cache.loadWalker(createKey(0x1000), walker.data(), walker.size()));
+    EXPECT_EQ(0xab, walker[0]);
+    EXPECT_EQ(0u, cache.getHitsCount());
+    EXPECT_EQ(1u, cache.getMissesCount());
+}
+
+TEST(DispatchTemplateCacheTest, givenStoredWalkerWhenLoadingWithSameKeyThenWalkerIsCopied) {
+    DispatchTemplateCache cache;
+    std::array<uint8_t, 64> stored{};
+    stored.fill(0x5a);
+    cache.storeWalker(createKey(0x1000), stored.data(), stored.size());
+
+    std::array<uint8_t, 64> loaded{};
+    EXPECT_TRUE(cache.loadWalker(createKey(0x1000), loaded.data(), loaded.size()));
+    EXPECT_EQ(stored, loaded);
+    EXPECT_EQ(1u, cache.getHitsCount());
+
+    auto otherKey = createKey(0x1000);
+    otherKey.groupSize[0] = 16u;
+    EXPECT_FALSE(cache.loadWalker(otherKey, loaded.data(), loaded.size()));
+}
+
+TEST(DispatchTemplateCacheTest, givenMoreKeysThanEntriesWhenStoringWalkersThenOldestEntryIsEvicted) {
+    DispatchTemplateCache cache;
+    std::array<uint8_t, 64> walker{};
+
+    for (uint64_t i = 0; i <= DispatchTemplateCache::entriesCount; i++) {
+        walker.fill(static_cast<uint8_t>(i));
+        cache.storeWalker(createKey(0x1000 * (i + 1)), walker.data(), walker.size());
+    }
+
+    EXPECT_FALSE(cache.loadWalker(createKey(0x1000), walker.data(), walker.size()));
+    for (uint64_t i = 1; i <= DispatchTemplateCache::entriesCount; i++) {
+        EXPECT_TRUE(cache.loadWalker(createKey(0x1000 * (i + 1)), walker.data(), walker.size()));
+        EXPECT_EQ(static_cast<uint8_t>(i), walker[0]);
+    }
+}
@@ -33,8 +33,13 @@
 #include "os_inc.h"
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -407,6 +412,142 @@ TEST(CompilerCacheTests, GivenTooShortKernelFileHashWhenGetCachedBinaryIsCalledT
     EXPECT_EQ(0U, size);
 }
 
+TEST(CompilerCacheTests, GivenBuildAcquiredForHashWhenAcquiringAgainFromOtherThreadThenItWaitsForReleaseAndReturnsReleased) {
+    using InFlightBuildStatus = CompilerCache::InFlightBuildStatus;
+    constexpr std::chrono::milliseconds timeout{60000};
+    CompilerCache cache(CompilerCacheConfig{});
+    EXPECT_EQ(InFlightBuildStatus::acquired, cache.tryAcquireBuild("hash", timeout));
+    EXPECT_EQ(InFlightBuildStatus::acquired, cache.tryAcquireBuild("other_hash", timeout));
+
+    std::atomic<bool> waiterDone{false};
+    std::thread waiter([&]() {
+        EXPECT_EQ(InFlightBuildStatus::released, cache.tryAcquireBuild("hash", timeout));
+        waiterDone = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(waiterDone.load());
+
+    cache.releaseBuild("hash");
+    waiter.join();
+    EXPECT_TRUE(waiterDone.load());
+
+    EXPECT_EQ(InFlightBuildStatus::acquired, cache.tryAcquireBuild("hash", timeout));
+    cache.releaseBuild("hash");
+    cache.releaseBuild("other_hash");
+}
+
+TEST(CompilerCacheTests, GivenBuildAcquiredForHashWhenOtherThreadWaitsLongerThanTimeoutThenTimedOutIsReturned) {
+    using InFlightBuildStatus = CompilerCache::InFlightBuildStatus;
+    CompilerCache cache(CompilerCacheConfig{});
+    EXPECT_EQ(InFlightBuildStatus::acquired, cache.tryAcquireBuild("hash", std::chrono::milliseconds(1)));
+
+    std::thread waiter([&]() {
+        EXPECT_EQ(InFlightBuildStatus::timedOut, cache.tryAcquireBuild("hash", std::chrono::milliseconds(1)));
+    });
+    waiter.join();
+
+    cache.releaseBuild("hash");
+}
+
+TEST(CompilerCacheTests, GivenAsyncModuleBuildDisabledWhenLoadingCacheOrAcquiringBuildOnMissThenBuildIsNotAcquired) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AsyncModuleBuildThreads.set(0);
+    CompilerCacheMock cache;
+    TranslationOutput output;
+    std::unique_ptr<CompilerCacheInFlightBuild> inFlightBuild;
+
+    EXPECT_FALSE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", output, inFlightBuild));
+    EXPECT_EQ(nullptr, inFlightBuild);
+    EXPECT_EQ(CompilerCache::InFlightBuildStatus::acquired, cache.tryAcquireBuild("hash", std::chrono::milliseconds(1)));
+    cache.releaseBuild("hash");
+}
+
+struct SynchronizedCompilerCacheMock : CompilerCacheMock {
+    std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        loadCachedBinaryCalled++;
+        return CompilerCacheMock::loadCachedBinary(kernelFileHash, cachedBinarySize);
+    }
+    std::mutex mtx;
+    std::atomic<uint32_t> loadCachedBinaryCalled{0u};
+};
+
+TEST(CompilerCacheTests, GivenCacheMissWhenLoadingCacheOrAcquiringBuildThenBuildIsAcquiredUntilGuardIsDestroyed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AsyncModuleBuildThreads.set(1);
+    SynchronizedCompilerCacheMock cache;
+    TranslationOutput output;
+    std::unique_ptr<CompilerCacheInFlightBuild> inFlightBuild;
+
+    EXPECT_FALSE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", output, inFlightBuild));
+    EXPECT_NE(nullptr, inFlightBuild);
+
+    std::thread waiter([&]() {
+        TranslationOutput waiterOutput;
+        std::unique_ptr<CompilerCacheInFlightBuild> waiterInFlightBuild;
+        EXPECT_TRUE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", waiterOutput, waiterInFlightBuild));
+        EXPECT_EQ(nullptr, waiterInFlightBuild);
+        EXPECT_EQ(4u, waiterOutput.deviceBinary.size);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        std::lock_guard<std::mutex> lock(cache.mtx);
+        cache.hashToBinaryMap["hash"] = "data";
+    }
+    inFlightBuild.reset();
+    waiter.join();
+}
+
+TEST(CompilerCacheTests, GivenFirstBuildNotCachedWhenWaitersAreReleasedThenEachBuildsWithoutAcquiringBuild) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AsyncModuleBuildThreads.set(1);
+    SynchronizedCompilerCacheMock cache;
+    TranslationOutput output;
+    std::unique_ptr<CompilerCacheInFlightBuild> inFlightBuild;
+
+    EXPECT_FALSE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", output, inFlightBuild));
+    ASSERT_NE(nullptr, inFlightBuild);
+
+    constexpr auto numWaiters = 2u;
+    std::array<bool, numWaiters> waiterAcquiredBuild = {true, true};
+    std::vector<std::thread> waiters;
+    for (auto i = 0u; i < numWaiters; i++) {
+        waiters.emplace_back([&, i]() {
+            TranslationOutput waiterOutput;
+            std::unique_ptr<CompilerCacheInFlightBuild> waiterInFlightBuild;
+            EXPECT_FALSE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", waiterOutput, waiterInFlightBuild));
+            waiterAcquiredBuild[i] = (waiterInFlightBuild != nullptr);
+        });
+    }
+
+    while (cache.loadCachedBinaryCalled.load() < 1u + numWaiters) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    inFlightBuild.reset();
+    for (auto &waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_FALSE(waiterAcquiredBuild[0]);
+    EXPECT_FALSE(waiterAcquiredBuild[1]);
+}
+
+TEST(CompilerCacheTests, GivenCacheHitWhenLoadingCacheOrAcquiringBuildThenBuildIsNotAcquired) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AsyncModuleBuildThreads.set(1);
+    CompilerCacheMock cache;
+    cache.hashToBinaryMap["hash"] = "data";
+    TranslationOutput output;
+    std::unique_ptr<CompilerCacheInFlightBuild> inFlightBuild;
+
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheOrAcquireBuild(cache, "hash", output, inFlightBuild));
+    EXPECT_EQ(nullptr, inFlightBuild);
+    EXPECT_EQ(CompilerCache::InFlightBuildStatus::acquired, cache.tryAcquireBuild("hash", std::chrono::milliseconds(1)));
+    cache.releaseBuild("hash");
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
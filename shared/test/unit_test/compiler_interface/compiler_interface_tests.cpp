@@ -17,6 +17,7 @@
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/global_environment.h"
 #include "shared/test/common/mocks/mock_cif.h"
 #include "shared/test/common/mocks/mock_compiler_interface.h"
@@ -224,6 +225,47 @@ TEST_F(CompilerInterfaceTest, whenCompilerIsNotAvailableThenBuildFailsGracefully
     EXPECT_EQ(TranslationErrorCode::compilerNotAvailable, err);
 }
 
+TEST_F(CompilerInterfaceTest, whenGettingCompilerIdentityHashThenItDependsOnIgcRevisionLibraryAndRegKeys) {
+    uint64_t baseHash = 0u;
+    ASSERT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, baseHash));
+
+    uint64_t hash = 0u;
+    EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+    EXPECT_EQ(baseHash, hash);
+
+    auto &igc = pCompilerInterface->defaultIgc;
+    {
+        VariableBackup<std::string> revisionBackup(&igc.revision, "otherrevision");
+        EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+        EXPECT_NE(baseHash, hash);
+    }
+    {
+        VariableBackup<size_t> libSizeBackup(&igc.libSize, igc.libSize + 1);
+        EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+        EXPECT_NE(baseHash, hash);
+    }
+    {
+        VariableBackup<time_t> libMTimeBackup(&igc.libMTime, igc.libMTime + 1);
+        EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+        EXPECT_NE(baseHash, hash);
+    }
+    {
+        VariableBackup<std::string> regKeysBackup(&igc.igcRegKeys, "otherregkeys");
+        EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+        EXPECT_NE(baseHash, hash);
+    }
+
+    EXPECT_TRUE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+    EXPECT_EQ(baseHash, hash);
+}
+
+TEST_F(CompilerInterfaceTest, whenCompilerIsNotAvailableThenCompilerIdentityHashIsNotReturned) {
+    pCompilerInterface->defaultIgc.entryPoint.reset(nullptr);
+
+    uint64_t hash = 0u;
+    EXPECT_FALSE(pCompilerInterface->getCompilerIdentityHash(*pDevice, hash));
+}
+
 TEST_F(CompilerInterfaceTest, whenFclTranslatorReturnsNullptrThenBuildFailsGracefully) {
     CompilerCacheConfig config = {};
     config.enabled = false;
@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_index_linux.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_os_thread.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <map>
+#include <string_view>
+
+using namespace NEO;
+
+namespace CompilerCacheIndexFiles {
+constexpr int indexFd = 100;
+constexpr int blobFd = 101;
+constexpr int tmpBlobFd = 102;
+
+std::map<int, std::vector<char>> files;
+
+int mockOpenWithMode(const char *path, int flags, int mode) {
+    std::string_view filePath = path;
+    if (filePath.find(CompilerCacheIndexLinux::indexFileName) != filePath.npos) {
+        return indexFd;
+    }
+    if (filePath.find(CompilerCacheIndexLinux::blobFileName) != filePath.npos) {
+        if (flags & O_TRUNC) {
+            files[blobFd].clear();
+        }
+        return blobFd;
+    }
+    return -1;
+}
+
+ssize_t mockPread(int fd, void *buf, size_t count, off_t offset) {
+    auto &file = files[fd];
+    if (static_cast<size_t>(offset) >= file.size()) {
+        return 0;
+    }
+    auto bytesRead = std::min(count, file.size() - static_cast<size_t>(offset));
+    memcpy(buf, file.data() + offset, bytesRead);
+    return static_cast<ssize_t>(bytesRead);
+}
+
+ssize_t mockPwrite(int fd, const void *buf, size_t count, off_t offset) {
+    auto &file = files[fd];
+    if (file.size() < static_cast<size_t>(offset) + count) {
+        file.resize(static_cast<size_t>(offset) + count);
+    }
+    memcpy(file.data() + offset, buf, count);
+    return count;
+}
+
+int mockMkstemp(char *path) {
+    files[tmpBlobFd].clear();
+    return tmpBlobFd;
+}
+
+int mockRename(const char *currName, const char *dstName) {
+    return 0;
+}
+} // namespace CompilerCacheIndexFiles
+
+class MockCompilerCacheIndexLinux : public CompilerCacheIndexLinux {
+  public:
+    using CompilerCacheIndexLinux::blobFd;
+    using CompilerCacheIndexLinux::compactLocked;
+    using CompilerCacheIndexLinux::CompilerCacheIndexLinux;
+    using CompilerCacheIndexLinux::evictionPending;
+    using CompilerCacheIndexLinux::evictionRequested;
+    using CompilerCacheIndexLinux::evictionStep;
+    using CompilerCacheIndexLinux::evictLocked;
+    using CompilerCacheIndexLinux::header;
+};
+
+class CompilerCacheIndexLinuxTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        CompilerCacheIndexFiles::files.clear();
+    }
+
+    std::unique_ptr<MockCompilerCacheIndexLinux> createIndex(size_t cacheSize, uint32_t bucketCount) {
+        CompilerCacheConfig config = {true, false, ".cl_cache", "/home/cl_cache/", cacheSize, true};
+        auto index = std::make_unique<MockCompilerCacheIndexLinux>(config, bucketCount);
+        EXPECT_TRUE(index->open());
+        return index;
+    }
+
+    VariableBackup<decltype(SysCalls::sysCallsOpenWithMode)> openBackup{&SysCalls::sysCallsOpenWithMode, CompilerCacheIndexFiles::mockOpenWithMode};
+    VariableBackup<decltype(SysCalls::sysCallsPread)> preadBackup{&SysCalls::sysCallsPread, CompilerCacheIndexFiles::mockPread};
+    VariableBackup<decltype(SysCalls::sysCallsPwrite)> pwriteBackup{&SysCalls::sysCallsPwrite, CompilerCacheIndexFiles::mockPwrite};
+    VariableBackup<decltype(SysCalls::sysCallsMkstemp)> mkstempBackup{&SysCalls::sysCallsMkstemp, CompilerCacheIndexFiles::mockMkstemp};
+    VariableBackup<decltype(SysCalls::sysCallsRename)> renameBackup{&SysCalls::sysCallsRename, CompilerCacheIndexFiles::mockRename};
+    VariableBackup<decltype(Thread::createFunc)> threadBackup{&Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> {
+                                                                  return std::make_unique<MockThread>();
+                                                              }};
+};
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenStoredBinaryWhenLoadingThenSameDataIsReturned) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    const char binary[] = "12345678";
+    EXPECT_TRUE(index->store("0123456789abcdef.cl_cache", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    auto data = index->load("0123456789abcdef.cl_cache", size);
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, data.get(), size));
+
+    EXPECT_EQ(1u, index->header->entryCount);
+    EXPECT_EQ(sizeof(binary), index->header->usedBytes);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenUnknownKeyWhenLoadingThenNullptrIsReturned) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    size_t size = 1u;
+    EXPECT_EQ(nullptr, index->load("0123456789abcdef.cl_cache", size));
+    EXPECT_EQ(0u, size);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenAlreadyStoredKeyWhenStoringAgainThenBlobIsNotAppended) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    const char binary[] = "12345678";
+    EXPECT_TRUE(index->store("0123456789abcdef.cl_cache", binary, sizeof(binary)));
+    EXPECT_TRUE(index->store("0123456789abcdef.cl_cache", binary, sizeof(binary)));
+
+    EXPECT_EQ(1u, index->header->entryCount);
+    EXPECT_EQ(sizeof(binary), index->header->blobSize);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenTooLongKeyWhenStoringThenFalseIsReturned) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    const char binary[] = "12345678";
+    std::string key(CompilerCacheIndexFormat::maxKeyLength + 1, 'a');
+    EXPECT_FALSE(index->store(key, binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, index->load(key, size));
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenFullCacheWhenStoringThenLeastRecentlyAccessedEntriesAreEvicted) {
+    auto index = createIndex(4 * MemoryConstants::kiloByte, 64u);
+
+    std::vector<char> binary(MemoryConstants::kiloByte, 'x');
+    EXPECT_TRUE(index->store("aaaaaaaaaaaaaaaa.cl_cache", binary.data(), binary.size()));
+    EXPECT_TRUE(index->store("bbbbbbbbbbbbbbbb.cl_cache", binary.data(), binary.size()));
+    EXPECT_TRUE(index->store("cccccccccccccccc.cl_cache", binary.data(), binary.size()));
+    EXPECT_TRUE(index->store("dddddddddddddddd.cl_cache", binary.data(), binary.size()));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, index->load("aaaaaaaaaaaaaaaa.cl_cache", size));
+
+    EXPECT_TRUE(index->store("eeeeeeeeeeeeeeee.cl_cache", binary.data(), binary.size()));
+
+    EXPECT_NE(nullptr, index->load("aaaaaaaaaaaaaaaa.cl_cache", size));
+    EXPECT_EQ(nullptr, index->load("bbbbbbbbbbbbbbbb.cl_cache", size));
+    EXPECT_NE(nullptr, index->load("eeeeeeeeeeeeeeee.cl_cache", size));
+    EXPECT_LE(index->header->usedBytes, 4 * MemoryConstants::kiloByte);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenUsageAboveHighWatermarkWhenStoringThenBackgroundEvictionIsRequestedAndStepEvictsToTarget) {
+    auto index = createIndex(8 * MemoryConstants::kiloByte, 64u);
+
+    std::vector<char> binary(MemoryConstants::kiloByte, 'x');
+    for (char c = 'a'; c < 'a' + 7; c++) {
+        std::string key(16, c);
+        EXPECT_TRUE(index->store(key + ".cl_cache", binary.data(), binary.size()));
+    }
+    EXPECT_FALSE(index->evictionPending);
+
+    EXPECT_TRUE(index->store("hhhhhhhhhhhhhhhh.cl_cache", binary.data(), binary.size()));
+    EXPECT_TRUE(index->evictionPending);
+    EXPECT_TRUE(index->evictionRequested);
+
+    while (index->evictionStep()) {
+    }
+    EXPECT_FALSE(index->evictionPending);
+    EXPECT_LE(index->header->usedBytes, 8 * MemoryConstants::kiloByte - 8 * MemoryConstants::kiloByte / 3);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenEvictedEntriesWhenCompactingThenBlobIsRewrittenAndRemainingEntriesAreLoadable) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    std::vector<char> binaryA(100, 'a');
+    std::vector<char> binaryB(200, 'b');
+    EXPECT_TRUE(index->store("aaaaaaaaaaaaaaaa.cl_cache", binaryA.data(), binaryA.size()));
+    EXPECT_TRUE(index->store("bbbbbbbbbbbbbbbb.cl_cache", binaryB.data(), binaryB.size()));
+
+    EXPECT_EQ(1u, index->evictLocked(1u, 0u));
+    EXPECT_EQ(1u, index->header->tombstoneCount);
+
+    auto generationBefore = index->header->blobGeneration;
+    EXPECT_TRUE(index->compactLocked());
+
+    EXPECT_EQ(CompilerCacheIndexFiles::tmpBlobFd, index->blobFd);
+    EXPECT_EQ(generationBefore + 1, index->header->blobGeneration);
+    EXPECT_EQ(0u, index->header->tombstoneCount);
+    EXPECT_EQ(binaryB.size(), index->header->blobSize);
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, index->load("aaaaaaaaaaaaaaaa.cl_cache", size));
+    auto data = index->load("bbbbbbbbbbbbbbbb.cl_cache", size);
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(binaryB.size(), size);
+    EXPECT_EQ(0, memcmp(binaryB.data(), data.get(), size));
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenStoredEntriesWhenClearingThenEntriesAreDroppedAndBlobIsTruncated) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    const char binary[] = "12345678";
+    EXPECT_TRUE(index->store("0123456789abcdef.cl_cache", binary, sizeof(binary)));
+
+    EXPECT_TRUE(index->clear());
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, index->load("0123456789abcdef.cl_cache", size));
+    EXPECT_EQ(0u, index->header->entryCount);
+    EXPECT_EQ(0u, index->header->blobSize);
+    EXPECT_TRUE(CompilerCacheIndexFiles::files[CompilerCacheIndexFiles::blobFd].empty());
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenBlobWriteFailureWhenStoringThenFalseIsReturnedAndEntryIsNotPublished) {
+    auto index = createIndex(MemoryConstants::megaByte, 64u);
+
+    VariableBackup<decltype(SysCalls::sysCallsPwrite)> failingPwriteBackup(&SysCalls::sysCallsPwrite, [](int fd, const void *buf, size_t count, off_t offset) -> ssize_t {
+        return -1;
+    });
+
+    const char binary[] = "12345678";
+    EXPECT_FALSE(index->store("0123456789abcdef.cl_cache", binary, sizeof(binary)));
+    EXPECT_EQ(0u, index->header->entryCount);
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenIndexFileCannotBeOpenedWhenOpeningThenFalseIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsOpenWithMode)> failingOpenBackup(&SysCalls::sysCallsOpenWithMode, [](const char *path, int flags, int mode) -> int {
+        return -1;
+    });
+
+    CompilerCacheConfig config = {true, false, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true};
+    EXPECT_EQ(nullptr, CompilerCacheIndex::create(config));
+}
+
+TEST_F(CompilerCacheIndexLinuxTest, GivenIndexedStorageEnabledWhenCachingAndLoadingBinaryThenIndexIsUsedAndStatsAreUpdatedInCacheRoot) {
+    static std::vector<std::string> updatedStatsPaths;
+    updatedStatsPaths.clear();
+
+    class CompilerCacheWithIndexMock : public CompilerCache {
+      public:
+        using CompilerCache::CompilerCache;
+        using CompilerCache::index;
+
+        bool createStats(const std::string &statsPath) override {
+            return true;
+        }
+        bool updateStats(const std::string &statsPath, bool hit) override {
+            updatedStatsPaths.push_back(statsPath);
+            return true;
+        }
+    };
+
+    CompilerCacheWithIndexMock cache({true, true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true});
+    ASSERT_NE(nullptr, cache.index);
+
+    const char binary[] = "12345678";
+    auto unlinkCalledBefore = SysCalls::unlinkCalled;
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary, sizeof(binary)));
+    EXPECT_EQ(unlinkCalledBefore, SysCalls::unlinkCalled);
+
+    size_t size = 0u;
+    auto data = cache.loadCachedBinary("0123456789abcdef", size);
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(sizeof(binary), size);
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("fedcba9876543210", size));
+
+    ASSERT_EQ(2u, updatedStatsPaths.size());
+    EXPECT_EQ("/home/cl_cache/stats", updatedStatsPaths[0]);
+    EXPECT_EQ("/home/cl_cache/stats", updatedStatsPaths[1]);
+}
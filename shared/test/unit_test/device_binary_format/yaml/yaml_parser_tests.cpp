@@ -8,7 +8,9 @@
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <algorithm>
 #include <limits>
+#include <random>
 #include <stdexcept>
 #include <type_traits>
 
@@ -3306,3 +3308,196 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+namespace {
+void expectSameTokensInBothTokenizerModes(ConstStringRef text) {
+    LinesCache scalarLines, vectorizedLines;
+    TokensCache scalarTokens, vectorizedTokens;
+    std::string scalarErrors, vectorizedErrors;
+    std::string scalarWarnings, vectorizedWarnings;
+    bool scalarSuccess = NEO::Yaml::tokenize(text, scalarLines, scalarTokens, scalarErrors, scalarWarnings, TokenizerMode::scalar);
+    bool vectorizedSuccess = NEO::Yaml::tokenize(text, vectorizedLines, vectorizedTokens, vectorizedErrors, vectorizedWarnings, TokenizerMode::vectorized);
+    ASSERT_EQ(scalarSuccess, vectorizedSuccess) << text.str();
+    EXPECT_EQ(scalarErrors, vectorizedErrors);
+    EXPECT_EQ(scalarWarnings, vectorizedWarnings);
+
+    ASSERT_EQ(scalarTokens.size(), vectorizedTokens.size()) << text.str();
+    for (size_t i = 0; i < scalarTokens.size(); ++i) {
+        EXPECT_EQ(scalarTokens[i].pos, vectorizedTokens[i].pos) << i;
+        EXPECT_EQ(scalarTokens[i].len, vectorizedTokens[i].len) << i;
+        EXPECT_EQ(scalarTokens[i].traits.type, vectorizedTokens[i].traits.type) << i;
+        EXPECT_EQ(scalarTokens[i].traits.character0, vectorizedTokens[i].traits.character0) << i;
+    }
+
+    ASSERT_EQ(scalarLines.size(), vectorizedLines.size()) << text.str();
+    for (size_t i = 0; i < scalarLines.size(); ++i) {
+        EXPECT_EQ(scalarLines[i].first, vectorizedLines[i].first) << i;
+        EXPECT_EQ(scalarLines[i].last, vectorizedLines[i].last) << i;
+        EXPECT_EQ(scalarLines[i].indent, vectorizedLines[i].indent) << i;
+        EXPECT_EQ(scalarLines[i].lineType, vectorizedLines[i].lineType) << i;
+        EXPECT_EQ(scalarLines[i].traits.packed, vectorizedLines[i].traits.packed) << i;
+    }
+}
+
+void expectSameTreesInBothTokenizerModes(ConstStringRef text) {
+    std::string scalarParseErrors, vectorizedParseErrors;
+    std::string scalarParseWarnings, vectorizedParseWarnings;
+    NEO::Yaml::YamlParser scalarParser{TokenizerMode::scalar};
+    NEO::Yaml::YamlParser vectorizedParser{TokenizerMode::vectorized};
+    EXPECT_EQ(scalarParser.parse(text, scalarParseErrors, scalarParseWarnings), vectorizedParser.parse(text, vectorizedParseErrors, vectorizedParseWarnings));
+    EXPECT_EQ(scalarParseErrors, vectorizedParseErrors);
+    EXPECT_EQ(scalarParseWarnings, vectorizedParseWarnings);
+    ASSERT_EQ(scalarParser.empty(), vectorizedParser.empty());
+    if (scalarParser.empty()) {
+        return;
+    }
+
+    auto scalarDebugNodes = std::unique_ptr<DebugNode>(scalarParser.buildDebugNodes());
+    auto vectorizedDebugNodes = std::unique_ptr<DebugNode>(vectorizedParser.buildDebugNodes());
+    std::vector<std::pair<const DebugNode *, const DebugNode *>> toCompare{{scalarDebugNodes.get(), vectorizedDebugNodes.get()}};
+    while (false == toCompare.empty()) {
+        auto [scalarNode, vectorizedNode] = toCompare.back();
+        toCompare.pop_back();
+        EXPECT_EQ(scalarNode->key.str(), vectorizedNode->key.str());
+        EXPECT_EQ(scalarNode->value.str(), vectorizedNode->value.str());
+        EXPECT_EQ(scalarNode->src->indent, vectorizedNode->src->indent);
+        ASSERT_EQ(scalarNode->children.size(), vectorizedNode->children.size());
+        for (size_t i = 0; i < scalarNode->children.size(); ++i) {
+            toCompare.emplace_back(scalarNode->children[i], vectorizedNode->children[i]);
+        }
+    }
+}
+
+constexpr ConstStringRef zeInfoSample = R"===(---
+version:         '1.62'
+kernels:
+  - name:            kernel_with_long_name_crossing_several_blocks
+    execution_env:
+      grf_count:       128
+      has_no_stateless_write: true
+      required_work_group_size: [ 8, 4, 1 ]
+      simd_size:       32
+      subgroup_independent_forward_progress: false
+    payload_arguments:
+      - arg_type:        global_id_offset
+        offset:          0
+        size:            12
+      - arg_type:        arg_bypointer
+        offset:          0x20
+        size:            8
+        arg_index:       0
+        addrmode:        stateless
+        addrspace:       global
+        access_type:     readwrite
+    per_thread_payload_arguments:
+      - arg_type:        local_id
+        offset:          0
+        size:            192
+    binding_table_indices:
+      - bti_value:       0
+        arg_index:       0
+    # comment that spans more than a single sixteen byte block of characters
+    user_attributes:
+      intel_reqd_sub_group_size: 16
+      vec_type_hint: "float4"
+kernels_misc_info:
+  - name:            kernel_with_long_name_crossing_several_blocks
+    args_info:
+      - index:           0
+        name:            'a'
+        address_qualifier: __global
+        access_qualifier: NONE
+        type_name:       'int*;8'
+        type_qualifiers: NONE
+...
+)===";
+} // namespace
+
+TEST(YamlVectorizedHelpers, GivenAnyCharacterAtAnyOffsetWhenConsumingNameIdentifierThenResultMatchesScalarHelper) {
+    for (size_t prefixLength = 0; prefixLength < 40; ++prefixLength) {
+        for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+            std::string text = "_" + std::string(prefixLength, (prefixLength % 2) ? 'Z' : '.') + static_cast<char>(c) + std::string(20, 'a');
+            ConstStringRef textRef(text.data(), text.size());
+            EXPECT_EQ(consumeNameIdentifier(textRef, textRef.begin()), Vectorized::consumeNameIdentifier(textRef, textRef.begin())) << prefixLength << " " << c;
+
+            ConstStringRef truncated(text.data(), prefixLength + 2);
+            EXPECT_EQ(consumeNameIdentifier(truncated, truncated.begin()), Vectorized::consumeNameIdentifier(truncated, truncated.begin())) << prefixLength << " " << c;
+        }
+    }
+
+    ConstStringRef notAnIdentifier = "0abc";
+    EXPECT_EQ(notAnIdentifier.begin(), Vectorized::consumeNameIdentifier(notAnIdentifier, notAnIdentifier.begin()));
+}
+
+TEST(YamlVectorizedHelpers, GivenRunOfSpacesWhenConsumingSpacesThenStopsAtFirstOtherCharacterOrEnd) {
+    for (size_t spaces = 0; spaces < 40; ++spaces) {
+        std::string text = std::string(spaces, ' ') + "\t" + std::string(20, ' ');
+        EXPECT_EQ(text.data() + spaces, Vectorized::consumeSpaces(text.data(), text.data() + text.size()));
+        EXPECT_EQ(text.data() + spaces, Vectorized::consumeSpaces(text.data(), text.data() + spaces));
+    }
+}
+
+TEST(YamlVectorizedHelpers, WhenFindingLineEndThenReturnsFirstNewLineOrEnd) {
+    std::string text = "# comment\nnext";
+    EXPECT_EQ(text.data() + 9, Vectorized::findLineEnd(text.data(), text.data() + text.size()));
+    EXPECT_EQ(text.data() + 5, Vectorized::findLineEnd(text.data(), text.data() + 5));
+    EXPECT_EQ(text.data() + text.size(), Vectorized::findLineEnd(text.data() + 10, text.data() + text.size()));
+    EXPECT_EQ(text.data() + text.size(), Vectorized::findLineEnd(text.data() + text.size(), text.data() + text.size()));
+}
+
+TEST(YamlTokenizerModes, GivenZeInfoWhenTokenizingInVectorizedModeThenResultsMatchScalarMode) {
+    for (auto text : {zeInfoSample,
+                      ConstStringRef(zeInfoSample.begin(), zeInfoSample.size() - 1), // no trailing newline
+                      ConstStringRef(""),
+                      ConstStringRef("\t\tkey : value\r\n")}) {
+        expectSameTokensInBothTokenizerModes(text);
+        expectSameTreesInBothTokenizerModes(text);
+    }
+}
+
+TEST(YamlTokenizerModes, GivenRandomlyMutatedZeInfoWhenTokenizingInVectorizedModeThenResultsMatchScalarMode) {
+    constexpr char alphabet[] = " \t\r\n\0#:-.,[]{}'\"_aZ09x\x80";
+    std::mt19937 generator(0x5eed);
+    for (uint32_t iteration = 0; iteration < 500; ++iteration) {
+        std::string text = zeInfoSample.str();
+        auto mutationsCount = 1 + generator() % 8;
+        for (uint32_t mutation = 0; mutation < mutationsCount; ++mutation) {
+            auto pos = generator() % text.size();
+            auto c = alphabet[generator() % (sizeof(alphabet) - 1)];
+            switch (generator() % 3) {
+            case 0:
+                text[pos] = c;
+                break;
+            case 1:
+                text.insert(text.begin() + pos, c);
+                break;
+            default:
+                text.erase(text.begin() + pos);
+                break;
+            }
+        }
+        // only tokens are compared, as building a tree out of arbitrary text is not guaranteed to be recoverable
+        expectSameTokensInBothTokenizerModes(text);
+        if (::testing::Test::HasFailure()) {
+            FAIL() << "Mismatch for input : " << text;
+        }
+    }
+}
+
+TEST(YamlTokenizerModes, GivenLargeZeInfoWhenTokenizingInVectorizedModeThenCachesAreReservedUpfront) {
+    std::string text;
+    for (uint32_t i = 0; i < 64; ++i) {
+        text.append(zeInfoSample.begin() + 4, zeInfoSample.size() - 8); // skip file section markers
+    }
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors, warnings;
+    EXPECT_TRUE(NEO::Yaml::tokenize(text, lines, tokens, errors, warnings, TokenizerMode::vectorized));
+    auto expectedLines = static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+    EXPECT_LE(expectedLines, lines.capacity());
+    EXPECT_LE(expectedLines * estimatedTokensPerLine, tokens.capacity());
+    EXPECT_LE(tokens.size(), expectedLines * estimatedTokensPerLine);
+
+    expectSameTokensInBothTokenizerModes(text);
+    expectSameTreesInBothTokenizerModes(text);
+}
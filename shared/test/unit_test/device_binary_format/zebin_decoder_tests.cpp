@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/external_functions.h"
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_decoder_ext.h"
@@ -4822,6 +4823,140 @@ kernels:
     EXPECT_STREQ("DeviceBinaryFormat::zebin : Could not find text section for kernel some_kernel\n", errors.c_str());
 }
 
+namespace {
+std::vector<uint8_t> createZebinWithKernels(uint32_t kernelsCount, std::initializer_list<uint32_t> kernelsWithoutText) {
+    std::string zeInfo = "---\nversion : '" + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + "'\nkernels :\n";
+    for (uint32_t kernelId = 0; kernelId < kernelsCount; kernelId++) {
+        zeInfo += "  - name : kernel_" + std::to_string(kernelId) + "\n" +
+                  "    execution_env :\n" +
+                  "      simd_size : " + std::to_string(8u << (kernelId % 3)) + "\n" +
+                  "      grf_count : 128\n";
+    }
+
+    NEO::Elf::ElfEncoder<NEO::Elf::EI_CLASS_64> enc;
+    enc.getElfFileHeader().type = NEO::Zebin::Elf::ET_ZEBIN_EXE;
+    enc.getElfFileHeader().machine = productFamily;
+    enc.appendSection(NEO::Zebin::Elf::SHT_ZEBIN_ZEINFO, NEO::Zebin::Elf::SectionNames::zeInfo, zeInfo);
+    std::vector<uint8_t> isa(0x100, 0u);
+    for (uint32_t kernelId = 0; kernelId < kernelsCount; kernelId++) {
+        if (std::find(kernelsWithoutText.begin(), kernelsWithoutText.end(), kernelId) != kernelsWithoutText.end()) {
+            continue;
+        }
+        isa.assign(0x10 * (kernelId % 7 + 1), static_cast<uint8_t>(kernelId));
+        enc.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Zebin::Elf::SectionNames::textPrefix.str() + "kernel_" + std::to_string(kernelId), isa);
+    }
+    return enc.encode();
+}
+} // namespace
+
+TEST(DecodeZebinTest, givenManyKernelsAndMultipleDecodeThreadsWhenDecodingZebinThenKernelInfosMatchSequentialDecode) {
+    constexpr uint32_t kernelsCount = 100u;
+    auto zebin = createZebinWithKernels(kernelsCount, {});
+    std::string errors, warnings;
+    auto elf = NEO::Elf::decodeElf(zebin, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::ProgramInfo sequentialProgramInfo;
+    std::string sequentialErrors, sequentialWarnings;
+    auto err = decodeZebin(sequentialProgramInfo, elf, sequentialErrors, sequentialWarnings);
+    EXPECT_EQ(NEO::DecodeError::success, err);
+
+    NEO::ProgramInfo parallelProgramInfo;
+    parallelProgramInfo.maxKernelDecodeThreads = 4u;
+    std::string parallelErrors, parallelWarnings;
+    err = decodeZebin(parallelProgramInfo, elf, parallelErrors, parallelWarnings);
+    EXPECT_EQ(NEO::DecodeError::success, err);
+
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    ASSERT_EQ(kernelsCount, sequentialProgramInfo.kernelInfos.size());
+    ASSERT_EQ(kernelsCount, parallelProgramInfo.kernelInfos.size());
+    for (uint32_t kernelId = 0; kernelId < kernelsCount; kernelId++) {
+        auto sequentialKernelInfo = sequentialProgramInfo.kernelInfos[kernelId];
+        auto parallelKernelInfo = parallelProgramInfo.kernelInfos[kernelId];
+        EXPECT_EQ("kernel_" + std::to_string(kernelId), parallelKernelInfo->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(sequentialKernelInfo->kernelDescriptor.kernelMetadata.kernelName, parallelKernelInfo->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(sequentialKernelInfo->kernelDescriptor.kernelAttributes.simdSize, parallelKernelInfo->kernelDescriptor.kernelAttributes.simdSize);
+        EXPECT_EQ(sequentialKernelInfo->heapInfo.pKernelHeap, parallelKernelInfo->heapInfo.pKernelHeap);
+        EXPECT_EQ(sequentialKernelInfo->heapInfo.kernelHeapSize, parallelKernelInfo->heapInfo.kernelHeapSize);
+        EXPECT_EQ(0x10u * (kernelId % 7 + 1), parallelKernelInfo->heapInfo.kernelHeapSize);
+    }
+}
+
+TEST(DecodeZebinTest, givenMultipleDecodeThreadsAndKernelsWithoutTextSectionWhenDecodingZebinThenFirstSuchKernelIsReported) {
+    auto zebin = createZebinWithKernels(64u, {50u, 20u});
+    std::string errors, warnings;
+    auto elf = NEO::Elf::decodeElf(zebin, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::ProgramInfo programInfo;
+    programInfo.maxKernelDecodeThreads = 4u;
+    auto err = decodeZebin(programInfo, elf, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::invalidBinary, err);
+    EXPECT_STREQ("DeviceBinaryFormat::zebin : Could not find text section for kernel kernel_20\n", errors.c_str());
+}
+
+TEST(DecodeZebinTest, givenMultipleDecodeThreadsAndInvalidKernelEntriesWhenDecodingZeInfoThenResultMatchesSequentialDecode) {
+    std::string zeInfo = "---\nversion : '" + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + "'\nkernels :\n";
+    for (uint32_t kernelId = 0; kernelId < 64u; kernelId++) {
+        auto simdSize = (kernelId == 21u || kernelId == 45u) ? std::string("invalid") : std::string("16");
+        zeInfo += "  - name : kernel_" + std::to_string(kernelId) + "\n    execution_env :\n      simd_size : " + simdSize + "\n";
+    }
+
+    NEO::ProgramInfo sequentialProgramInfo;
+    std::string sequentialErrors, sequentialWarnings;
+    auto sequentialErr = NEO::Zebin::ZeInfo::decodeZeInfo(sequentialProgramInfo, zeInfo, sequentialErrors, sequentialWarnings);
+
+    NEO::ProgramInfo parallelProgramInfo;
+    parallelProgramInfo.maxKernelDecodeThreads = 4u;
+    std::string parallelErrors, parallelWarnings;
+    auto parallelErr = NEO::Zebin::ZeInfo::decodeZeInfo(parallelProgramInfo, zeInfo, parallelErrors, parallelWarnings);
+
+    EXPECT_NE(NEO::DecodeError::success, sequentialErr);
+    EXPECT_EQ(sequentialErr, parallelErr);
+    EXPECT_FALSE(parallelErrors.empty());
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    EXPECT_EQ(21u, sequentialProgramInfo.kernelInfos.size());
+    EXPECT_EQ(sequentialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+}
+
+TEST(DecodeZebinTest, givenVectorizedZeInfoTokenizerEnabledWhenDecodingZeInfoThenResultMatchesDefaultTokenizer) {
+    std::string zeInfo = "---\nversion : '" + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + "'\nkernels :\n";
+    for (uint32_t kernelId = 0; kernelId < 16u; kernelId++) {
+        zeInfo += "  - name : kernel_with_a_rather_long_name_" + std::to_string(kernelId) + "\n    execution_env :      # comment\n      simd_size : 16\n";
+        zeInfo += "      required_work_group_size : [ 8, 4, 1 ]\n    payload_arguments :\n      - arg_type : arg_bypointer\n        offset : 0x40\n        size : 8\n";
+        zeInfo += "        arg_index : 0\n        addrmode : stateless\n        addrspace : global\n        access_type : readwrite\n";
+    }
+
+    NEO::ProgramInfo defaultProgramInfo;
+    std::string defaultErrors, defaultWarnings;
+    auto defaultErr = NEO::Zebin::ZeInfo::decodeZeInfo(defaultProgramInfo, zeInfo, defaultErrors, defaultWarnings);
+    EXPECT_EQ(NEO::DecodeError::success, defaultErr);
+
+    DebugManagerStateRestore dbgRestore;
+    NEO::debugManager.flags.UseVectorizedZeInfoTokenizer.set(1);
+    NEO::ProgramInfo vectorizedProgramInfo;
+    std::string vectorizedErrors, vectorizedWarnings;
+    auto vectorizedErr = NEO::Zebin::ZeInfo::decodeZeInfo(vectorizedProgramInfo, zeInfo, vectorizedErrors, vectorizedWarnings);
+
+    EXPECT_EQ(defaultErr, vectorizedErr);
+    EXPECT_EQ(defaultErrors, vectorizedErrors);
+    EXPECT_EQ(defaultWarnings, vectorizedWarnings);
+    ASSERT_EQ(16u, vectorizedProgramInfo.kernelInfos.size());
+    ASSERT_EQ(defaultProgramInfo.kernelInfos.size(), vectorizedProgramInfo.kernelInfos.size());
+    for (size_t kernelId = 0; kernelId < defaultProgramInfo.kernelInfos.size(); kernelId++) {
+        const auto &defaultDescriptor = defaultProgramInfo.kernelInfos[kernelId]->kernelDescriptor;
+        const auto &vectorizedDescriptor = vectorizedProgramInfo.kernelInfos[kernelId]->kernelDescriptor;
+        EXPECT_EQ(defaultDescriptor.kernelMetadata.kernelName, vectorizedDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(defaultDescriptor.kernelAttributes.simdSize, vectorizedDescriptor.kernelAttributes.simdSize);
+        EXPECT_EQ(defaultDescriptor.kernelAttributes.requiredWorkgroupSize[0], vectorizedDescriptor.kernelAttributes.requiredWorkgroupSize[0]);
+        EXPECT_EQ(defaultDescriptor.kernelAttributes.requiredWorkgroupSize[1], vectorizedDescriptor.kernelAttributes.requiredWorkgroupSize[1]);
+        ASSERT_EQ(1u, vectorizedDescriptor.payloadMappings.explicitArgs.size());
+        EXPECT_EQ(defaultDescriptor.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().stateless, vectorizedDescriptor.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().stateless);
+    }
+}
+
 TEST(DecodeZebinTest, givenGtpinInfoSectionsWhenDecodingZebinThenProperlySetIgcInfoForGtpinForEachCorrespondingKernel) {
     std::string errors, warnings;
     ZebinTestData::ValidEmptyProgram zebin;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,14 +11,18 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::adaptiveSleepValue;
     using DirectSubmissionController::bcsTimeoutDivisor;
     using DirectSubmissionController::checkNewSubmissions;
     using DirectSubmissionController::condVarMutex;
     using DirectSubmissionController::directSubmissionControllingThread;
+    using DirectSubmissionController::DirectSubmissionState;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
+    using DirectSubmissionController::getKeepAliveTime;
     using DirectSubmissionController::getSleepValue;
     using DirectSubmissionController::handlePagingFenceRequests;
+    using DirectSubmissionController::isAdaptiveTerminationEnabled;
     using DirectSubmissionController::isCopyEngineOnDeviceIdle;
     using DirectSubmissionController::isCsrsContextGroupIdleDetectionEnabled;
     using DirectSubmissionController::isDirectSubmissionIdle;
@@ -27,6 +31,8 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::lowestThrottleSubmitted;
     using DirectSubmissionController::maxTimeout;
     using DirectSubmissionController::pagingFenceRequests;
+    using DirectSubmissionController::recordIdleGap;
+    using DirectSubmissionController::stats;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
     using DirectSubmissionController::timeSinceLastCheck;
@@ -349,6 +349,51 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCheckTi
     EXPECT_EQ(TimeoutElapsedMode::notElapsed, controller.timeoutElapsed());
 }
 
+TEST(DirectSubmissionControllerTests, givenDefaultSettingsWhenControllerIsCreatedThenAdaptiveTerminationIsDisabled) {
+    DebugManagerStateRestore restorer;
+    DirectSubmissionControllerMock defaultController;
+    EXPECT_FALSE(defaultController.isAdaptiveTerminationEnabled);
+
+    debugManager.flags.DirectSubmissionControllerAdaptiveTermination.set(1);
+    DirectSubmissionControllerMock controller;
+    EXPECT_TRUE(controller.isAdaptiveTerminationEnabled);
+    EXPECT_EQ(std::chrono::microseconds{controller.timeout}, controller.getSleepValue());
+
+    controller.adaptiveSleepValue = std::chrono::microseconds{300};
+    EXPECT_EQ(std::chrono::microseconds{300}, controller.getSleepValue());
+}
+
+TEST(DirectSubmissionControllerTests, givenIdleGapsRecordedWhenGettingKeepAliveTimeThenPredictionBasedOnAverageAndDeviationIsReturned) {
+    DirectSubmissionControllerMock controller;
+    controller.timeout = std::chrono::microseconds{5'000};
+    controller.maxTimeout = std::chrono::microseconds{10'000};
+    controller.bcsTimeoutDivisor = 2;
+
+    DirectSubmissionControllerMock::DirectSubmissionState state;
+    EXPECT_EQ(std::chrono::microseconds{5'000}, controller.getKeepAliveTime(state, false));
+    EXPECT_EQ(std::chrono::microseconds{2'500}, controller.getKeepAliveTime(state, true));
+
+    controller.recordIdleGap(state, std::chrono::microseconds{1'000});
+    EXPECT_EQ(1u, state.idleGapSamples);
+    EXPECT_EQ(std::chrono::microseconds{1'000}, state.averageIdleGap);
+    EXPECT_EQ(std::chrono::microseconds{500}, state.idleGapDeviation);
+    EXPECT_EQ(std::chrono::microseconds{2'000}, controller.getKeepAliveTime(state, false));
+
+    controller.recordIdleGap(state, std::chrono::microseconds{2'000});
+    EXPECT_EQ(2u, state.idleGapSamples);
+    EXPECT_EQ(std::chrono::microseconds{1'125}, state.averageIdleGap);
+    EXPECT_EQ(std::chrono::microseconds{625}, state.idleGapDeviation);
+    EXPECT_EQ(std::chrono::microseconds{2'375}, controller.getKeepAliveTime(state, true));
+
+    DirectSubmissionControllerMock::DirectSubmissionState shortGapsState;
+    controller.recordIdleGap(shortGapsState, std::chrono::microseconds{10});
+    EXPECT_EQ(DirectSubmissionController::adaptiveMinimalKeepAlive, controller.getKeepAliveTime(shortGapsState, false));
+
+    DirectSubmissionControllerMock::DirectSubmissionState longGapsState;
+    controller.recordIdleGap(longGapsState, std::chrono::microseconds{50'000});
+    EXPECT_EQ(DirectSubmissionController::adaptiveMinimalKeepAlive, controller.getKeepAliveTime(longGapsState, false));
+}
+
 struct TagUpdateMockCommandStreamReceiver : public MockCommandStreamReceiver {
 
     TagUpdateMockCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex, const DeviceBitfield deviceBitfield)
@@ -367,6 +412,129 @@ struct TagUpdateMockCommandStreamReceiver : public MockCommandStreamReceiver {
     bool isBusyReturnValue = false;
 };
 
+struct DirectSubmissionAdaptiveTerminationTests : public ::testing::Test {
+    void SetUp() override {
+        debugManager.flags.DirectSubmissionControllerAdaptiveTermination.set(1);
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        executionEnvironment.initializeMemoryManager();
+        executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+        DeviceBitfield deviceBitfield(1);
+        csr = std::make_unique<TagUpdateMockCommandStreamReceiver>(executionEnvironment, 0, deviceBitfield);
+        osContext.reset(OsContext::create(nullptr, 0, 0,
+                                          EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                       PreemptionMode::ThreadGroup, deviceBitfield)));
+        csr->setupContext(*osContext);
+
+        controller = std::make_unique<DirectSubmissionControllerMock>();
+        controller->timeout = std::chrono::microseconds{5'000};
+        controller->maxTimeout = std::chrono::microseconds{10'000};
+        controller->registerDirectSubmission(csr.get());
+    }
+
+    void TearDown() override {
+        controller->unregisterDirectSubmission(csr.get());
+    }
+
+    void submitAt(TaskCountType taskCount, std::chrono::microseconds time) {
+        controller->cpuTimestamp = startTime + time;
+        csr->taskCount.store(taskCount);
+        controller->notifyNewSubmission(csr.get());
+    }
+
+    void checkAt(std::chrono::microseconds time) {
+        controller->cpuTimestamp = startTime + time;
+        controller->checkNewSubmissions();
+    }
+
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<OsContext> osContext;
+    std::unique_ptr<TagUpdateMockCommandStreamReceiver> csr;
+    std::unique_ptr<DirectSubmissionControllerMock> controller;
+    SteadyClock::time_point startTime = SteadyClock::time_point{} + std::chrono::seconds(1);
+};
+
+TEST_F(DirectSubmissionAdaptiveTerminationTests, givenNoIdleGapsLearnedWhenCsrIsIdleShorterThanTimeoutThenRingIsKeptRunningAndControllerWakesAtTimeout) {
+    submitAt(5u, std::chrono::microseconds{0});
+    checkAt(std::chrono::microseconds{0});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(std::chrono::microseconds{5'000}, controller->getSleepValue());
+
+    checkAt(std::chrono::microseconds{1'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(std::chrono::microseconds{4'000}, controller->getSleepValue());
+    EXPECT_EQ(0u, controller->getStats().ringStopsCount);
+
+    checkAt(std::chrono::microseconds{5'000});
+    EXPECT_TRUE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(1u, controller->getStats().ringStopsCount);
+}
+
+TEST_F(DirectSubmissionAdaptiveTerminationTests, givenShortIdleGapsLearnedWhenCsrPausesLongerThanTimeoutThenRestartIsAvoided) {
+    submitAt(5u, std::chrono::microseconds{0});
+    checkAt(std::chrono::microseconds{0});
+
+    checkAt(std::chrono::microseconds{4'000});
+    submitAt(6u, std::chrono::microseconds{4'000});
+    checkAt(std::chrono::microseconds{4'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(1u, controller->directSubmissions[csr.get()].idleGapSamples);
+
+    checkAt(std::chrono::microseconds{9'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+
+    submitAt(7u, std::chrono::microseconds{10'000});
+    checkAt(std::chrono::microseconds{10'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+
+    auto stats = controller->getStats();
+    EXPECT_EQ(0u, stats.ringStopsCount);
+    EXPECT_EQ(0u, stats.ringRestartsCount);
+    EXPECT_EQ(1u, stats.ringRestartsAvoidedCount);
+}
+
+TEST_F(DirectSubmissionAdaptiveTerminationTests, givenLongIdleGapsLearnedWhenCsrBecomesIdleThenRingIsStoppedBeforeTimeout) {
+    submitAt(5u, std::chrono::microseconds{0});
+    checkAt(std::chrono::microseconds{0});
+    checkAt(std::chrono::microseconds{5'000});
+    EXPECT_TRUE(controller->directSubmissions[csr.get()].isStopped);
+
+    submitAt(6u, std::chrono::microseconds{50'000});
+    checkAt(std::chrono::microseconds{50'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(std::chrono::microseconds{50'000}, controller->directSubmissions[csr.get()].averageIdleGap);
+    EXPECT_EQ(DirectSubmissionController::adaptiveMinimalKeepAlive, controller->getSleepValue());
+
+    checkAt(std::chrono::microseconds{50'000} + DirectSubmissionController::adaptiveMinimalKeepAlive);
+    EXPECT_TRUE(controller->directSubmissions[csr.get()].isStopped);
+
+    auto stats = controller->getStats();
+    EXPECT_EQ(2u, stats.ringStopsCount);
+    EXPECT_EQ(1u, stats.ringRestartsCount);
+    EXPECT_EQ(0u, stats.ringRestartsAvoidedCount);
+}
+
+TEST_F(DirectSubmissionAdaptiveTerminationTests, givenKeepAliveExpiredWhenCsrIsStillBusyThenRingIsKeptRunningAndControllerBacksOffToTimeout) {
+    csr->isBusyReturnValue = true;
+    submitAt(5u, std::chrono::microseconds{0});
+    checkAt(std::chrono::microseconds{0});
+
+    checkAt(std::chrono::microseconds{5'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(std::chrono::microseconds{5'000}, controller->getSleepValue());
+
+    checkAt(std::chrono::microseconds{10'000});
+    EXPECT_FALSE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(std::chrono::microseconds{5'000}, controller->getSleepValue());
+    EXPECT_EQ(0u, controller->getStats().ringStopsCount);
+
+    csr->isBusyReturnValue = false;
+    checkAt(std::chrono::microseconds{15'000});
+    EXPECT_TRUE(controller->directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(1u, controller->getStats().ringStopsCount);
+}
+
 struct DirectSubmissionIdleDetectionTests : public ::testing::Test {
     void SetUp() override {
         controller = std::make_unique<DirectSubmissionControllerMock>();
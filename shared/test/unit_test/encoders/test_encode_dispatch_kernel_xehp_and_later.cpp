@@ -1987,3 +1987,86 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, IOHCacheCommandEncodeStatesTest, givenIOHCacheEnabl
 
     EXPECT_TRUE(iohCmdContainer->threadDataTracker->isEmpty());
 }
+
+HWTEST2_F(CommandEncodeStatesTest, givenDispatchTemplateCacheWhenSameKernelIsDispatchedAgainThenWalkerIsCopiedFromTemplateAndMatchesFullyEncodedWalker, IsAtLeastXeCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    auto referenceWalker = std::make_unique<DefaultWalkerType>();
+    auto cachedWalker = std::make_unique<DefaultWalkerType>();
+
+    dispatchInterface->dispatchTemplateCache = std::make_unique<DispatchTemplateCache>();
+    auto cache = dispatchInterface->dispatchTemplateCache.get();
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, cache->getHitsCount());
+    EXPECT_EQ(1u, cache->getMissesCount());
+
+    cmdContainer->reset();
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.cpuWalkerBuffer = cachedWalker.get();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, cache->getHitsCount());
+    EXPECT_EQ(1u, cache->getMissesCount());
+
+    dispatchInterface->dispatchTemplateCache.reset();
+
+    cmdContainer->reset();
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.cpuWalkerBuffer = referenceWalker.get();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    EXPECT_EQ(0, memcmp(referenceWalker.get(), cachedWalker.get(), sizeof(DefaultWalkerType)));
+}
+
+HWTEST2_F(CommandEncodeStatesTest, givenDispatchTemplateCacheWhenThreadGroupCountChangesThenTemplateIsNotReused, IsAtLeastXeCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->dispatchTemplateCache = std::make_unique<DispatchTemplateCache>();
+    auto cache = dispatchInterface->dispatchTemplateCache.get();
+
+    auto walker = std::make_unique<DefaultWalkerType>();
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    dims[0] = 4;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.cpuWalkerBuffer = walker.get();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    EXPECT_EQ(0u, cache->getHitsCount());
+    EXPECT_EQ(2u, cache->getMissesCount());
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+}
+
+HWTEST2_F(CommandEncodeStatesTest, givenDispatchTemplateCacheWhenEventIsNotPassedOnSecondDispatchThenPostSyncIsNotTakenFromTemplate, IsAtLeastXeCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    using POSTSYNC_DATA = decltype(FamilyType::template getPostSyncType<DefaultWalkerType>());
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->dispatchTemplateCache = std::make_unique<DispatchTemplateCache>();
+    auto cache = dispatchInterface->dispatchTemplateCache.get();
+
+    auto walker = std::make_unique<DefaultWalkerType>();
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.postSyncArgs.eventAddress = MemoryConstants::cacheLineSize * 123;
+    dispatchArgs.postSyncArgs.isTimestampEvent = true;
+    dispatchArgs.cpuWalkerBuffer = walker.get();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(POSTSYNC_DATA::OPERATION_WRITE_TIMESTAMP, walker->getPostSync().getOperation());
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.cpuWalkerBuffer = walker.get();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    EXPECT_EQ(1u, cache->getHitsCount());
+    EXPECT_EQ(POSTSYNC_DATA::OPERATION_NO_WRITE, walker->getPostSync().getOperation());
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/cpu_copy_helper.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/stream_capture.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+void runCpuCopy(size_t size, const CpuCopyProperties &properties) {
+    std::vector<uint8_t> source(size);
+    std::vector<uint8_t> destination(size, 0u);
+    for (size_t i = 0; i < size; i++) {
+        source[i] = static_cast<uint8_t>(i * 7 + i / 4096);
+    }
+
+    cpuCopy(destination.data(), source.data(), size, properties);
+
+    EXPECT_EQ(0, memcmp(source.data(), destination.data(), size));
+}
+} // namespace
+
+TEST(CpuCopyHelperTests, givenDefaultDebugFlagsWhenGettingCpuCopyPropertiesThenSingleThreadedRegularCopyIsUsed) {
+    DebugManagerStateRestore restorer;
+
+    auto properties = getCpuCopyProperties(nullptr);
+
+    EXPECT_EQ(std::numeric_limits<size_t>::max(), properties.nonTemporalThreshold);
+    EXPECT_EQ(std::numeric_limits<size_t>::max(), properties.parallelThreshold);
+    EXPECT_EQ(1u, properties.maxThreads);
+    EXPECT_EQ(-1, properties.numaNode);
+}
+
+TEST(CpuCopyHelperTests, givenCpuCopyThreadsSetWhenGettingCpuCopyPropertiesThenDefaultParallelThresholdIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyThreads.set(4);
+
+    auto properties = getCpuCopyProperties(nullptr);
+
+    EXPECT_EQ(4u, properties.maxThreads);
+    EXPECT_EQ(64 * MemoryConstants::megaByte, properties.parallelThreshold);
+    EXPECT_EQ(-1, properties.numaNode);
+}
+
+TEST(CpuCopyHelperTests, givenCpuCopyDebugFlagsSetWhenGettingCpuCopyPropertiesThenThresholdsAreTakenInKilobytes) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyThreads.set(2);
+    debugManager.flags.CpuCopyParallelThreshold.set(1024);
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(256);
+
+    auto properties = getCpuCopyProperties(nullptr);
+
+    EXPECT_EQ(2u, properties.maxThreads);
+    EXPECT_EQ(MemoryConstants::megaByte, properties.parallelThreshold);
+    EXPECT_EQ(256 * MemoryConstants::kiloByte, properties.nonTemporalThreshold);
+}
+
+TEST(CpuCopyHelperTests, givenParallelThresholdSetWithoutCpuCopyThreadsWhenGettingCpuCopyPropertiesThenCopyIsNotSplit) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyParallelThreshold.set(0);
+
+    auto properties = getCpuCopyProperties(nullptr);
+
+    EXPECT_EQ(1u, properties.maxThreads);
+    EXPECT_EQ(std::numeric_limits<size_t>::max(), properties.parallelThreshold);
+}
+
+TEST(CpuCopyHelperTests, givenDefaultPropertiesWhenCopyingThenDataIsCopied) {
+    runCpuCopy(MemoryConstants::pageSize + 13u, {});
+}
+
+TEST(CpuCopyHelperTests, givenNonTemporalThresholdReachedWhenCopyingThenDataIsCopied) {
+    CpuCopyProperties properties{};
+    properties.nonTemporalThreshold = MemoryConstants::pageSize;
+
+    runCpuCopy(MemoryConstants::pageSize - 1u, properties);
+    runCpuCopy(MemoryConstants::pageSize + 13u, properties);
+}
+
+TEST(CpuCopyHelperTests, givenParallelThresholdReachedWhenCopyingThenDataIsCopied) {
+    CpuCopyProperties properties{};
+    properties.parallelThreshold = 0u;
+    properties.maxThreads = 4u;
+
+    runCpuCopy(4 * MemoryConstants::megaByte + 123u, properties);
+
+    properties.nonTemporalThreshold = 0u;
+    runCpuCopy(3 * MemoryConstants::megaByte - 5u, properties);
+}
+
+TEST(CpuCopyHelperTests, givenPrintCpuCopyBandwidthWhenSplittingCopyThenThreadsAndStoreTypeArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintCpuCopyBandwidth.set(true);
+
+    CpuCopyProperties properties{};
+    properties.parallelThreshold = 0u;
+    properties.nonTemporalThreshold = 0u;
+    properties.maxThreads = 8u;
+
+    StreamCapture capture;
+    capture.captureStdout();
+    runCpuCopy(4 * MemoryConstants::megaByte + 123u, properties);
+    auto output = capture.getCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("CPU copy: 4194427 bytes, 4 threads, non-temporal stores"));
+    EXPECT_NE(std::string::npos, output.find("GB/s"));
+}
+
+TEST(CpuCopyHelperTests, givenPrintCpuCopyBandwidthWhenCopyIsBelowThresholdsThenSingleThreadAndRegularStoresArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintCpuCopyBandwidth.set(true);
+
+    CpuCopyProperties properties{};
+    properties.maxThreads = 8u;
+
+    StreamCapture capture;
+    capture.captureStdout();
+    runCpuCopy(2 * MemoryConstants::megaByte, properties);
+    auto output = capture.getCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("CPU copy: 2097152 bytes, 1 threads, regular stores"));
+}
+
+TEST(CpuCopyHelperTests, givenNegativeNumaNodeWhenPinningThreadThenFalseIsReturned) {
+    EXPECT_FALSE(pinCurrentThreadToNumaNode(-1));
+}
@@ -1,16 +1,21 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/cpu_copy_helper.h"
+#include "shared/source/os_interface/linux/numa_library.h"
+#include "shared/source/os_interface/linux/os_inc.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/linux/drm_mock.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_os_library.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 #include "shared/test/common/os_interface/linux/drm_mock_memory_info.h"
 
 #include "drm_neo.h"
@@ -42,6 +47,40 @@ class MockOSInterface : public OSInterface {
     void setDriverModel(DriverModel *driverModel) { this->driverModel.reset(driverModel); }
 };
 
+struct WhiteBoxCpuCopyNumaLibrary : Linux::NumaLibrary {
+    using Linux::NumaLibrary::maxNode;
+    using Linux::NumaLibrary::numaInitAttempted;
+    using Linux::NumaLibrary::numaLoaded;
+    using Linux::NumaLibrary::numaRunOnNodeFunction;
+    using Linux::NumaLibrary::osLibrary;
+};
+
+namespace {
+std::string_view numaNodeContent = "1\n";
+
+void setDrmWithNumaNodeInSysFs(MockOSInterface &osIface, RootDeviceEnvironment &rootEnv) {
+    auto drm = new DrmMock(rootEnv);
+    drm->setPciPath("device");
+    osIface.setDriverModel(drm);
+}
+
+int mockNumaNodeOpen(const char *pathname, int flags) {
+    return std::string(pathname) == std::string(Os::sysFsPciPathPrefix) + "device/drm/card1/device/numa_node" ? 1 : -1;
+}
+
+ssize_t mockNumaNodePread(int fd, void *buf, size_t count, off_t offset) {
+    memcpy_s(buf, count, numaNodeContent.data(), numaNodeContent.size());
+    return numaNodeContent.size();
+}
+
+uint32_t numaLibraryLoadCalled = 0u;
+
+OsLibrary *mockNumaLibraryLoadFailure(const OsLibraryCreateProperties &properties) {
+    numaLibraryLoadCalled++;
+    return nullptr;
+}
+} // namespace
+
 TEST(CpuCopyHelperTests, givenNullOsInterfaceWhenCheckingSmallBarConfigThenReturnsFalse) {
     EXPECT_FALSE(isSmallBarConfigPresent(nullptr));
 }
@@ -92,3 +131,97 @@ TEST(CpuCopyHelperTests, givenDrmWithMemoryInfoWhenSmallBarDetectedReturnsFalse)
     osIface.setDriverModel(drm.release());
     EXPECT_FALSE(isSmallBarConfigPresent(&osIface));
 }
+
+TEST(CpuCopyHelperTests, givenNullOsInterfaceWhenGettingDeviceNumaNodeThenMinusOneIsReturned) {
+    EXPECT_EQ(-1, getDeviceNumaNode(nullptr));
+}
+
+TEST(CpuCopyHelperTests, givenNonDrmDriverModelWhenGettingDeviceNumaNodeThenMinusOneIsReturned) {
+    MockOSInterface osIface;
+    osIface.setDriverModel(new MockSmallBarConfigNonDrm());
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+}
+
+TEST(CpuCopyHelperTests, givenNumaNodeInSysFsAndNumaLibraryLoadedWhenGettingDeviceNumaNodeThenNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    MockOSInterface osIface;
+    setDrmWithNumaNodeInSysFs(osIface, *executionEnvironment->rootDeviceEnvironments[0]);
+
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> openBackup(&SysCalls::sysCallsOpen, mockNumaNodeOpen);
+    VariableBackup<decltype(SysCalls::sysCallsPread)> preadBackup(&SysCalls::sysCallsPread, mockNumaNodePread);
+    VariableBackup<bool> numaLoadedBackup(&WhiteBoxCpuCopyNumaLibrary::numaLoaded, true);
+    VariableBackup<bool> numaInitAttemptedBackup(&WhiteBoxCpuCopyNumaLibrary::numaInitAttempted, true);
+
+    EXPECT_EQ(1, getDeviceNumaNode(&osIface));
+
+    VariableBackup<std::string_view> contentBackup(&numaNodeContent, "-1\n");
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+}
+
+TEST(CpuCopyHelperTests, givenNumaNodeInSysFsButNumaLibraryNotAvailableWhenGettingDeviceNumaNodeThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    MockOSInterface osIface;
+    setDrmWithNumaNodeInSysFs(osIface, *executionEnvironment->rootDeviceEnvironments[0]);
+
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> openBackup(&SysCalls::sysCallsOpen, mockNumaNodeOpen);
+    VariableBackup<decltype(SysCalls::sysCallsPread)> preadBackup(&SysCalls::sysCallsPread, mockNumaNodePread);
+    VariableBackup<bool> numaLoadedBackup(&WhiteBoxCpuCopyNumaLibrary::numaLoaded, false);
+    VariableBackup<bool> numaInitAttemptedBackup(&WhiteBoxCpuCopyNumaLibrary::numaInitAttempted, false);
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> loadFuncBackup{&NEO::OsLibrary::loadFunc, MockOsLibrary::load};
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+    WhiteBoxCpuCopyNumaLibrary::osLibrary.reset();
+}
+
+TEST(CpuCopyHelperTests, givenNumaLibraryNotAvailableWhenGettingDeviceNumaNodeRepeatedlyThenNumaLibraryIsNotReloaded) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    MockOSInterface osIface;
+    setDrmWithNumaNodeInSysFs(osIface, *executionEnvironment->rootDeviceEnvironments[0]);
+
+    numaLibraryLoadCalled = 0u;
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> openBackup(&SysCalls::sysCallsOpen, mockNumaNodeOpen);
+    VariableBackup<decltype(SysCalls::sysCallsPread)> preadBackup(&SysCalls::sysCallsPread, mockNumaNodePread);
+    VariableBackup<bool> numaLoadedBackup(&WhiteBoxCpuCopyNumaLibrary::numaLoaded, false);
+    VariableBackup<bool> numaInitAttemptedBackup(&WhiteBoxCpuCopyNumaLibrary::numaInitAttempted, false);
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> loadFuncBackup{&NEO::OsLibrary::loadFunc, mockNumaLibraryLoadFailure};
+
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+    EXPECT_EQ(1u, numaLibraryLoadCalled);
+
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+    EXPECT_EQ(-1, getDeviceNumaNode(&osIface));
+    EXPECT_EQ(1u, numaLibraryLoadCalled);
+    WhiteBoxCpuCopyNumaLibrary::osLibrary.reset();
+}
+
+TEST(CpuCopyHelperTests, givenNumaLibraryLoadedWhenPinningThreadToNumaNodeThenNumaRunOnNodeIsCalled) {
+    static int requestedNode = -1;
+    requestedNode = -1;
+    VariableBackup<bool> numaLoadedBackup(&WhiteBoxCpuCopyNumaLibrary::numaLoaded, true);
+    VariableBackup<int> maxNodeBackup(&WhiteBoxCpuCopyNumaLibrary::maxNode, 1);
+    VariableBackup<decltype(WhiteBoxCpuCopyNumaLibrary::numaRunOnNodeFunction)> runOnNodeBackup(&WhiteBoxCpuCopyNumaLibrary::numaRunOnNodeFunction, [](int node) -> int {
+        requestedNode = node;
+        return 0;
+    });
+
+    EXPECT_FALSE(pinCurrentThreadToNumaNode(-1));
+    EXPECT_EQ(-1, requestedNode);
+
+    EXPECT_TRUE(pinCurrentThreadToNumaNode(1));
+    EXPECT_EQ(1, requestedNode);
+}
+
+TEST(CpuCopyHelperTests, givenNumaLibraryLoadedWhenUnpinningThreadThenThreadIsAllowedToRunOnAllNodes) {
+    static int requestedNode = 0;
+    requestedNode = 0;
+    VariableBackup<bool> numaLoadedBackup(&WhiteBoxCpuCopyNumaLibrary::numaLoaded, true);
+    VariableBackup<int> maxNodeBackup(&WhiteBoxCpuCopyNumaLibrary::maxNode, 1);
+    VariableBackup<decltype(WhiteBoxCpuCopyNumaLibrary::numaRunOnNodeFunction)> runOnNodeBackup(&WhiteBoxCpuCopyNumaLibrary::numaRunOnNodeFunction, [](int node) -> int {
+        requestedNode = node;
+        return 0;
+    });
+
+    EXPECT_TRUE(unpinCurrentThreadFromNumaNode());
+    EXPECT_EQ(-1, requestedNode);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,3 +13,8 @@ TEST(CpuCopyHelperTests, givenWindowsWhenCheckingForSmallBarThenFalseIsReturned)
     EXPECT_FALSE(NEO::isSmallBarConfigPresent(nullptr));
     EXPECT_FALSE(NEO::isSmallBarConfigPresent(reinterpret_cast<NEO::OSInterface *>(0x1234)));
 }
+
+TEST(CpuCopyHelperTests, givenWindowsWhenGettingDeviceNumaNodeThenNodeIsUnknownAndThreadIsNotPinned) {
+    EXPECT_EQ(-1, NEO::getDeviceNumaNode(reinterpret_cast<NEO::OSInterface *>(0x1234)));
+    EXPECT_FALSE(NEO::pinCurrentThreadToNumaNode(0));
+}
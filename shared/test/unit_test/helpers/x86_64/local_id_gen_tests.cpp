@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+namespace NEO {
+struct uint16x8_t;
+struct uint16x16_t;
+struct uint16x32_t;
+} // namespace NEO
+
+using namespace NEO;
+
+namespace {
+using GenerateLocalIdsFn = void (*)(void *, const std::array<uint16_t, 3> &, uint16_t, const std::array<uint8_t, 3> &, bool, uint8_t);
+
+constexpr std::array<std::array<uint8_t, 3>, 6> walkOrders = {{{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+
+constexpr std::array<std::array<uint16_t, 3>, 8> localWorkgroupSizes = {{{1, 1, 1},
+                                                                         {7, 3, 2},
+                                                                         {16, 1, 1},
+                                                                         {33, 2, 1},
+                                                                         {64, 4, 4},
+                                                                         {5, 6, 7},
+                                                                         {1024, 1, 1},
+                                                                         {8, 8, 16}}};
+
+GenerateLocalIdsFn getGenericGenerator(uint32_t simd) {
+    return simd == 32   ? generateLocalIDsSimd<uint16x8_t, 32>
+           : simd == 16 ? generateLocalIDsSimd<uint16x8_t, 16>
+                        : generateLocalIDsSimd<uint16x8_t, 8>;
+}
+
+GenerateLocalIdsFn getDispatchedGenerator(uint32_t simd) {
+    return simd == 32   ? LocalIDHelper::generateSimd32
+           : simd == 16 ? LocalIDHelper::generateSimd16
+                        : LocalIDHelper::generateSimd8;
+}
+
+void expectSameLocalIds(GenerateLocalIdsFn generator, uint32_t simd, bool chooseMaxRowSize) {
+    for (const auto &localWorkgroupSize : localWorkgroupSizes) {
+        const auto lws = static_cast<uint32_t>(localWorkgroupSize[0] * localWorkgroupSize[1] * localWorkgroupSize[2]);
+        const auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, lws));
+        const size_t rowSize = ((simd == 32 || chooseMaxRowSize) ? 32 : 16) * sizeof(uint16_t);
+        const size_t bufferSize = threadsPerWorkGroup * 3 * rowSize;
+
+        auto expected = static_cast<uint8_t *>(alignedMalloc(bufferSize, 64));
+        auto actual = static_cast<uint8_t *>(alignedMalloc(bufferSize, 64));
+
+        for (const auto &walkOrder : walkOrders) {
+            for (uint8_t activeChannels = 1; activeChannels <= 3; activeChannels++) {
+                memset(expected, 0xcd, bufferSize);
+                memset(actual, 0xcd, bufferSize);
+
+                getGenericGenerator(simd)(expected, localWorkgroupSize, threadsPerWorkGroup, walkOrder, chooseMaxRowSize, activeChannels);
+                generator(actual, localWorkgroupSize, threadsPerWorkGroup, walkOrder, chooseMaxRowSize, activeChannels);
+
+                EXPECT_EQ(0, memcmp(expected, actual, bufferSize))
+                    << "simd " << simd << ", lws " << localWorkgroupSize[0] << "x" << localWorkgroupSize[1] << "x" << localWorkgroupSize[2]
+                    << ", walk order " << int(walkOrder[0]) << int(walkOrder[1]) << int(walkOrder[2])
+                    << ", active channels " << int(activeChannels) << ", max row size " << chooseMaxRowSize;
+            }
+        }
+
+        alignedFree(expected);
+        alignedFree(actual);
+    }
+}
+} // namespace
+
+using LocalIdGenDispatchTest = ::testing::TestWithParam<std::tuple<uint32_t, bool>>;
+
+TEST_P(LocalIdGenDispatchTest, givenCpuSelectedGeneratorWhenGeneratingLocalIdsThenResultMatchesGenericGenerator) {
+    const auto [simd, chooseMaxRowSize] = GetParam();
+    expectSameLocalIds(getDispatchedGenerator(simd), simd, chooseMaxRowSize);
+}
+
+TEST_P(LocalIdGenDispatchTest, givenAvx2SupportedWhenGeneratingLocalIdsWithAvx2ThenResultMatchesGenericGenerator) {
+    const auto [simd, chooseMaxRowSize] = GetParam();
+    if (simd == 8 || !CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        GTEST_SKIP();
+    }
+    expectSameLocalIds(simd == 32 ? generateLocalIDsSimd<uint16x16_t, 32> : generateLocalIDsSimd<uint16x16_t, 16>, simd, chooseMaxRowSize);
+}
+
+TEST_P(LocalIdGenDispatchTest, givenAvx512BwSupportedWhenGeneratingLocalIdsWithAvx512ThenResultMatchesGenericGenerator) {
+    const auto [simd, chooseMaxRowSize] = GetParam();
+    if (simd != 32 || !CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512BW)) {
+        GTEST_SKIP();
+    }
+    expectSameLocalIds(generateLocalIDsSimd<uint16x32_t, 32>, simd, chooseMaxRowSize);
+}
+
+TEST(LocalIdGenTest, givenAvx512BwSupportedWhenLocalIdHelperIsInitializedThenAvx512GeneratorIsUsedForSimd32) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512BW)) {
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(static_cast<GenerateLocalIdsFn>(generateLocalIDsSimd<uint16x32_t, 32>), LocalIDHelper::generateSimd32);
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdAndGrfSize, LocalIdGenDispatchTest, ::testing::Combine(::testing::Values(8u, 16u, 32u), ::testing::Bool()));
@@ -146,6 +146,20 @@ constexpr HwPath hwPaths[] = {
     {&NEO::streamCopyImpl<false>, &hwSupportsAvx2},
     {&NEO::streamCopyImpl<true>, &hwSupportsAvx512}};
 
+constexpr HwPath nonTemporalPaths[] = {
+    {&NEO::streamCopyNonTemporalImpl<false>, &hwSupportsAvx2},
+    {&NEO::streamCopyNonTemporalImpl<true>, &hwSupportsAvx512}};
+
+constexpr size_t nonTemporalSizes[] = {
+    0u, 15u, 31u, 64u, 127u, 4096u + 33u};
+
+constexpr AlignmentCase nonTemporalAlignmentCases[] = {
+    {0u, 0u},
+    {1u, 0u},
+    {0u, 1u},
+    {NEO::streamCopyAvx2Width, 5u},
+    {3u, NEO::streamCopyAvx2Width + 7u}};
+
 constexpr HwPath writeCombinedPaths[] = {
     {&NEO::streamCopyImpl<false, true>, &hwSupportsAvx2},
     {&NEO::streamCopyImpl<false, false>, &hwSupportsAvx2},
@@ -303,3 +317,41 @@ INSTANTIATE_TEST_SUITE_P(
     StreamCopyWriteCombinedTest,
     ::testing::Combine(::testing::ValuesIn(writeCombinedPaths),
                        ::testing::ValuesIn(streamingSizes)));
+
+using StreamCopyNonTemporalPathTest = ::testing::TestWithParam<std::tuple<HwPath, size_t, AlignmentCase>>;
+
+TEST_P(StreamCopyNonTemporalPathTest, givenAnyAlignmentThenDataCopiedCorrectly) {
+    const auto &[path, size, alignment] = GetParam();
+    if (!path.hwSupported()) {
+        GTEST_SKIP() << "AVX feature not supported by this CPU/OS";
+    }
+    runCopyTest(path.copyFn, size, alignment);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    StreamCopy,
+    StreamCopyNonTemporalPathTest,
+    ::testing::Combine(::testing::ValuesIn(nonTemporalPaths),
+                       ::testing::ValuesIn(nonTemporalSizes),
+                       ::testing::ValuesIn(nonTemporalAlignmentCases)));
+
+struct StreamCopyNonTemporalDispatchTest : public ::testing::TestWithParam<std::tuple<uint64_t, size_t>>,
+                                           public StreamCopyDispatchFixture {
+    void SetUp() override { StreamCopyDispatchFixture::setUp(); }
+    void TearDown() override { StreamCopyDispatchFixture::tearDown(); }
+};
+
+TEST_P(StreamCopyNonTemporalDispatchTest, givenUnalignedBuffersThenDataCopiedCorrectly) {
+    const auto &[feature, size] = GetParam();
+    if (!hwSupportsFeature(feature)) {
+        GTEST_SKIP() << "AVX feature not supported by this CPU/OS";
+    }
+    forceFeatures(feature);
+    runCopyTest(&NEO::streamCopyNonTemporal, size, {1u, 3u});
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    StreamCopy,
+    StreamCopyNonTemporalDispatchTest,
+    ::testing::Combine(::testing::ValuesIn(possibleFeatures),
+                       ::testing::ValuesIn(dispatchSizes)));
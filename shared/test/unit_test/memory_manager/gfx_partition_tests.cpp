@@ -11,6 +11,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 #include "shared/test/common/mocks/mock_product_helper.h"
@@ -619,6 +620,56 @@ TEST_P(GfxPartitionTestForAllHeapTypes, givenHeapIndexWhenHeapAllocateWithStartA
     EXPECT_EQ(requiredStartAddress, gfxPartition.heapAllocateWithStartAddressHint(requiredStartAddress, heapIndex, sizeToAllocate));
 }
 
+TEST_P(GfxPartitionTestForAllHeapTypes, givenSizeClassHeapAllocatorEnabledWhenAllocatingWithStartAddressHintAndFreeingThenHeapIsReusable) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UseSizeClassHeapAllocator.set(std::numeric_limits<int32_t>::max());
+    MockGfxPartition gfxPartition;
+
+    uint64_t gfxTop = maxNBitValue(48) + 1;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u, gfxTop, nullptr);
+    gfxPartition.callBasefreeGpuAddressRange = true;
+    const HeapIndex heapIndex = GetParam();
+    EXPECT_TRUE(gfxPartition.isSizeClassAllocatorUsed(heapIndex));
+
+    const size_t allocationSize = static_cast<size_t>(gfxPartition.getHeapSize(heapIndex)) * 3 / 4;
+    if (allocationSize == 0) {
+        GTEST_SKIP();
+    }
+    if (is32bit) {
+        auto it = std::find(GfxPartition::heap32Names.begin(), GfxPartition::heap32Names.end(), heapIndex);
+        auto is64bitHeap = it == GfxPartition::heap32Names.end();
+        if (is64bitHeap) {
+            GTEST_SKIP();
+        }
+    }
+
+    const auto heapGranularity = (heapIndex == HeapIndex::heapStandard2MB) ? GfxPartition::heapGranularity2MB : GfxPartition::heapGranularity;
+    auto requiredStartAddress = gfxPartition.getHeapMinimalAddress(heapIndex) + heapGranularity;
+    size_t sizeToAllocate = allocationSize;
+    auto address = gfxPartition.heapAllocateWithStartAddressHint(requiredStartAddress, heapIndex, sizeToAllocate);
+    const size_t sizeAllocated = sizeToAllocate;
+    EXPECT_EQ(requiredStartAddress, address);
+
+    sizeToAllocate = allocationSize;
+    EXPECT_EQ(0ull, gfxPartition.heapAllocate(heapIndex, sizeToAllocate));
+
+    gfxPartition.freeGpuAddressRange(address, sizeAllocated);
+    sizeToAllocate = allocationSize;
+    address = gfxPartition.heapAllocate(heapIndex, sizeToAllocate);
+    EXPECT_NE(0ull, address);
+    gfxPartition.heapFree(heapIndex, address, sizeToAllocate);
+}
+
+TEST(GfxPartitionTest, givenSizeClassHeapAllocatorMaskWhenGfxPartitionIsCreatedThenOnlySelectedHeapsUseSizeClassAllocator) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UseSizeClassHeapAllocator.set(1 << static_cast<uint32_t>(HeapIndex::heapStandard64KB));
+    MockGfxPartition gfxPartition;
+
+    EXPECT_TRUE(gfxPartition.isSizeClassAllocatorUsed(HeapIndex::heapStandard64KB));
+    EXPECT_FALSE(gfxPartition.isSizeClassAllocatorUsed(HeapIndex::heapStandard));
+    EXPECT_FALSE(gfxPartition.isSizeClassAllocatorUsed(HeapIndex::heapSvm));
+}
+
 TEST_P(GfxPartitionTestForAllHeapTypes, GivenHeapAndAddressInGfxPartitionThenIsAddressInHeapRangeCorrectlyReturns) {
     MockGfxPartition gfxPartition;
 
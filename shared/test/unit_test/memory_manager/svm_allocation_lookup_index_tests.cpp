@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/svm_allocation_lookup_index.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace NEO;
+
+struct MockSvmAllocationLookupIndex : public SvmAllocationLookupIndex {
+    using SvmAllocationLookupIndex::globalEpoch;
+    using SvmAllocationLookupIndex::readerSlotPool;
+};
+
+struct SvmAllocationLookupIndexTest : public ::testing::Test {
+    void *insertAllocation(uintptr_t address, size_t size) {
+        SvmAllocationData allocData(1u);
+        allocData.size = size;
+        auto ptr = reinterpret_cast<void *>(address);
+        allocations.insert(ptr, allocData);
+        return ptr;
+    }
+
+    BaseSortedPointerWithValueVector<SvmAllocationData> allocations;
+    MockSvmAllocationLookupIndex lookupIndex;
+};
+
+TEST_F(SvmAllocationLookupIndexTest, givenNoPublishedSnapshotWhenFindIsCalledThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, lookupIndex.find(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(nullptr, lookupIndex.find(nullptr));
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenPublishedAllocationsWhenFindIsCalledWithBaseOrOffsetPointerThenOwningAllocationIsReturned) {
+    auto ptr1 = insertAllocation(0x10000, 0x1000);
+    auto ptr2 = insertAllocation(0x20000, 0x2000);
+    lookupIndex.publish(allocations, nullptr);
+
+    auto data1 = allocations.get(ptr1);
+    auto data2 = allocations.get(ptr2);
+
+    EXPECT_EQ(data1, lookupIndex.find(ptr1));
+    EXPECT_EQ(data1, lookupIndex.find(ptrOffset(ptr1, 0xfff)));
+    EXPECT_EQ(data2, lookupIndex.find(ptr2));
+    EXPECT_EQ(data2, lookupIndex.find(ptrOffset(ptr2, 0x1000)));
+
+    EXPECT_EQ(nullptr, lookupIndex.find(reinterpret_cast<void *>(0x8000)));
+    EXPECT_EQ(nullptr, lookupIndex.find(ptrOffset(ptr1, 0x1000)));
+    EXPECT_EQ(nullptr, lookupIndex.find(ptrOffset(ptr2, 0x2000)));
+    EXPECT_EQ(nullptr, lookupIndex.find(nullptr));
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenAllocationSizeChangedInPlaceWhenFindIsCalledThenCurrentSizeIsHonored) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    auto data = allocations.get(ptr);
+
+    EXPECT_EQ(data, lookupIndex.find(ptrOffset(ptr, 0x800)));
+
+    data->size = 0x400;
+    EXPECT_EQ(nullptr, lookupIndex.find(ptrOffset(ptr, 0x800)));
+
+    data->size = 0x2000;
+    EXPECT_EQ(data, lookupIndex.find(ptrOffset(ptr, 0x1800)));
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenAllocationResolvedByThreadWhenAllocationIsRemovedThenItIsNotReturnedFromLastHit) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+
+    const auto generation = lookupIndex.getRemovalGeneration();
+    lookupIndex.publish(allocations, allocations.extract(ptr));
+    EXPECT_EQ(generation + 1, lookupIndex.getRemovalGeneration());
+
+    EXPECT_EQ(nullptr, lookupIndex.find(ptr));
+    EXPECT_EQ(nullptr, lookupIndex.find(ptrOffset(ptr, 0x10)));
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenNoActiveReadersWhenSnapshotIsReplacedThenRetiredSnapshotsAreReleased) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+
+    insertAllocation(0x20000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    lookupIndex.publish(allocations, allocations.extract(ptr));
+
+    EXPECT_EQ(0u, lookupIndex.getRetiredSnapshotsCount());
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenReaderInsideReadSectionWhenSnapshotIsReplacedThenRetiredSnapshotIsKeptUntilReaderLeaves) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+    ASSERT_EQ(1u, lookupIndex.readerSlotPool->slots.size());
+
+    auto &readerSlot = *lookupIndex.readerSlotPool->slots[0];
+    readerSlot.activeEpoch.store(lookupIndex.globalEpoch.load());
+
+    lookupIndex.publish(allocations, allocations.extract(ptr));
+    EXPECT_EQ(1u, lookupIndex.getRetiredSnapshotsCount());
+
+    readerSlot.activeEpoch.store(0u);
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_EQ(0u, lookupIndex.getRetiredSnapshotsCount());
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenRetiredSnapshotKeptForReaderWhenAnyReaderLeavesReadSectionLaterThenRetiredSnapshotIsReleasedWithoutPublish) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    auto otherPtr = insertAllocation(0x20000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+
+    std::thread([&] { EXPECT_NE(nullptr, lookupIndex.find(otherPtr)); }).join();
+    ASSERT_EQ(2u, lookupIndex.readerSlotPool->slots.size());
+    auto &otherReaderSlot = *lookupIndex.readerSlotPool->slots[1];
+    otherReaderSlot.activeEpoch.store(lookupIndex.globalEpoch.load());
+
+    lookupIndex.publish(allocations, allocations.extract(ptr));
+    EXPECT_EQ(1u, lookupIndex.getRetiredSnapshotsCount());
+
+    EXPECT_NE(nullptr, lookupIndex.find(otherPtr));
+    EXPECT_EQ(1u, lookupIndex.getRetiredSnapshotsCount());
+
+    otherReaderSlot.activeEpoch.store(0u);
+    EXPECT_NE(nullptr, lookupIndex.find(otherPtr));
+    EXPECT_EQ(0u, lookupIndex.getRetiredSnapshotsCount());
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenReaderThreadsExitingWhenNewThreadsReadThenReaderSlotsAreReused) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+
+    for (auto i = 0u; i < 4u; i++) {
+        std::thread([&] { EXPECT_NE(nullptr, lookupIndex.find(ptr)); }).join();
+    }
+    ASSERT_EQ(1u, lookupIndex.readerSlotPool->slots.size());
+    EXPECT_FALSE(lookupIndex.readerSlotPool->slots[0]->claimed.load());
+
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+    EXPECT_EQ(1u, lookupIndex.readerSlotPool->slots.size());
+    EXPECT_TRUE(lookupIndex.readerSlotPool->slots[0]->claimed.load());
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenDestroyedIndexWhenThreadReadsFromNewIndexThenSlotOfDestroyedIndexIsDropped) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    std::weak_ptr<SvmAllocationLookupIndex::ReaderSlotPool> destroyedIndexSlotPool;
+    {
+        auto destroyedIndex = std::make_unique<MockSvmAllocationLookupIndex>();
+        destroyedIndex->publish(allocations, nullptr);
+        EXPECT_NE(nullptr, destroyedIndex->find(ptr));
+        destroyedIndexSlotPool = destroyedIndex->readerSlotPool;
+    }
+    EXPECT_FALSE(destroyedIndexSlotPool.expired());
+
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_NE(nullptr, lookupIndex.find(ptr));
+    EXPECT_TRUE(destroyedIndexSlotPool.expired());
+}
+
+TEST_F(SvmAllocationLookupIndexTest, givenTwoIndicesWhenFindIsCalledFromSameThreadThenEachIndexResolvesOwnAllocations) {
+    auto ptr = insertAllocation(0x10000, 0x1000);
+    lookupIndex.publish(allocations, nullptr);
+
+    BaseSortedPointerWithValueVector<SvmAllocationData> otherAllocations;
+    SvmAllocationData otherData(1u);
+    otherData.size = 0x1000;
+    auto otherPtr = reinterpret_cast<void *>(0x40000);
+    otherAllocations.insert(otherPtr, otherData);
+    SvmAllocationLookupIndex otherLookupIndex;
+    otherLookupIndex.publish(otherAllocations, nullptr);
+
+    EXPECT_EQ(allocations.get(ptr), lookupIndex.find(ptr));
+    EXPECT_EQ(nullptr, otherLookupIndex.find(ptr));
+    EXPECT_EQ(otherAllocations.get(otherPtr), otherLookupIndex.find(otherPtr));
+    EXPECT_EQ(nullptr, lookupIndex.find(otherPtr));
+}
+
+TEST(SvmAllocsManagerLookupIndexTest, givenLockFreeLookupDisabledByDefaultWhenSvmManagerIsCreatedThenLookupIndexIsNotCreated) {
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockSVMAllocsManager svmManager(&memoryManager);
+    EXPECT_EQ(nullptr, svmManager.lookupIndex.get());
+}
+
+using SvmAllocsManagerLookupIndexFixtureTest = Test<SVMMemoryAllocatorFixture<false, 1u>>;
+
+TEST_F(SvmAllocsManagerLookupIndexFixtureTest, givenLockFreeLookupEnabledWhenAllocationsAreCreatedAndFreedThenLookupIndexMatchesContainer) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableLockFreeSvmAllocLookup.set(1);
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get());
+    ASSERT_NE(nullptr, svmManager->lookupIndex.get());
+
+    UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr1 = svmManager->createHostUnifiedMemoryAllocation(4096, unifiedMemoryProperties);
+    auto ptr2 = svmManager->createHostUnifiedMemoryAllocation(4096, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr1);
+    ASSERT_NE(nullptr, ptr2);
+
+    auto svmData1 = svmManager->getSVMAlloc(ptr1);
+    ASSERT_NE(nullptr, svmData1);
+    EXPECT_EQ(svmManager->svmAllocs.get(ptr1), svmData1);
+    EXPECT_EQ(svmData1, svmManager->getSVMAlloc(ptrOffset(ptr1, 100)));
+    EXPECT_EQ(svmManager->svmAllocs.get(ptr2), svmManager->getSVMAlloc(ptr2));
+
+    svmManager->freeSVMAlloc(ptr1);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr1));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr1, 100)));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr2));
+
+    svmManager->freeSVMAlloc(ptr2);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr2));
+    EXPECT_EQ(0u, svmManager->lookupIndex->getRetiredSnapshotsCount());
+}
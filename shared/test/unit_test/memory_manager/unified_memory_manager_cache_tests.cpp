@@ -124,6 +124,22 @@ TEST(SvmAllocationCacheSimpleTest, givenDifferentSizesWhenCheckingIfSizeAllowsTh
     EXPECT_FALSE(SVMAllocsManager::SvmAllocationCache::sizeAllowed(256 * MemoryConstants::megaByte + 1));
 }
 
+TEST(SvmAllocationCacheSimpleTest, givenDifferentSizesWhenGettingSizeBucketIndexThenPowerOfTwoBucketIsReturned) {
+    using SvmAllocationCache = SVMAllocsManager::SvmAllocationCache;
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeBucketIndex(0u));
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeBucketIndex(1u));
+    EXPECT_EQ(1u, SvmAllocationCache::getSizeBucketIndex(2u));
+    EXPECT_EQ(16u, SvmAllocationCache::getSizeBucketIndex(MemoryConstants::pageSize64k));
+    EXPECT_EQ(17u, SvmAllocationCache::getSizeBucketIndex(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(SvmAllocationCache::sizeBucketsCount - 1, SvmAllocationCache::getSizeBucketIndex(SvmAllocationCache::maxServicedSize));
+
+    for (uint32_t bucketIndex = 1u; bucketIndex < SvmAllocationCache::sizeBucketsCount; bucketIndex++) {
+        const auto minimalSize = SvmAllocationCache::getSizeBucketMinimalSize(bucketIndex);
+        EXPECT_EQ(bucketIndex, SvmAllocationCache::getSizeBucketIndex(minimalSize));
+        EXPECT_EQ(bucketIndex - 1, SvmAllocationCache::getSizeBucketIndex(minimalSize - 1));
+    }
+}
+
 TEST(SvmAllocationCacheSimpleTest, givenSvmAllocationCacheInfoWhenMarkedForDeleteThenSetSizeToZero) {
     SVMAllocsManager::SvmCacheAllocationInfo info(MemoryConstants::pageSize64k, nullptr, nullptr, false);
     EXPECT_FALSE(SVMAllocsManager::SvmCacheAllocationInfo::isMarkedForDelete(info));
@@ -1403,6 +1419,142 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsInReuseWhenTrimOldAllocsCal
     svmManager->cleanupUSMAllocCaches();
 }
 
+TEST_F(SvmDeviceAllocationCacheTest, givenSizeBucketsEnabledWhenAllocatingAfterFreeThenAllocationsAreReusedFromSizeBuckets) {
+    auto deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUSMAllocationReuseSizeBuckets.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager());
+    device->usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_NE(nullptr, svmManager->usmDeviceAllocationsCache);
+    auto cache = svmManager->usmDeviceAllocationsCache.get();
+    ASSERT_NE(nullptr, cache->sizeBuckets);
+
+    auto unifiedMemoryProperties = createMemoryProperties(InternalMemoryType::deviceUnifiedMemory, device);
+    auto allocation = svmManager->createUnifiedMemoryAllocation(1 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation3 = svmManager->createUnifiedMemoryAllocation(3 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    ASSERT_NE(nullptr, allocation2);
+    ASSERT_NE(nullptr, allocation3);
+    EXPECT_TRUE(cache->isEmpty());
+
+    svmManager->freeSVMAlloc(allocation);
+    svmManager->freeSVMAlloc(allocation2);
+    svmManager->freeSVMAlloc(allocation3);
+    EXPECT_EQ(3u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE(cache->allocations.empty());
+    EXPECT_FALSE(cache->isEmpty());
+    EXPECT_EQ(allocation, (*cache->sizeBuckets)[16].allocations.peekHead()->info.allocation);
+    EXPECT_EQ(allocation2, (*cache->sizeBuckets)[17].allocations.peekHead()->info.allocation);
+    EXPECT_EQ(allocation3, (*cache->sizeBuckets)[18].allocations.peekHead()->info.allocation);
+
+    auto reusedAllocation2 = svmManager->createUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation2, reusedAllocation2);
+    EXPECT_EQ(2u, cache->sizeBucketsAllocationsCount);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->getSVMAlloc(reusedAllocation2)->size);
+
+    auto reusedAllocation = svmManager->createUnifiedMemoryAllocation(1 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, reusedAllocation);
+
+    auto reusedAllocation3 = svmManager->createUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation3, reusedAllocation3);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->getSVMAlloc(reusedAllocation3)->size);
+    EXPECT_EQ(0u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE(cache->isEmpty());
+
+    svmManager->freeSVMAlloc(reusedAllocation);
+    svmManager->freeSVMAlloc(reusedAllocation2);
+    svmManager->freeSVMAlloc(reusedAllocation3);
+    EXPECT_EQ(3u, cache->sizeBucketsAllocationsCount);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE(cache->isEmpty());
+    EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
+
+    svmManager->cleanupUSMAllocCaches();
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenSizeBucketsEnabledWhenAllocatingAfterFreeThenLimitMemoryWastage) {
+    auto deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUSMAllocationReuseSizeBuckets.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager());
+    device->usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_NE(nullptr, svmManager->usmDeviceAllocationsCache);
+    auto cache = svmManager->usmDeviceAllocationsCache.get();
+
+    auto unifiedMemoryProperties = createMemoryProperties(InternalMemoryType::deviceUnifiedMemory, device);
+    auto allocation = svmManager->createUnifiedMemoryAllocation(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(1u, cache->sizeBucketsAllocationsCount);
+
+    auto notReusedAllocation = svmManager->createUnifiedMemoryAllocation(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization / 2 - 1, unifiedMemoryProperties);
+    EXPECT_NE(allocation, notReusedAllocation);
+    EXPECT_EQ(1u, cache->sizeBucketsAllocationsCount);
+
+    auto reusedAllocation = svmManager->createUnifiedMemoryAllocation(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization / 2, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, reusedAllocation);
+    EXPECT_EQ(0u, cache->sizeBucketsAllocationsCount);
+
+    svmManager->freeSVMAlloc(notReusedAllocation);
+    svmManager->freeSVMAlloc(reusedAllocation);
+    svmManager->cleanupUSMAllocCaches();
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenSizeBucketsEnabledWhenTrimOldAllocsCalledThenOldestAllocationFromLargestBucketIsTrimmedFirst) {
+    auto deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUSMAllocationReuseSizeBuckets.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager());
+    device->usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_NE(nullptr, svmManager->usmDeviceAllocationsCache);
+    auto cache = svmManager->usmDeviceAllocationsCache.get();
+
+    auto unifiedMemoryProperties = createMemoryProperties(InternalMemoryType::deviceUnifiedMemory, device);
+    auto allocation = svmManager->createUnifiedMemoryAllocation(1 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation3 = svmManager->createUnifiedMemoryAllocation(3 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    svmManager->freeSVMAlloc(allocation2);
+    svmManager->freeSVMAlloc(allocation3);
+    EXPECT_EQ(3u, cache->sizeBucketsAllocationsCount);
+
+    const auto baseTimePoint = std::chrono::high_resolution_clock::now();
+    const auto timeDiff = std::chrono::microseconds(1);
+    (*cache->sizeBuckets)[16].allocations.peekHead()->info.saveTime = baseTimePoint;
+    (*cache->sizeBuckets)[17].allocations.peekHead()->info.saveTime = baseTimePoint + timeDiff * 2;
+    (*cache->sizeBuckets)[18].allocations.peekHead()->info.saveTime = baseTimePoint + timeDiff;
+
+    cache->trimOldAllocs(baseTimePoint + timeDiff, false);
+    EXPECT_EQ(2u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE((*cache->sizeBuckets)[18].allocations.peekIsEmpty());
+
+    cache->trimOldAllocs(baseTimePoint + timeDiff, false);
+    EXPECT_EQ(1u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE((*cache->sizeBuckets)[16].allocations.peekIsEmpty());
+
+    cache->trimOldAllocs(baseTimePoint + timeDiff, false);
+    EXPECT_EQ(1u, cache->sizeBucketsAllocationsCount);
+    EXPECT_FALSE(cache->isEmpty());
+
+    cache->trimOldAllocs(baseTimePoint + timeDiff * 2, true);
+    EXPECT_EQ(0u, cache->sizeBucketsAllocationsCount);
+    EXPECT_TRUE(cache->isEmpty());
+
+    svmManager->cleanupUSMAllocCaches();
+}
+
 using SvmHostAllocationCacheTest = Test<SvmAllocationCacheTestFixture>;
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheDisabledWhenCheckingIfEnabledThenItIsDisabled) {
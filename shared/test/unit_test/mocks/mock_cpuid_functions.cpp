@@ -55,6 +55,14 @@ void mockCpuidEnableAllExceptAvx2Bit(int *cpuInfo, int functionId) {
     }
 }
 
+void mockCpuidEnableAllExceptAvx512ByteWordBit(int *cpuInfo, int functionId) {
+    constexpr unsigned int extendedFeatures = 0x7;
+    mockCpuidEnableAll(cpuInfo, functionId);
+    if (static_cast<unsigned int>(functionId) == extendedFeatures) {
+        cpuInfo[1] &= ~(1 << 30);
+    }
+}
+
 uint64_t mockXgetbvEnableAll(uint32_t) {
     return ~static_cast<uint64_t>(0);
 }
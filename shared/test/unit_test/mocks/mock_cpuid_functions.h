@@ -34,6 +34,8 @@ void mockCpuidEnableAllExceptAvx512FoundationBit(int *cpuInfo, int functionId);
 
 void mockCpuidEnableAllExceptAvx2Bit(int *cpuInfo, int functionId);
 
+void mockCpuidEnableAllExceptAvx512ByteWordBit(int *cpuInfo, int functionId);
+
 uint64_t mockXgetbvEnableAll(uint32_t index);
 
 uint64_t mockXgetbvDisableAll(uint32_t index);
@@ -6,11 +6,14 @@
  */
 
 #pragma once
+#include "shared/source/command_container/dispatch_template_cache.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/mock_method_macros.h"
 
+#include <memory>
+
 namespace NEO {
 class GraphicsAllocation;
 
@@ -32,6 +35,8 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
         samplerStateOffsetPassed = samplerStateOffset;
     }
 
+    DispatchTemplateCache *getDispatchTemplateCache() const override { return dispatchTemplateCache.get(); }
+
     ImplicitArgs *implicitArgsPtr = nullptr;
     MockGraphicsAllocation mockAllocation{};
     static constexpr uint32_t crossThreadSize = 0x40;
@@ -44,6 +49,7 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t numThreadsPerThreadGroup = 1;
 
     mutable uint64_t samplerStateOffsetPassed = 0u;
+    std::unique_ptr<DispatchTemplateCache> dispatchTemplateCache;
 
     ADDMETHOD_CONST_NOBASE(getKernelDescriptor, const KernelDescriptor &, kernelDescriptor, ());
     ADDMETHOD_CONST_NOBASE(getGroupSize, const uint32_t *, groupSizes, ());
@@ -5,14 +5,18 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/svm_allocation_lookup_index.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_svm_manager.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -33,3 +37,48 @@ TEST(SvmDeviceAllocationTest, givenGivenSvmAllocsManagerWhenObtainOwnershipCalle
     });
     th2.join();
 }
+
+TEST(SvmAllocationLookupIndexMtTest, givenConcurrentReadersWhenWriterPublishesAndRemovesAllocationsThenStableAllocationIsAlwaysFound) {
+    BaseSortedPointerWithValueVector<SvmAllocationData> allocations;
+    SvmAllocationLookupIndex lookupIndex;
+
+    SvmAllocationData allocData(1u);
+    allocData.size = MemoryConstants::pageSize;
+    auto stablePtr = reinterpret_cast<void *>(0x100000);
+    allocations.insert(stablePtr, allocData);
+    auto stableData = allocations.get(stablePtr);
+    lookupIndex.publish(allocations, nullptr);
+
+    constexpr uint32_t numReaders = 4u;
+    constexpr uint32_t numIterations = 2000u;
+    std::atomic<bool> writerDone{false};
+    std::atomic<uint32_t> lookupFailures{0u};
+
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < numReaders; i++) {
+        readers.emplace_back([&] {
+            while (!writerDone.load()) {
+                if (lookupIndex.find(ptrOffset(stablePtr, 0x10)) != stableData) {
+                    lookupFailures++;
+                }
+                lookupIndex.find(reinterpret_cast<void *>(0x200000));
+            }
+        });
+    }
+
+    for (uint32_t i = 0; i < numIterations; i++) {
+        auto transientPtr = reinterpret_cast<void *>(0x200000 + (i % 16) * MemoryConstants::pageSize);
+        allocations.insert(transientPtr, allocData);
+        lookupIndex.publish(allocations, nullptr);
+        lookupIndex.publish(allocations, allocations.extract(transientPtr));
+    }
+    writerDone = true;
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0u, lookupFailures.load());
+
+    lookupIndex.publish(allocations, nullptr);
+    EXPECT_EQ(0u, lookupIndex.getRetiredSnapshotsCount());
+}
@@ -25,6 +25,7 @@
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/linux/mock_drm_memory_manager.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_os_thread.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/os_interface/linux/drm_memory_manager_fixture.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -48,6 +49,7 @@ class DrmMockForWorker : public Drm {
     std::mutex mutex;
     std::atomic<int> gemCloseCnt;
     std::atomic<int> gemCloseExpected;
+    std::atomic<int> gemWaitCnt{0};
     std::atomic<std::thread::id> ioctlCallerThreadId;
     DrmMockForWorker(RootDeviceEnvironment &rootDeviceEnvironment) : Drm(std::make_unique<HwDeviceIdDrm>(mockFd, mockPciPath), rootDeviceEnvironment) {
     }
@@ -55,6 +57,9 @@ class DrmMockForWorker : public Drm {
         if (request == DrmIoctl::gemClose) {
             gemCloseCnt++;
         }
+        if (request == DrmIoctl::gemWait) {
+            gemWaitCnt++;
+        }
 
         ioctlCallerThreadId = std::this_thread::get_id();
 
@@ -206,6 +211,115 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     EXPECT_EQ(nullptr, worker->thread);
 }
 
+struct DrmGemCloseWorkerWithoutWorkerThread : DrmGemCloseWorker {
+    using DrmGemCloseWorker::DrmGemCloseWorker;
+    using DrmGemCloseWorker::helperThreads;
+    using DrmGemCloseWorker::processQueue;
+    using DrmGemCloseWorker::takeQueue;
+    using DrmGemCloseWorker::workerDone;
+
+    ~DrmGemCloseWorkerWithoutWorkerThread() override {
+        workerDone.store(true);
+    }
+
+    void close(bool blocking) override {
+        workerDone.store(true);
+        DrmGemCloseWorker::close(blocking);
+    }
+};
+
+TEST_F(DrmGemCloseWorkerTests, givenSameBufferObjectQueuedMultipleTimesWhenQueueIsProcessedThenItIsWaitedOnceAndClosedAfterLastReference) {
+    this->drmMock->gemCloseExpected = 2;
+
+    VariableBackup<decltype(Thread::createFunc)> createFuncBackup(&Thread::createFunc, [](void *(*)(void *), void *) -> std::unique_ptr<Thread> {
+        return std::make_unique<MockThread>();
+    });
+    auto worker = std::make_unique<DrmGemCloseWorkerWithoutWorkerThread>(*mm);
+
+    auto bo = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto bo2 = new BufferObject(rootDeviceIndex, this->drmMock, 3, 2, 0, 1);
+    bo->reference();
+    bo->reference();
+    worker->push(bo);
+    worker->push(bo2);
+    worker->push(bo);
+    worker->push(bo);
+    EXPECT_EQ(4u, worker->getQueueDepth());
+    EXPECT_FALSE(worker->isEmpty());
+
+    worker->processQueue(worker->takeQueue());
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(2, this->drmMock->gemWaitCnt.load());
+    EXPECT_EQ(2, this->drmMock->gemCloseCnt.load());
+
+    auto stats = worker->getStats();
+    EXPECT_EQ(1u, stats.processedBatchesCount);
+    EXPECT_EQ(4u, stats.processedBuffersCount);
+    EXPECT_EQ(2u, stats.coalescedWaitsCount);
+    EXPECT_EQ(4u, stats.peakQueueDepth);
+    EXPECT_TRUE(worker->helperThreads.empty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenHelperThreadsAllowedWhenLargeBacklogIsProcessedThenAllBufferObjectsAreClosed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.GemCloseWorkerMaxHelperThreads.set(2);
+    constexpr uint32_t bufferObjectsCount = 4 * DrmGemCloseWorker::minimalBatchSizePerHelperThread;
+    this->drmMock->gemCloseExpected = bufferObjectsCount;
+
+    static decltype(Thread::createFunc) threadCreateFunc = nullptr;
+    threadCreateFunc = Thread::createFunc;
+    static bool workerThreadCreated = false;
+    workerThreadCreated = false;
+    VariableBackup<decltype(Thread::createFunc)> createFuncBackup(&Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> {
+        if (!workerThreadCreated) {
+            workerThreadCreated = true;
+            return std::make_unique<MockThread>();
+        }
+        return threadCreateFunc(func, arg);
+    });
+    auto worker = std::make_unique<DrmGemCloseWorkerWithoutWorkerThread>(*mm);
+
+    for (uint32_t i = 0; i < bufferObjectsCount; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, i + 1, 0, 1));
+    }
+    EXPECT_EQ(bufferObjectsCount, worker->getQueueDepth());
+
+    worker->processQueue(worker->takeQueue());
+
+    EXPECT_EQ(2u, worker->helperThreads.size());
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(static_cast<int>(bufferObjectsCount), this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(0u, worker->getStats().coalescedWaitsCount);
+
+    worker->close(true);
+    EXPECT_TRUE(worker->helperThreads.empty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsPushedFromMultipleThreadsWhenWorkerIsClosedThenAllAreClosed) {
+    constexpr uint32_t threadsCount = 4u;
+    constexpr uint32_t bufferObjectsPerThread = 256u;
+    this->drmMock->gemCloseExpected = threadsCount * bufferObjectsPerThread;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadsCount; t++) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < bufferObjectsPerThread; i++) {
+                worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, t * bufferObjectsPerThread + i + 1, 0, 1));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    worker->close(true);
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(static_cast<uint64_t>(threadsCount * bufferObjectsPerThread), worker->getStats().processedBuffersCount);
+}
+
 struct DrmCsrGemCloseWorkerMtTest : ::testing::Test {
     void SetUp() override {
         debugManager.flags.EnableL3FlushAfterPostSync.set(0);
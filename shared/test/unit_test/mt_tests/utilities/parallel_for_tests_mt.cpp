@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenMultipleThreadsWhenCallingParallelForThenEveryIndexIsProcessedExactlyOnceBeforeReturn) {
+    constexpr size_t count = 1000u;
+    std::vector<uint32_t> processedCount(count, 0u);
+    std::mutex threadsMtx;
+    std::set<std::thread::id> threads;
+    parallelFor(count, 4u, 7u, [&](size_t index) {
+        processedCount[index]++;
+        std::lock_guard<std::mutex> lock(threadsMtx);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    for (size_t index = 0u; index < count; index++) {
+        EXPECT_EQ(1u, processedCount[index]) << index;
+    }
+    EXPECT_GE(4u, threads.size());
+}
+
+TEST(ParallelForTest, givenParallelForCalledFromHelperThreadsWhenCallingParallelForThenNestedCallsCompleteWithoutWaitingForBusyPool) {
+    constexpr size_t outerCount = 16u;
+    constexpr size_t innerCount = 64u;
+    std::vector<std::vector<uint32_t>> processedCount(outerCount, std::vector<uint32_t>(innerCount, 0u));
+    parallelFor(outerCount, 4u, 1u, [&](size_t outerIndex) {
+        parallelFor(innerCount, 4u, 3u, [&](size_t innerIndex) {
+            processedCount[outerIndex][innerIndex]++;
+        });
+    });
+
+    for (const auto &innerProcessedCount : processedCount) {
+        EXPECT_EQ(std::vector<uint32_t>(innerCount, 1u), innerProcessedCount);
+    }
+}
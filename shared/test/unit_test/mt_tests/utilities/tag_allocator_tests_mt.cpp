@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/hw_timestamps.h"
+#include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/common/fixtures/memory_allocator_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct TagAllocatorMtTest : public MemoryAllocatorFixture,
+                            public ::testing::Test {
+    void SetUp() override {
+        MemoryAllocatorFixture::setUp();
+    }
+
+    void TearDown() override {
+        MemoryAllocatorFixture::tearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(TagAllocatorMtTest, givenLockFreeTagAllocatorWhenTagsAreTakenAndReturnedConcurrentlyThenTagIsNeverOwnedByTwoThreads) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t iterationsCount = 2000;
+    constexpr uint32_t heldTagsCount = 4;
+
+    TagAllocator<HwTimeStamps> tagAllocator(RootDeviceIndicesContainer{0}, memoryManager, 16, MemoryConstants::cacheLineSize,
+                                            sizeof(HwTimeStamps), 0, false, true, device->getDeviceBitfield());
+
+    std::atomic<uint32_t> ownershipViolations{0};
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 1; threadId <= threadsCount; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+                std::array<TagNode<HwTimeStamps> *, heldTagsCount> tags;
+                for (auto &tag : tags) {
+                    tag = static_cast<TagNode<HwTimeStamps> *>(tagAllocator.getTag());
+                    tag->tagForCpuAccess->globalStartTS = threadId;
+                }
+                std::this_thread::yield();
+                for (auto &tag : tags) {
+                    if (tag->tagForCpuAccess->globalStartTS != threadId) {
+                        ownershipViolations++;
+                    }
+                    tag->returnTag();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipViolations);
+}
@@ -42,6 +42,7 @@ using namespace NEO;
 struct MockDrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandlerBind {
     using DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind;
     using DrmMemoryOperationsHandlerBind::evictImpl;
+    using DrmMemoryOperationsHandlerBind::residencySnapshotLookups;
 
     bool useBaseEvictUnused = true;
     uint32_t evictUnusedCalled = 0;
@@ -370,6 +371,96 @@ HWTEST_F(DrmMemoryOperationsHandlerBindTest, givenMakeEachAllocationResidentWhen
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyDeltaTrackingDisabledWhenMergingSameContainerTwiceThenNoResidencyCheckIsSkipped) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContext = device->getDefaultEngine().osContext;
+    ResidencyContainer residency{allocation};
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyChecksCount());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyDeltaTrackingEnabledWhenMergingContainerThenOnlyNewAllocationsAreProcessed) {
+    debugManager.flags.EnableResidencyDeltaTracking.set(1);
+
+    auto allocation0 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContext = device->getDefaultEngine().osContext;
+
+    ResidencyContainer residency{allocation0};
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_EQ(1u, operationHandler->residencySnapshotLookups.load());
+    auto vmBindCalledAfterFirstMerge = mock->context.vmBindCalled;
+    EXPECT_NE(0u, vmBindCalledAfterFirstMerge);
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(1u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_EQ(1u, operationHandler->residencySnapshotLookups.load());
+    EXPECT_EQ(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    residency.push_back(allocation1);
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(2u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_EQ(2u, operationHandler->residencySnapshotLookups.load());
+    EXPECT_LT(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation1);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyDeltaTrackingEnabledWhenAllocationIsEvictedThenNextMergeProcessesWholeContainer) {
+    debugManager.flags.EnableResidencyDeltaTracking.set(1);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContext = device->getDefaultEngine().osContext;
+    ResidencyContainer residency{allocation};
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    auto vmBindCalledAfterFirstMerge = mock->context.vmBindCalled;
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->evictWithinOsContext(osContext, *allocation));
+    EXPECT_NE(0u, mock->context.vmUnbindCalled);
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_EQ(2 * vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyDeltaTrackingEnabledWhenAllocationIsFreedThenOnlyFreedAllocationIsRemovedFromSnapshot) {
+    debugManager.flags.EnableResidencyDeltaTracking.set(1);
+
+    auto allocation0 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContext = device->getDefaultEngine().osContext;
+
+    ResidencyContainer residency{allocation0, allocation1};
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+
+    auto vmBindCalledAfterFirstMerge = mock->context.vmBindCalled;
+
+    memoryManager->freeGraphicsMemory(allocation1);
+    residency.pop_back();
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(1u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_EQ(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    residency.push_back(allocation2);
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residency));
+    EXPECT_EQ(2u, operationHandler->getSkippedResidencyChecksCount());
+    EXPECT_LT(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation2);
+}
+
 HWTEST_F(DrmMemoryOperationsHandlerBindTest, whenEvictUnusedResourcesWithWaitForCompletionThenWaitCsrMethodIsCalled) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,10 +22,14 @@ struct WhiteBoxNumaLibrary : NumaLibrary {
     using NumaLibrary::procGetMemPolicyStr;
     using NumaLibrary::procNumaAvailableStr;
     using NumaLibrary::procNumaMaxNodeStr;
+    using NumaLibrary::procNumaRunOnNodeStr;
     using GetMemPolicyPtr = NumaLibrary::GetMemPolicyPtr;
     using NumaAvailablePtr = NumaLibrary::NumaAvailablePtr;
     using NumaMaxNodePtr = NumaLibrary::NumaMaxNodePtr;
+    using NumaRunOnNodePtr = NumaLibrary::NumaRunOnNodePtr;
     using NumaLibrary::getMemPolicyFunction;
+    using NumaLibrary::numaInitAttempted;
+    using NumaLibrary::numaRunOnNodeFunction;
     using NumaLibrary::osLibrary;
 };
 
@@ -141,3 +145,87 @@ TEST(NumaLibraryTests, givenNumaLibraryWithInvalidGetMemPolicyWhenCallingGetMemP
     MockOsLibrary::loadLibraryNewObject = nullptr;
     WhiteBoxNumaLibrary::osLibrary.reset();
 }
+
+TEST(NumaLibraryTests, givenNumaLibraryWithRunOnNodeWhenRunningOnNodeThenOnlyExistingNodesAreAccepted) {
+    static int requestedNode = -1;
+    requestedNode = -1;
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return 0; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return 2; };
+    WhiteBoxNumaLibrary::NumaRunOnNodePtr numaRunOnNodeHandler =
+        [](int node) -> int {
+        requestedNode = node;
+        return 0;
+    };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaRunOnNodeStr)] = reinterpret_cast<void *>(numaRunOnNodeHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+    EXPECT_TRUE(WhiteBoxNumaLibrary::init());
+    EXPECT_EQ(reinterpret_cast<WhiteBoxNumaLibrary::NumaRunOnNodePtr>(numaRunOnNodeHandler), WhiteBoxNumaLibrary::numaRunOnNodeFunction);
+
+    EXPECT_TRUE(WhiteBoxNumaLibrary::runOnNode(2));
+    EXPECT_EQ(2, requestedNode);
+    EXPECT_FALSE(WhiteBoxNumaLibrary::runOnNode(3));
+    EXPECT_EQ(2, requestedNode);
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
+
+TEST(NumaLibraryTests, givenNumaLibraryWithoutRunOnNodeWhenRunningOnNodeThenFalseIsReturned) {
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return 0; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return 2; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+    EXPECT_TRUE(WhiteBoxNumaLibrary::init());
+    EXPECT_EQ(nullptr, WhiteBoxNumaLibrary::numaRunOnNodeFunction);
+    EXPECT_FALSE(WhiteBoxNumaLibrary::runOnNode(0));
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
+
+TEST(NumaLibraryTests, givenNumaLibraryInitializedOnceWhenCallingInitOnceAgainThenLibraryIsNotReloaded) {
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return 0; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return 2; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+    VariableBackup<bool> numaInitAttemptedBackup{&WhiteBoxNumaLibrary::numaInitAttempted, false};
+    EXPECT_TRUE(WhiteBoxNumaLibrary::initOnce());
+    EXPECT_TRUE(WhiteBoxNumaLibrary::numaInitAttempted);
+    EXPECT_EQ(nullptr, MockOsLibrary::loadLibraryNewObject);
+    EXPECT_EQ(osLibrary, WhiteBoxNumaLibrary::osLibrary.get());
+
+    // second call must keep the loaded library, a reload would return nullptr now
+    EXPECT_TRUE(WhiteBoxNumaLibrary::initOnce());
+    EXPECT_TRUE(WhiteBoxNumaLibrary::isLoaded());
+    EXPECT_EQ(osLibrary, WhiteBoxNumaLibrary::osLibrary.get());
+
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
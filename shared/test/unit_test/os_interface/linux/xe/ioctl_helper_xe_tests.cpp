@@ -2254,6 +2254,287 @@ TEST_F(IoctlHelperXeTest, givenVmBindWaitUserFenceTimeoutWhenCallingVmBindThenWa
     }
 }
 
+TEST_F(IoctlHelperXeTest, givenVmBindBatchingEnabledWhenBindingMultipleBuffersThenSingleVmBindIsIssuedAtNextWait) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    uint64_t fenceAddress = 0x4321;
+    constexpr uint32_t numBinds = 64;
+
+    drm->vmBindInputs.clear();
+    drm->vmBindOpsInputs.clear();
+    drm->syncInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    for (uint32_t i = 0; i < numBinds; i++) {
+        VmBindExtUserFenceT vmBindExtUserFence{};
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, i + 1, 0u);
+
+        VmBindParams vmBindParams{};
+        vmBindParams.vmId = 1;
+        vmBindParams.handle = 0x1000 + i;
+        vmBindParams.start = MemoryConstants::pageSize64k * (i + 1);
+        vmBindParams.length = MemoryConstants::pageSize64k;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    }
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, fenceAddress, numBinds, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(numBinds, drm->vmBindInputs[0].num_binds);
+    EXPECT_EQ(1u, drm->vmBindInputs[0].vm_id);
+    ASSERT_EQ(numBinds, drm->vmBindOpsInputs.size());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindOpsInputs[i].op);
+        EXPECT_EQ(0x1000u + i, drm->vmBindOpsInputs[i].obj);
+    }
+
+    ASSERT_EQ(1u, drm->syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm->syncInputs[0].addr);
+    EXPECT_EQ(numBinds, drm->syncInputs[0].timeline_value);
+
+    ASSERT_EQ(2u, drm->waitUserFenceInputs.size());
+    EXPECT_EQ(static_cast<uint16_t>(DRM_XE_UFENCE_WAIT_OP_GTE), drm->waitUserFenceInputs[0].op);
+    EXPECT_EQ(numBinds, drm->waitUserFenceInputs[0].value);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchingEnabledAndQueuedBindWhenCallingVmUnbindThenQueuedBindIsSubmittedFirst) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->vmBindInputs.clear();
+    drm->syncInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(vmBindParams));
+    ASSERT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindInputs[0].bind.op);
+    EXPECT_EQ(0x1234u, drm->vmBindInputs[0].bind.obj);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), drm->vmBindInputs[1].bind.op);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchingEnabledWhenBatchedAndReplayedVmBindFailThenFailedBindsStayQueuedForNextFlush) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    uint64_t fenceAddress = 0x4321;
+    constexpr uint32_t numBinds = 2;
+
+    drm->vmBindInputs.clear();
+    drm->vmBindOpsInputs.clear();
+
+    for (uint32_t i = 0; i < numBinds; i++) {
+        VmBindExtUserFenceT vmBindExtUserFence{};
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, i + 1, 0u);
+
+        VmBindParams vmBindParams{};
+        vmBindParams.vmId = 1;
+        vmBindParams.handle = 0x1000 + i;
+        vmBindParams.start = MemoryConstants::pageSize64k * (i + 1);
+        vmBindParams.length = MemoryConstants::pageSize64k;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    }
+
+    drm->gemVmBindReturn = -1;
+    EXPECT_NE(0, xeIoctlHelper->waitUserFence(0u, fenceAddress, numBinds, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    ASSERT_EQ(1u + numBinds, drm->vmBindInputs.size());
+    EXPECT_EQ(numBinds, drm->vmBindInputs[0].num_binds);
+    EXPECT_EQ(1u, drm->vmBindInputs[1].num_binds);
+    EXPECT_EQ(1u, drm->vmBindInputs[2].num_binds);
+
+    drm->gemVmBindReturn = 0;
+    drm->vmBindInputs.clear();
+    drm->vmBindOpsInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, fenceAddress, numBinds, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(numBinds, drm->vmBindInputs[0].num_binds);
+    ASSERT_EQ(numBinds, drm->vmBindOpsInputs.size());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindOpsInputs[i].op);
+        EXPECT_EQ(0x1000u + i, drm->vmBindOpsInputs[i].obj);
+    }
+
+    drm->vmBindInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, fenceAddress, numBinds, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+}
+
+TEST_F(IoctlHelperXeTest, givenFailedQueuedVmBindWhenUnbindingOrClosingHandleThenBindIsRetriedBeforeUnbindOrDiscardedOnClose) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.vmId = 1;
+    vmBindParams.handle = 0x1234;
+    vmBindParams.start = MemoryConstants::pageSize64k;
+    vmBindParams.length = MemoryConstants::pageSize64k;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+
+    drm->gemVmBindReturn = -1;
+    EXPECT_NE(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+
+    drm->gemVmBindReturn = 0;
+    drm->vmBindInputs.clear();
+    VmBindParams unbindParams = vmBindParams;
+    unbindParams.handle = 0u;
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(unbindParams));
+    ASSERT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindInputs[0].bind.op);
+    EXPECT_EQ(0x1234u, drm->vmBindInputs[0].bind.obj);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), drm->vmBindInputs[1].bind.op);
+
+    drm->gemVmBindReturn = -1;
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_NE(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+
+    drm->gemVmBindReturn = 0;
+    GemClose gemClose{};
+    gemClose.handle = vmBindParams.handle;
+    xeIoctlHelper->ioctl(DrmIoctl::gemClose, &gemClose);
+
+    drm->vmBindInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+}
+
+TEST_F(IoctlHelperXeTest, givenFailedQueuedVmBindOfUnbindRangeWhenUnbindingWithClearedHandleThenFailedBindIsDiscardedAndUnbindSucceeds) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.vmId = 1;
+    vmBindParams.handle = 0x1234;
+    vmBindParams.start = MemoryConstants::pageSize64k;
+    vmBindParams.length = MemoryConstants::pageSize64k;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+
+    drm->gemVmBindReturn = -1;
+    EXPECT_NE(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+
+    VmBindParams unbindParams = vmBindParams;
+    unbindParams.handle = 0u;
+    drm->vmBindInputs.clear();
+    EXPECT_NE(0, xeIoctlHelper->vmUnbind(unbindParams));
+    ASSERT_EQ(3u, drm->vmBindInputs.size());
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindInputs[0].bind.op);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindInputs[1].bind.op);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), drm->vmBindInputs[2].bind.op);
+
+    drm->gemVmBindReturn = 0;
+    drm->vmBindInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+}
+
+TEST_F(IoctlHelperXeTest, givenFailedQueuedVmBindOfOtherRangeWhenUnbindingThenFailedBindIsNotReplayedAndStaysQueued) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.vmId = 1;
+    vmBindParams.handle = 0x1234;
+    vmBindParams.start = MemoryConstants::pageSize64k;
+    vmBindParams.length = MemoryConstants::pageSize64k;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+
+    drm->gemVmBindReturn = -1;
+    EXPECT_NE(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+
+    drm->gemVmBindReturn = 0;
+    drm->vmBindInputs.clear();
+    VmBindParams unbindParams{};
+    unbindParams.vmId = 1;
+    unbindParams.handle = 0u;
+    unbindParams.start = 4 * MemoryConstants::pageSize64k;
+    unbindParams.length = MemoryConstants::pageSize64k;
+    xeIoctlHelper->setVmBindUserFence(unbindParams, vmBindExtUserFence);
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(unbindParams));
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), drm->vmBindInputs[0].bind.op);
+
+    drm->vmBindInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->waitUserFence(0u, 0x4321, 0x789, static_cast<uint32_t>(Drm::ValueWidth::u64), -1, 0u, false, NEO::InterruptId::notUsed, nullptr));
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindInputs[0].bind.op);
+    EXPECT_EQ(0x1234u, drm->vmBindInputs[0].bind.obj);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchingEnabledWhenBindHasExtensionsOrDecompressFlagThenVmBindIsIssuedImmediately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableXeVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->vmBindInputs.clear();
+
+    uint64_t extension = 0u;
+    vmBindParams.extensions = castToUint64(&extension);
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(1u, drm->vmBindInputs.size());
+
+    vmBindParams.extensions = 0u;
+    vmBindParams.flags = xeIoctlHelper->getVmBindDecompressFlag();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(2u, drm->vmBindInputs.size());
+}
+
 TEST_F(IoctlHelperXeTest, givenNotEqualUserFenceWaitWhenCallingDrmWaitOnUserFencesThenXeWaitUserFenceUsesNeqOperationAndU32Mask) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
@@ -458,6 +458,31 @@ TEST_F(PageFaultManagerTest, givenHandlerRegisteredAndUntrackedPageFaultAddressW
     EXPECT_FALSE(retVal);
 }
 
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocsWhenVerifyingAddressesThenOnlyAddressesWithinTrackedAllocsAreFound) {
+    constexpr size_t allocsCount = 1000u;
+    constexpr size_t allocSize = 0x100u;
+    auto getAlloc = [](size_t allocIndex) { return reinterpret_cast<void *>(0x10000 + allocIndex * 2 * allocSize); };
+
+    for (size_t i = 0; i < allocsCount; i++) {
+        pageFaultManager->insertAllocation(getAlloc(i), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+    pageFaultManager->insertAllocation(getAlloc(0), 2 * allocSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(allocsCount, pageFaultManager->memoryData.size());
+    EXPECT_EQ(allocsCount, pageFaultManager->memoryDataRanges.size());
+
+    for (size_t i = 0; i < allocsCount; i += 2) {
+        pageFaultManager->removeAllocation(getAlloc(i));
+    }
+    EXPECT_EQ(allocsCount / 2, pageFaultManager->memoryDataRanges.size());
+
+    for (size_t i = 0; i < allocsCount; i++) {
+        const bool isTracked = (i % 2) == 1;
+        EXPECT_EQ(isTracked, pageFaultManager->verifyAndHandlePageFault(getAlloc(i), false));
+        EXPECT_EQ(isTracked, pageFaultManager->verifyAndHandlePageFault(ptrOffset(getAlloc(i), allocSize - 1), false));
+        EXPECT_FALSE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(getAlloc(i), allocSize), false));
+    }
+}
+
 TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProperAllocIsTransferredToCpuDomain) {
     void *alloc1 = reinterpret_cast<void *>(0x1);
     void *alloc2 = reinterpret_cast<void *>(0x100);
@@ -1100,3 +1125,171 @@ TEST_F(PageFaultManagerTest, givenHardwareModeWhenCallTbxInsertOrRemoveApiThenNo
     EXPECT_FALSE(pageFaultManager2->memoryData.find(ptr) == pageFaultManager2->memoryData.end());
     pageFaultManager2->memoryData.erase(ptr);
 }
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenInsertingAllocsThenOnlyAllocsLargerThanChunkAreMigratedInChunks) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    void *smallAlloc = reinterpret_cast<void *>(0x100000);
+    void *largeAlloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(smallAlloc, chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(largeAlloc, 4 * chunkSize + MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(smallAlloc).chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(smallAlloc).chunkDomains.empty());
+
+    auto &faultData = pageFaultManager->memoryData.at(largeAlloc);
+    EXPECT_EQ(chunkSize, faultData.chunkSize);
+    EXPECT_EQ(std::vector<CpuPageFaultManager::AllocationDomain>(5u, CpuPageFaultManager::AllocationDomain::cpu), faultData.chunkDomains);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetAndAubOrTbxHandlerSelectedWhenInsertingAllocThenWholeAllocIsMigrated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::unprotectAndTransferMemory;
+
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::megaByte, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(alloc).chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc).chunkDomains.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocWhenCpuTouchesItBetweenGpuMigrationsThenOnlyTouchedChunksAreMigratedAndReprotected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    constexpr size_t allocSize = 4 * chunkSize + MemoryConstants::pageSize;
+    using Chunks = std::vector<std::pair<size_t, size_t>>;
+
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(Chunks({{0u, allocSize}}), pageFaultManager->chunksTransferredToGpu);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(alloc, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::gpu, pageFaultManager->memoryData.at(alloc).domain);
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, chunkSize + 0x10), true));
+    EXPECT_EQ(Chunks({{chunkSize, chunkSize}}), pageFaultManager->chunksTransferredToCpu);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, 2 * chunkSize), true));
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, allocSize - 1), true));
+    EXPECT_EQ(Chunks({{chunkSize, chunkSize}, {2 * chunkSize, chunkSize}, {4 * chunkSize, MemoryConstants::pageSize}}), pageFaultManager->chunksTransferredToCpu);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->chunksTransferredToGpu.clear();
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(Chunks({{chunkSize, 2 * chunkSize}, {4 * chunkSize, MemoryConstants::pageSize}}), pageFaultManager->chunksTransferredToGpu);
+    EXPECT_EQ(3, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(ptrOffset(alloc, 4 * chunkSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(std::vector<CpuPageFaultManager::AllocationDomain>(5u, CpuPageFaultManager::AllocationDomain::gpu), pageFaultManager->memoryData.at(alloc).chunkDomains);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(2 * chunkSize + MemoryConstants::pageSize, statistics.bytesMigratedToCpu);
+    EXPECT_EQ(allocSize + 2 * chunkSize + MemoryConstants::pageSize, statistics.bytesMigratedToGpu);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocWithoutValidDataWhenCpuTouchesItThenChunkIsUnprotectedWithoutTransferAndUntouchedChunksAreTransferredBackAfterGpuUse) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    auto &faultData = pageFaultManager->memoryData.at(alloc);
+    faultData.domain = CpuPageFaultManager::AllocationDomain::none;
+    faultData.chunkDomains.assign(faultData.chunkDomains.size(), CpuPageFaultManager::AllocationDomain::none);
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, 3 * chunkSize), true));
+    EXPECT_TRUE(pageFaultManager->chunksTransferredToCpu.empty());
+    EXPECT_EQ(ptrOffset(alloc, 3 * chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::cpu, faultData.domain);
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::cpu, faultData.chunkDomains[3]);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ((std::vector<std::pair<size_t, size_t>>{{3 * chunkSize, chunkSize}}), pageFaultManager->chunksTransferredToGpu);
+    EXPECT_EQ(0u, pageFaultManager->getMigrationStatistics().bytesMigratedToCpu);
+    EXPECT_EQ(chunkSize, pageFaultManager->getMigrationStatistics().bytesMigratedToGpu);
+    for (auto chunkDomain : faultData.chunkDomains) {
+        EXPECT_EQ(CpuPageFaultManager::AllocationDomain::gpu, chunkDomain);
+    }
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(alloc, true));
+    EXPECT_EQ((std::vector<std::pair<size_t, size_t>>{{0u, chunkSize}}), pageFaultManager->chunksTransferredToCpu);
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::cpu, faultData.chunkDomains[0]);
+    EXPECT_EQ(chunkSize, pageFaultManager->getMigrationStatistics().bytesMigratedToCpu);
+}
+
+TEST_F(PageFaultManagerTest, givenPartiallyMigratedChunkedAllocWhenRemovingItThenWholeAllocIsUnprotected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyAndHandlePageFault(alloc, true);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(2, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenPartiallyMigratedChunkedAllocWhenGpuDomainHandlerIsReplacedThenFaultMigratesRemainingChunksAndCallsNewHandler) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    using Chunks = std::vector<std::pair<size_t, size_t>>;
+
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, chunkSize), true));
+    EXPECT_EQ(Chunks({{chunkSize, chunkSize}}), pageFaultManager->chunksTransferredToCpu);
+
+    static uint32_t handlerCalled = 0u;
+    handlerCalled = 0u;
+    pageFaultManager->setGpuDomainHandler([](CpuPageFaultManager *pageFaultHandler, void *allocPtr, CpuPageFaultManager::PageFaultData &pageFaultData) {
+        handlerCalled++;
+    });
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc, 3 * chunkSize), true));
+    EXPECT_EQ(1u, handlerCalled);
+    EXPECT_EQ(Chunks({{chunkSize, chunkSize}, {0u, chunkSize}, {2 * chunkSize, chunkSize}, {3 * chunkSize, chunkSize}}), pageFaultManager->chunksTransferredToCpu);
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+
+    auto &faultData = pageFaultManager->memoryData.at(alloc);
+    EXPECT_EQ(0u, faultData.chunkSize);
+    EXPECT_TRUE(faultData.chunkDomains.empty());
+    EXPECT_EQ(CpuPageFaultManager::AllocationDomain::cpu, faultData.domain);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->getMigrationStatistics().bytesMigratedToCpu);
+}
+
+TEST_F(PageFaultManagerTest, givenWholeAllocMigrationWhenAllocIsMigratedThenMigratedBytesAreCounted) {
+    void *alloc = reinterpret_cast<void *>(0x200000);
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::megaByte, unifiedMemoryManager.get(), nullptr, {});
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyAndHandlePageFault(alloc, true);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(MemoryConstants::megaByte, statistics.bytesMigratedToCpu);
+    EXPECT_EQ(MemoryConstants::megaByte, statistics.bytesMigratedToGpu);
+}
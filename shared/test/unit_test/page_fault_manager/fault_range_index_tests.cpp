@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/page_fault_manager/fault_range_index.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace NEO;
+
+TEST(FaultRangeIndexTest, givenEmptyIndexWhenFindingAddressThenNullptrIsReturned) {
+    FaultRangeIndex index;
+    EXPECT_EQ(0u, index.size());
+    EXPECT_EQ(nullptr, index.find(reinterpret_cast<void *>(0x1000)));
+}
+
+TEST(FaultRangeIndexTest, givenInsertedRangesWhenFindingAddressesThenRangeContainingAddressIsReturned) {
+    FaultRangeIndex index;
+    auto alloc1 = reinterpret_cast<void *>(0x1000);
+    auto alloc2 = reinterpret_cast<void *>(0x3000);
+    auto alloc3 = reinterpret_cast<void *>(0x2000);
+
+    index.insert(alloc1, 0x1000);
+    index.insert(alloc2, 0x10);
+    index.insert(alloc3, 0x800);
+    EXPECT_EQ(3u, index.size());
+
+    EXPECT_EQ(nullptr, index.find(reinterpret_cast<void *>(0xfff)));
+    EXPECT_EQ(alloc1, index.find(alloc1));
+    EXPECT_EQ(alloc1, index.find(ptrOffset(alloc1, 0xfff)));
+    EXPECT_EQ(alloc3, index.find(ptrOffset(alloc1, 0x1000)));
+    EXPECT_EQ(alloc3, index.find(ptrOffset(alloc3, 0x7ff)));
+    EXPECT_EQ(nullptr, index.find(ptrOffset(alloc3, 0x800)));
+    EXPECT_EQ(alloc2, index.find(ptrOffset(alloc2, 0xf)));
+    EXPECT_EQ(nullptr, index.find(ptrOffset(alloc2, 0x10)));
+}
+
+TEST(FaultRangeIndexTest, givenZeroSizedRangeWhenFindingItsStartThenNullptrIsReturned) {
+    FaultRangeIndex index;
+    auto alloc = reinterpret_cast<void *>(0x1000);
+
+    index.insert(alloc, 0u);
+    EXPECT_EQ(1u, index.size());
+    EXPECT_EQ(nullptr, index.find(alloc));
+}
+
+TEST(FaultRangeIndexTest, givenRemovedRangeWhenFindingAddressThenOnlyRemainingRangesAreFound) {
+    FaultRangeIndex index;
+    auto alloc1 = reinterpret_cast<void *>(0x1000);
+    auto alloc2 = reinterpret_cast<void *>(0x2000);
+
+    index.insert(alloc1, 0x1000);
+    index.insert(alloc2, 0x1000);
+
+    index.remove(ptrOffset(alloc1, 0x10));
+    EXPECT_EQ(2u, index.size());
+
+    index.remove(alloc1);
+    EXPECT_EQ(1u, index.size());
+    EXPECT_EQ(nullptr, index.find(ptrOffset(alloc1, 0x10)));
+    EXPECT_EQ(alloc2, index.find(ptrOffset(alloc2, 0x10)));
+
+    index.remove(alloc1);
+    EXPECT_EQ(1u, index.size());
+}
+
+TEST(FaultRangeIndexTest, givenManyRangesInsertedAndRemovedInRandomOrderWhenFindingAddressesThenOnlyAddressesWithinRemainingRangesAreFound) {
+    constexpr size_t rangesCount = 5000u;
+    constexpr uintptr_t rangeStride = 0x3000u;
+    constexpr size_t rangeSize = 0x2000u;
+
+    std::vector<size_t> order(rangesCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::mt19937 generator(0x5eed);
+    std::shuffle(order.begin(), order.end(), generator);
+
+    auto rangeStart = [](size_t rangeIndex) {
+        return reinterpret_cast<void *>(0x10000 + rangeIndex * rangeStride);
+    };
+
+    FaultRangeIndex index;
+    for (auto rangeIndex : order) {
+        index.insert(rangeStart(rangeIndex), rangeSize);
+    }
+    EXPECT_EQ(rangesCount, index.size());
+
+    std::vector<bool> removed(rangesCount, false);
+    for (size_t i = 0; i < rangesCount / 2; i++) {
+        index.remove(rangeStart(order[i]));
+        removed[order[i]] = true;
+    }
+    EXPECT_EQ(rangesCount - rangesCount / 2, index.size());
+
+    std::uniform_int_distribution<size_t> rangeDistribution(0u, rangesCount - 1);
+    std::uniform_int_distribution<size_t> offsetDistribution(0u, rangeStride - 1);
+    for (int i = 0; i < 10000; i++) {
+        const auto rangeIndex = rangeDistribution(generator);
+        const auto offset = offsetDistribution(generator);
+        const auto expected = (removed[rangeIndex] || offset >= rangeSize) ? nullptr : rangeStart(rangeIndex);
+        EXPECT_EQ(expected, index.find(ptrOffset(rangeStart(rangeIndex), offset)));
+    }
+}
@@ -37,6 +37,10 @@ void CpuPageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void CpuPageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void CpuPageFaultManager::transferChunkToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
+void CpuPageFaultManager::transferChunkToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
 void CpuPageFaultManager::allowCPUMemoryEviction(bool evict, void *ptr, PageFaultData &pageFaultData) {
 }
 
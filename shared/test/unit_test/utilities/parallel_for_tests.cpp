@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenSingleThreadWhenCallingParallelForThenAllIndicesAreProcessedInOrderByCallingThread) {
+    std::vector<size_t> processed;
+    bool otherThreadUsed = false;
+    const auto callingThread = std::this_thread::get_id();
+    parallelFor(10u, 1u, 2u, [&](size_t index) {
+        processed.push_back(index);
+        otherThreadUsed |= (std::this_thread::get_id() != callingThread);
+    });
+
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), processed);
+    EXPECT_FALSE(otherThreadUsed);
+}
+
+TEST(ParallelForTest, givenSingleChunkWhenCallingParallelForWithMultipleThreadsThenWorkIsProcessedByCallingThread) {
+    std::vector<size_t> processed;
+    bool otherThreadUsed = false;
+    const auto callingThread = std::this_thread::get_id();
+    parallelFor(8u, 4u, 16u, [&](size_t index) {
+        processed.push_back(index);
+        otherThreadUsed |= (std::this_thread::get_id() != callingThread);
+    });
+
+    EXPECT_EQ(8u, processed.size());
+    EXPECT_FALSE(otherThreadUsed);
+}
+
+TEST(ParallelForTest, givenNoWorkWhenCallingParallelForThenFunctionIsNotCalled) {
+    uint32_t calls = 0u;
+    parallelFor(0u, 4u, 16u, [&](size_t index) { calls++; });
+    EXPECT_EQ(0u, calls);
+}
+
+TEST(ParallelForTest, givenMultipleChunksWhenCallingParallelForRepeatedlyThenHelpersComeFromBoundedPersistentPool) {
+    const size_t maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+    for (auto iteration = 0u; iteration < 4u; iteration++) {
+        std::vector<uint32_t> processedCount(64u, 0u);
+        parallelFor(processedCount.size(), 8u, 1u, [&](size_t index) { processedCount[index]++; });
+        EXPECT_EQ(std::vector<uint32_t>(64u, 1u), processedCount);
+        EXPECT_LE(getParallelForWorkerPool().getWorkersCount(), maxWorkers);
+    }
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/size_class_heap_allocator.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <random>
+
+using namespace NEO;
+
+namespace {
+constexpr uint64_t heapBase = 0x100000000llu;
+constexpr size_t sizeThreshold = 16 * MemoryConstants::pageSize;
+
+class SizeClassHeapAllocatorUnderTest : public SizeClassHeapAllocator {
+  public:
+    using SizeClassHeapAllocator::findFreeRangeContaining;
+    using SizeClassHeapAllocator::firstLevelBitmap;
+    using SizeClassHeapAllocator::freedChunksBig;
+    using SizeClassHeapAllocator::freedChunksSmall;
+    using SizeClassHeapAllocator::invalidRangeId;
+    using SizeClassHeapAllocator::getSizeClass;
+    using SizeClassHeapAllocator::SizeClassHeapAllocator;
+};
+} // namespace
+
+TEST(SizeClassHeapAllocatorTest, whenSizeClassIsComputedThenRangesAreOrderedBySize) {
+    auto previous = SizeClassHeapAllocatorUnderTest::getSizeClass(1u);
+    for (uint64_t size = 2u; size < 4 * MemoryConstants::megaByte; size += (size >> 3) + 1) {
+        auto current = SizeClassHeapAllocatorUnderTest::getSizeClass(size);
+        EXPECT_LT(current.secondLevel, SizeClassHeapAllocator::secondLevelCount);
+        const bool ordered = current.firstLevel > previous.firstLevel || (current.firstLevel == previous.firstLevel && current.secondLevel >= previous.secondLevel);
+        EXPECT_TRUE(ordered);
+        previous = current;
+    }
+}
+
+TEST(SizeClassHeapAllocatorTest, givenSmallAndBigAllocationsWhenAllocatingThenSmallAreTakenFromTopAndBigFromBottom) {
+    const size_t heapSize = 1024 * MemoryConstants::pageSize;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    size_t smallSize = MemoryConstants::pageSize;
+    auto smallPtr = allocator.allocate(smallSize);
+    EXPECT_EQ(heapBase + heapSize - MemoryConstants::pageSize, smallPtr);
+
+    size_t bigSize = 2 * sizeThreshold;
+    auto bigPtr = allocator.allocate(bigSize);
+    EXPECT_EQ(heapBase, bigPtr);
+
+    EXPECT_EQ(heapSize - smallSize - bigSize, allocator.getLeftSize());
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+
+    allocator.free(smallPtr, smallSize);
+    allocator.free(bigPtr, bigSize);
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenFreedNeighbouringRangesWhenFreeingMiddleRangeThenAllAreCoalesced) {
+    const size_t heapSize = 1024 * MemoryConstants::pageSize;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    size_t sizes[3] = {MemoryConstants::pageSize, MemoryConstants::pageSize, MemoryConstants::pageSize};
+    uint64_t ptrs[3] = {};
+    for (auto i = 0u; i < 3u; i++) {
+        ptrs[i] = allocator.allocate(sizes[i]);
+        EXPECT_NE(0u, ptrs[i]);
+    }
+    size_t guardSize = MemoryConstants::pageSize;
+    auto guardPtr = allocator.allocate(guardSize);
+
+    allocator.free(ptrs[0], sizes[0]);
+    allocator.free(ptrs[2], sizes[2]);
+    EXPECT_EQ(3u, allocator.getFreeRangesCount());
+
+    allocator.free(ptrs[1], sizes[1]);
+    EXPECT_EQ(2u, allocator.getFreeRangesCount());
+
+    size_t mergedSize = 3 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[2], allocator.allocate(mergedSize));
+
+    allocator.free(ptrs[2], mergedSize);
+    allocator.free(guardPtr, guardSize);
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+    EXPECT_EQ(0u, allocator.getUsedSize());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenCustomAlignmentWhenAllocatingThenReturnedAddressIsAligned) {
+    const size_t heapSize = 64 * MemoryConstants::megaByte;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase + MemoryConstants::pageSize, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    for (auto alignment : {MemoryConstants::pageSize64k, 2 * MemoryConstants::megaByte}) {
+        size_t smallSize = MemoryConstants::pageSize;
+        auto smallPtr = allocator.allocateWithCustomAlignment(smallSize, alignment);
+        EXPECT_NE(0u, smallPtr);
+        EXPECT_TRUE(isAligned(smallPtr, alignment));
+
+        size_t bigSize = 2 * sizeThreshold;
+        auto bigPtr = allocator.allocateWithCustomAlignment(bigSize, alignment);
+        EXPECT_NE(0u, bigPtr);
+        EXPECT_TRUE(isAligned(bigPtr, alignment));
+
+        allocator.free(smallPtr, smallSize);
+        allocator.free(bigPtr, bigSize);
+    }
+    EXPECT_EQ(0u, allocator.getUsedSize());
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenAlignmentAboveTwoMegabytesThatCannotBeSatisfiedWhenAllocatingThenAlignmentIsRelaxed) {
+    const size_t heapSize = 8 * MemoryConstants::megaByte;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase + 2 * MemoryConstants::megaByte, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    size_t sizeToAllocate = 4 * MemoryConstants::megaByte;
+    auto ptr = allocator.allocateWithCustomAlignment(sizeToAllocate, 64 * MemoryConstants::megaByte);
+    EXPECT_NE(0u, ptr);
+    EXPECT_TRUE(isAligned(ptr, 2 * MemoryConstants::megaByte));
+    allocator.free(ptr, sizeToAllocate);
+}
+
+TEST(SizeClassHeapAllocatorTest, givenExactlyFittingFreeRangeInLowerSizeClassWhenAllocatingThenRangeIsUsed) {
+    const size_t heapSize = 0x10f000;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, 0u);
+
+    size_t sizeToAllocate = heapSize;
+    EXPECT_EQ(heapBase, allocator.allocate(sizeToAllocate));
+    EXPECT_EQ(0u, allocator.getLeftSize());
+    EXPECT_EQ(0u, allocator.firstLevelBitmap);
+
+    allocator.free(heapBase, sizeToAllocate);
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenNotEnoughSpaceWhenAllocatingThenZeroIsReturned) {
+    const size_t heapSize = 16 * MemoryConstants::pageSize;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    size_t sizeToAllocate = heapSize + MemoryConstants::pageSize;
+    EXPECT_EQ(0u, allocator.allocate(sizeToAllocate));
+
+    size_t firstSize = 8 * MemoryConstants::pageSize;
+    auto firstPtr = allocator.allocate(firstSize);
+    size_t secondSize = MemoryConstants::pageSize;
+    auto secondPtr = allocator.allocateWithStartAddressHint(heapBase + 4 * MemoryConstants::pageSize, secondSize);
+    EXPECT_EQ(heapBase + 4 * MemoryConstants::pageSize, secondPtr);
+
+    // 7 pages are free but split into 4 + 3 pages
+    sizeToAllocate = 5 * MemoryConstants::pageSize;
+    EXPECT_EQ(0u, allocator.allocate(sizeToAllocate));
+
+    size_t zeroSize = 0u;
+    EXPECT_EQ(0u, allocator.allocate(zeroSize));
+
+    allocator.free(firstPtr, firstSize);
+    allocator.free(secondPtr, secondSize);
+    allocator.free(0u, MemoryConstants::pageSize);
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenStartAddressHintWhenAddressIsFreeThenItIsReturnedOtherwiseRegularAllocationIsMade) {
+    const size_t heapSize = 1024 * MemoryConstants::pageSize;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    const auto requiredStartAddress = heapBase + 100 * MemoryConstants::pageSize;
+    size_t sizeToAllocate = 10 * MemoryConstants::pageSize;
+    auto ptr = allocator.allocateWithStartAddressHint(requiredStartAddress, sizeToAllocate);
+    EXPECT_EQ(requiredStartAddress, ptr);
+    EXPECT_EQ(2u, allocator.getFreeRangesCount());
+
+    size_t secondSize = MemoryConstants::pageSize;
+    auto secondPtr = allocator.allocateWithStartAddressHint(requiredStartAddress, secondSize);
+    EXPECT_NE(0u, secondPtr);
+    EXPECT_NE(requiredStartAddress, secondPtr);
+
+    size_t misalignedSize = MemoryConstants::pageSize;
+    auto misalignedPtr = allocator.allocateWithCustomAlignmentWithStartAddressHint(heapBase + MemoryConstants::pageSize, misalignedSize, MemoryConstants::pageSize64k);
+    EXPECT_NE(0u, misalignedPtr);
+    EXPECT_TRUE(isAligned(misalignedPtr, MemoryConstants::pageSize64k));
+
+    allocator.free(ptr, sizeToAllocate);
+    EXPECT_EQ(requiredStartAddress, allocator.allocateWithStartAddressHint(requiredStartAddress, sizeToAllocate));
+
+    allocator.free(ptr, sizeToAllocate);
+    allocator.free(secondPtr, secondSize);
+    allocator.free(misalignedPtr, misalignedSize);
+    EXPECT_EQ(0u, allocator.getUsedSize());
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenFragmentedHeapWhenLookingForFreeRangeContainingHintThenOnlyRangeCoveringWholeRequestIsFound) {
+    const size_t heapSize = 64 * MemoryConstants::pageSize;
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, heapSize, MemoryConstants::pageSize, sizeThreshold);
+
+    std::vector<uint64_t> ptrs;
+    for (auto i = 0u; i < 16u; i++) {
+        size_t sizeToAllocate = 4 * MemoryConstants::pageSize;
+        ptrs.push_back(allocator.allocateWithStartAddressHint(heapBase + i * 4 * MemoryConstants::pageSize, sizeToAllocate));
+        EXPECT_EQ(heapBase + i * 4 * MemoryConstants::pageSize, ptrs.back());
+    }
+    for (auto i = 1u; i < 16u; i += 2) {
+        allocator.free(ptrs[i], 4 * MemoryConstants::pageSize);
+    }
+    EXPECT_EQ(8u, allocator.getFreeRangesCount());
+
+    const auto freeRangeStart = ptrs[5];
+    EXPECT_EQ(allocator.invalidRangeId, allocator.findFreeRangeContaining(heapBase, MemoryConstants::pageSize));
+    EXPECT_EQ(allocator.invalidRangeId, allocator.findFreeRangeContaining(freeRangeStart - MemoryConstants::pageSize, MemoryConstants::pageSize));
+    EXPECT_NE(allocator.invalidRangeId, allocator.findFreeRangeContaining(freeRangeStart, 4 * MemoryConstants::pageSize));
+    EXPECT_NE(allocator.invalidRangeId, allocator.findFreeRangeContaining(freeRangeStart + MemoryConstants::pageSize, 3 * MemoryConstants::pageSize));
+    EXPECT_EQ(allocator.invalidRangeId, allocator.findFreeRangeContaining(freeRangeStart + MemoryConstants::pageSize, 4 * MemoryConstants::pageSize));
+    EXPECT_EQ(allocator.invalidRangeId, allocator.findFreeRangeContaining(freeRangeStart + 4 * MemoryConstants::pageSize, MemoryConstants::pageSize));
+
+    size_t sizeToAllocate = 2 * MemoryConstants::pageSize;
+    EXPECT_EQ(freeRangeStart + MemoryConstants::pageSize, allocator.allocateWithStartAddressHint(freeRangeStart + MemoryConstants::pageSize, sizeToAllocate));
+    EXPECT_EQ(9u, allocator.getFreeRangesCount());
+    allocator.free(freeRangeStart + MemoryConstants::pageSize, sizeToAllocate);
+
+    for (auto i = 0u; i < 16u; i += 2) {
+        allocator.free(ptrs[i], 4 * MemoryConstants::pageSize);
+    }
+    EXPECT_EQ(1u, allocator.getFreeRangesCount());
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SizeClassHeapAllocatorTest, whenCreatedThenChunkListsOfDefaultBackendHoldNoStorage) {
+    SizeClassHeapAllocatorUnderTest allocator(heapBase, 64 * MemoryConstants::pageSize, MemoryConstants::pageSize, sizeThreshold);
+    EXPECT_EQ(0u, allocator.freedChunksBig.capacity());
+    EXPECT_EQ(0u, allocator.freedChunksSmall.capacity());
+}
+
+template <typename AllocatorT>
+void runHeapAllocatorChurn(AllocatorT &allocator, uint64_t base, uint64_t size) {
+    std::mt19937_64 generator(0x5eed);
+    std::vector<std::pair<uint64_t, size_t>> liveAllocations;
+    std::map<uint64_t, uint64_t> usedRanges;
+
+    for (auto iteration = 0u; iteration < 20000u; iteration++) {
+        if (liveAllocations.size() < 500u || (generator() % 2u) == 0u) {
+            size_t sizeToAllocate = (generator() % 64u + 1u) * MemoryConstants::pageSize;
+            if (generator() % 16u == 0u) {
+                sizeToAllocate = (generator() % 8u + 1u) * 4 * MemoryConstants::megaByte;
+            }
+            const size_t alignment = (generator() % 8u == 0u) ? MemoryConstants::pageSize64k : 0u;
+            auto ptr = allocator.allocateWithCustomAlignment(sizeToAllocate, alignment);
+            if (ptr == 0u) {
+                continue;
+            }
+            ASSERT_TRUE(isAligned(ptr, std::max(alignment, MemoryConstants::pageSize)));
+            ASSERT_GE(ptr, base);
+            ASSERT_LE(ptr + sizeToAllocate, base + size);
+
+            auto next = usedRanges.upper_bound(ptr);
+            ASSERT_TRUE(next == usedRanges.end() || next->first >= ptr + sizeToAllocate);
+            ASSERT_TRUE(next == usedRanges.begin() || std::prev(next)->second <= ptr);
+            usedRanges[ptr] = ptr + sizeToAllocate;
+            liveAllocations.emplace_back(ptr, sizeToAllocate);
+        } else {
+            auto index = generator() % liveAllocations.size();
+            allocator.free(liveAllocations[index].first, liveAllocations[index].second);
+            usedRanges.erase(liveAllocations[index].first);
+            liveAllocations[index] = liveAllocations.back();
+            liveAllocations.pop_back();
+        }
+    }
+
+    for (const auto &[ptr, allocationSize] : liveAllocations) {
+        allocator.free(ptr, allocationSize);
+    }
+    EXPECT_EQ(size, allocator.getLeftSize());
+}
+
+TEST(SizeClassHeapAllocatorTest, givenRandomAllocationChurnWhenUsingBothBackendsThenAllocationsNeverOverlapAndHeapIsFullyReclaimed) {
+    const uint64_t heapSize = 4 * MemoryConstants::gigaByte;
+
+    HeapAllocator linearAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+    runHeapAllocatorChurn(linearAllocator, heapBase, heapSize);
+
+    SizeClassHeapAllocatorUnderTest sizeClassAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+    runHeapAllocatorChurn(sizeClassAllocator, heapBase, heapSize);
+    EXPECT_EQ(1u, sizeClassAllocator.getFreeRangesCount());
+
+    size_t wholeHeap = static_cast<size_t>(heapSize);
+    EXPECT_EQ(heapBase, sizeClassAllocator.allocate(wholeHeap));
+}
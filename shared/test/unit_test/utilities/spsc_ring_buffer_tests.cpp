@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/spsc_ring_buffer.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <thread>
+
+using namespace NEO;
+
+TEST(SpscRingBufferTest, givenRequestedCapacityWhenCreatingRingThenCapacityIsRoundedUpToPowerOfTwo) {
+    SpscRingBuffer ring(100u);
+    EXPECT_EQ(128u, ring.getCapacity());
+    EXPECT_EQ(0u, ring.getUsedSize());
+
+    const uint8_t *readSpan = nullptr;
+    EXPECT_EQ(0u, ring.getReadableSpan(readSpan));
+    uint8_t *writeSpan = nullptr;
+    EXPECT_EQ(128u, ring.getWritableSpan(writeSpan));
+}
+
+TEST(SpscRingBufferTest, givenFullRingWhenGettingWritableSpanThenEmptySpanIsReturned) {
+    SpscRingBuffer ring(64u);
+    uint8_t *writeSpan = nullptr;
+    ASSERT_EQ(64u, ring.getWritableSpan(writeSpan));
+    ring.commitWrite(64u);
+
+    EXPECT_EQ(64u, ring.getUsedSize());
+    EXPECT_EQ(0u, ring.getWritableSpan(writeSpan));
+}
+
+TEST(SpscRingBufferTest, givenDataWrappingAroundRingEndWhenReadingThenTwoContiguousSpansAreReturned) {
+    SpscRingBuffer ring(64u);
+    uint8_t *writeSpan = nullptr;
+    const uint8_t *readSpan = nullptr;
+
+    ASSERT_EQ(64u, ring.getWritableSpan(writeSpan));
+    ring.commitWrite(48u);
+    ASSERT_EQ(48u, ring.getReadableSpan(readSpan));
+    ring.commitRead(32u);
+
+    // Free space is split: 16 bytes at the end and 32 bytes at the beginning.
+    ASSERT_EQ(16u, ring.getWritableSpan(writeSpan));
+    memset(writeSpan, 0xA, 16u);
+    ring.commitWrite(16u);
+    ASSERT_EQ(32u, ring.getWritableSpan(writeSpan));
+    memset(writeSpan, 0xB, 8u);
+    ring.commitWrite(8u);
+
+    EXPECT_EQ(40u, ring.getUsedSize());
+    ASSERT_EQ(32u, ring.getReadableSpan(readSpan));
+    EXPECT_EQ(0xA, readSpan[16]);
+    ring.commitRead(32u);
+    ASSERT_EQ(8u, ring.getReadableSpan(readSpan));
+    EXPECT_EQ(0xB, readSpan[0]);
+    ring.commitRead(8u);
+    EXPECT_EQ(0u, ring.getUsedSize());
+}
+
+TEST(SpscRingBufferTest, givenProducerAndConsumerThreadsWhenStreamingDataThenConsumerReceivesAllBytesInOrder) {
+    SpscRingBuffer ring(256u);
+    constexpr uint32_t totalBytes = 64u * 1024u;
+
+    std::thread producer([&]() {
+        uint32_t produced = 0;
+        while (produced < totalBytes) {
+            uint8_t *span = nullptr;
+            size_t size = std::min<size_t>(ring.getWritableSpan(span), totalBytes - produced);
+            for (size_t i = 0; i < size; i++) {
+                span[i] = static_cast<uint8_t>(produced + i);
+            }
+            ring.commitWrite(size);
+            produced += static_cast<uint32_t>(size);
+            if (size == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t consumed = 0;
+    bool inOrder = true;
+    while (consumed < totalBytes) {
+        const uint8_t *span = nullptr;
+        size_t size = ring.getReadableSpan(span);
+        for (size_t i = 0; i < size; i++) {
+            if (span[i] != static_cast<uint8_t>(consumed + i)) {
+                inOrder = false;
+            }
+        }
+        ring.commitRead(size);
+        consumed += static_cast<uint32_t>(size);
+        if (size == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(0u, ring.getUsedSize());
+}
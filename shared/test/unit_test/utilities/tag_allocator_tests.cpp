@@ -24,6 +24,8 @@
 #include <array>
 #include <cstdint>
 #include <limits>
+#include <set>
+#include <vector>
 
 using namespace NEO;
 
@@ -91,12 +93,17 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::freeTagsHead;
+    using BaseClass::getCurrentThreadTagCacheSlot;
     using BaseClass::gfxAllocations;
+    using BaseClass::lockFreeFreeList;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
+    using BaseClass::threadTagCaches;
+    using BaseClass::threadTagCacheSize;
     using BaseClass::usedTags;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
@@ -473,6 +480,137 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool was not allocated
 }
 
+TEST_F(TagAllocatorTest, givenDefaultDebugFlagsWhenCreatingTagAllocatorThenLockFreeFreeListIsNotUsed) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+
+    EXPECT_FALSE(tagAllocator.lockFreeFreeList);
+    EXPECT_EQ(nullptr, tagAllocator.threadTagCaches);
+    EXPECT_EQ(0u, tagAllocator.freeTagsHead.load());
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenGettingAndReturningTagThenTagIsReusedWithoutTrackingOnLists) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+
+    EXPECT_TRUE(tagAllocator.lockFreeFreeList);
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    EXPECT_NE(0u, tagAllocator.freeTagsHead.load());
+
+    auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    ASSERT_NE(nullptr, tagNode);
+    EXPECT_EQ(1u, tagNode->tagForCpuAccess->start);
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+
+    tagAllocator.returnTag(tagNode);
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    EXPECT_EQ(tagNode, tagAllocator.getTag());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenAllNodesWereUsedThenNewPoolIsCreatedOnlyWhenNoFreeTagIsLeft) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+
+    // Big alignment to force only 4 tags
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1024, deviceBitfield);
+
+    std::vector<TagNodeBase *> tagNodes;
+    for (size_t i = 0; i < 5; i++) {
+        tagNodes.push_back(tagAllocator.getTag());
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+
+    for (auto tagNode : tagNodes) {
+        tagAllocator.returnTag(tagNode);
+    }
+    tagNodes.clear();
+
+    std::set<uint64_t> gpuAddresses;
+    for (size_t i = 0; i < 8; i++) {
+        tagNodes.push_back(tagAllocator.getTag());
+        gpuAddresses.insert(tagNodes.back()->getGpuAddress());
+    }
+    EXPECT_EQ(8u, gpuAddresses.size());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+
+    tagNodes.push_back(tagAllocator.getTag());
+    EXPECT_EQ(0u, gpuAddresses.count(tagNodes.back()->getGpuAddress()));
+    EXPECT_EQ(3u, tagAllocator.getTagPoolCount());
+
+    for (auto tagNode : tagNodes) {
+        tagAllocator.returnTag(tagNode);
+    }
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenThreadCacheIsFullThenHalfOfCachedTagsIsMovedToSharedFreeList) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    constexpr uint32_t cacheSize = MockTagAllocator<TimeStamps>::threadTagCacheSize;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, cacheSize + 1, 1, deviceBitfield);
+
+    std::vector<TagNodeBase *> tagNodes;
+    for (uint32_t i = 0; i < cacheSize + 1; i++) {
+        tagNodes.push_back(tagAllocator.getTag());
+    }
+    EXPECT_EQ(0u, static_cast<uint32_t>(tagAllocator.freeTagsHead.load()));
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+
+    auto &cache = tagAllocator.threadTagCaches[tagAllocator.getCurrentThreadTagCacheSlot()];
+    for (auto tagNode : tagNodes) {
+        tagAllocator.returnTag(tagNode);
+    }
+    EXPECT_EQ(cacheSize / 2 + 1, cache.count);
+    EXPECT_NE(0u, static_cast<uint32_t>(tagAllocator.freeTagsHead.load()));
+
+    std::set<TagNodeBase *> reusedNodes;
+    for (uint32_t i = 0; i < cacheSize + 1; i++) {
+        reusedNodes.insert(tagAllocator.getTag());
+    }
+    EXPECT_EQ(cacheSize + 1, reusedNodes.size());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorAndThreadCacheInUseWhenGettingAndReturningTagThenSharedFreeListIsUsed) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
+
+    auto &cache = tagAllocator.threadTagCaches[tagAllocator.getCurrentThreadTagCacheSlot()];
+    cache.inUse.test_and_set();
+
+    auto tagNode = tagAllocator.getTag();
+    EXPECT_EQ(0u, cache.count);
+    EXPECT_NE(0u, static_cast<uint32_t>(tagAllocator.freeTagsHead.load()));
+
+    tagAllocator.returnTag(tagNode);
+    EXPECT_EQ(0u, cache.count);
+
+    cache.inUse.clear();
+    std::set<TagNodeBase *> nodes = {tagAllocator.getTag(), tagAllocator.getTag()};
+    EXPECT_EQ(2u, nodes.size());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenNodeCannotBeReleasedThenItIsDeferredUntilReleaseIsAllowed) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, true, deviceBitfield);
+
+    auto node = tagAllocator.getTag();
+    EXPECT_FALSE(node->canBeReleased());
+
+    tagAllocator.returnTag(node);
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(0u, static_cast<uint32_t>(tagAllocator.freeTagsHead.load()));
+
+    tagAllocator.releaseDeferredTags();
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(0u, static_cast<uint32_t>(tagAllocator.freeTagsHead.load()));
+
+    node->setDoNotReleaseNodes(false);
+    EXPECT_EQ(node, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <future>
+#include <system_error>
+#include <thread>
+
+using namespace NEO;
+
+TEST(WorkerPoolTest, givenWorkerPoolWhenNoTaskIsSubmittedThenNoWorkerIsStarted) {
+    WorkerPool pool(4u);
+    EXPECT_EQ(0u, pool.getWorkersCount());
+}
+
+TEST(WorkerPoolTest, givenSubmittedTasksWhenPoolIsDestroyedThenAllTasksAreExecutedOnWorkerThreads) {
+    std::atomic<uint32_t> executed{0u};
+    std::atomic<bool> callingThreadUsed{false};
+    const auto callingThread = std::this_thread::get_id();
+    {
+        WorkerPool pool(2u);
+        for (uint32_t i = 0; i < 16u; i++) {
+            pool.submit([&]() {
+                if (std::this_thread::get_id() == callingThread) {
+                    callingThreadUsed = true;
+                }
+                executed++;
+            });
+        }
+        EXPECT_LE(pool.getWorkersCount(), 2u);
+    }
+    EXPECT_EQ(16u, executed.load());
+    EXPECT_FALSE(callingThreadUsed.load());
+}
+
+TEST(WorkerPoolTest, givenZeroMaxWorkersWhenSubmittingTaskThenSingleWorkerIsUsed) {
+    std::promise<void> taskDone;
+    WorkerPool pool(0u);
+    pool.submit([&]() { taskDone.set_value(); });
+    taskDone.get_future().wait();
+    EXPECT_EQ(1u, pool.getWorkersCount());
+}
+
+TEST(WorkerPoolTest, givenBlockedWorkersWhenMoreTasksThanMaxWorkersAreSubmittedThenWorkersCountIsBounded) {
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    std::atomic<uint32_t> executed{0u};
+    {
+        WorkerPool pool(3u);
+        for (uint32_t i = 0; i < 8u; i++) {
+            pool.submit([&, releaseFuture]() {
+                releaseFuture.wait();
+                executed++;
+            });
+        }
+        EXPECT_EQ(3u, pool.getWorkersCount());
+        release.set_value();
+    }
+    EXPECT_EQ(8u, executed.load());
+}
+
+struct WorkerPoolWithFailingThreadCreation : public WorkerPool {
+    using WorkerPool::WorkerPool;
+
+    void startWorker() override {
+        if (failThreadCreation) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        WorkerPool::startWorker();
+    }
+
+    bool failThreadCreation = false;
+};
+
+TEST(WorkerPoolTest, givenNoWorkerAndThreadCreationFailingWhenSubmittingTaskThenFalseIsReturnedAndTaskIsDropped) {
+    std::atomic<uint32_t> executed{0u};
+    {
+        WorkerPoolWithFailingThreadCreation pool(2u);
+        pool.failThreadCreation = true;
+        EXPECT_FALSE(pool.submit([&]() { executed++; }));
+        EXPECT_EQ(0u, pool.getWorkersCount());
+    }
+    EXPECT_EQ(0u, executed.load());
+}
+
+TEST(WorkerPoolTest, givenRunningWorkerAndThreadCreationFailingWhenSubmittingTasksThenTasksAreQueuedForRunningWorker) {
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    std::atomic<uint32_t> executed{0u};
+    {
+        WorkerPoolWithFailingThreadCreation pool(2u);
+        EXPECT_TRUE(pool.submit([&, releaseFuture]() {
+            releaseFuture.wait();
+            executed++;
+        }));
+        pool.failThreadCreation = true;
+        EXPECT_TRUE(pool.submit([&]() { executed++; }));
+        EXPECT_EQ(1u, pool.getWorkersCount());
+        release.set_value();
+    }
+    EXPECT_EQ(2u, executed.load());
+}
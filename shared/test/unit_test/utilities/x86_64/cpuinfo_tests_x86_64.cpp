@@ -155,6 +155,43 @@ TEST_F(CpuInfoTest, GivenAvx512FeatureBitsSetButOsXcr0MaskUnsetWhenDetectingThen
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
 }
 
+TEST_F(CpuInfoTest, GivenAvx512SupportedWhenDetectingThenAvx512ByteWordBitIsOn) {
+    CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512BW));
+}
+
+TEST_F(CpuInfoTest, GivenAvx512FoundationBitOnButByteWordBitOffWhenDetectingThenOnlyAvx512BitIsOn) {
+    CpuInfo::cpuidFunc = mockCpuidEnableAllExceptAvx512ByteWordBit;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512BW));
+}
+
+TEST_F(CpuInfoTest, GivenAvx512ByteWordBitOnButFoundationBitOffWhenDetectingThenAvx512ByteWordBitIsOff) {
+    CpuInfo::cpuidFunc = mockCpuidEnableAllExceptAvx512FoundationBit;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512BW));
+}
+
+TEST_F(CpuInfoTest, GivenAvx512ByteWordBitSetButOsXcr0MaskUnsetWhenDetectingThenAvx512ByteWordBitIsOff) {
+    CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvDisableAll;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512BW));
+}
+
 namespace {
 void setPagingMode(MockCpuInfo &cpuInfo, uint32_t virtualAddressSize, bool la57Present) {
     cpuInfo.featuresDetected = true;